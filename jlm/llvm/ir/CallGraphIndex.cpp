@@ -0,0 +1,261 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/llvm/ir/CallGraphIndex.hpp>
+#include <jlm/rvsdg/notifiers.hpp>
+#include <jlm/rvsdg/structural-node.hpp>
+
+namespace jlm::llvm
+{
+
+CallGraphIndex::~CallGraphIndex() noexcept = default;
+
+CallGraphIndex::CallGraphIndex(jlm::rvsdg::graph & graph)
+    : NumInvalidEntries_(0)
+{
+  Connect(*graph.root());
+}
+
+void
+CallGraphIndex::OutputCopied(const jlm::rvsdg::output &, const jlm::rvsdg::output &)
+{
+  // The index is maintained through the notifiers of the graph, which report all modifications.
+}
+
+void
+CallGraphIndex::LambdaInvalidated(const lambda::node &)
+{}
+
+void
+CallGraphIndex::ModuleInvalidated()
+{}
+
+const lambda::node::CallSummary &
+CallGraphIndex::GetCallSummary(const lambda::node & lambdaNode)
+{
+  std::lock_guard<std::mutex> guard(Mutex_);
+
+  auto it = Entries_.find(&lambdaNode);
+  if (it != Entries_.end() && it->second->IsValid)
+    return *it->second->CallSummary;
+
+  RemoveInvalidEntries();
+
+  auto & entry = Entries_[&lambdaNode];
+  if (entry)
+  {
+    RemoveRoutingOutputs(*entry);
+    NumInvalidEntries_--;
+  }
+  else
+  {
+    entry = std::make_unique<Entry>();
+  }
+
+  std::vector<const jlm::rvsdg::output *> routingOutputs;
+  entry->CallSummary = lambdaNode.ComputeCallSummary(routingOutputs);
+  for (auto output : routingOutputs)
+  {
+    auto region = output->region();
+    JLM_ASSERT(Regions_.find(region) != Regions_.end());
+    Regions_[region]->RoutingOutputs.emplace(output, entry.get());
+    entry->RoutingOutputs.emplace_back(region, output);
+  }
+  entry->IsValid = true;
+
+  return *entry->CallSummary;
+}
+
+size_t
+CallGraphIndex::NumCallSummaries() const noexcept
+{
+  size_t numCallSummaries = 0;
+  for (auto & [lambdaNode, entry] : Entries_)
+  {
+    if (entry->IsValid)
+      numCallSummaries++;
+  }
+
+  return numCallSummaries;
+}
+
+CallGraphIndex &
+CallGraphIndex::GetOrCreate(RvsdgModule & rvsdgModule)
+{
+  if (auto callGraphIndex = rvsdgModule.GetObserver<CallGraphIndex>())
+    return *callGraphIndex;
+
+  auto & observer =
+      rvsdgModule.AddObserver(std::make_unique<CallGraphIndex>(rvsdgModule.Rvsdg()));
+  return *static_cast<CallGraphIndex *>(&observer);
+}
+
+void
+CallGraphIndex::Connect(jlm::rvsdg::region & region)
+{
+  auto & notifiers = region.GetNotifiers();
+  auto & regionState = Regions_[&region];
+  regionState = std::make_unique<RegionState>();
+  auto & state = *regionState;
+
+  // The callbacks of the region only access the state of the region, and therefore require no
+  // synchronization with the modifications of other regions.
+  state.Callbacks.push_back(notifiers.on_input_create.connect(
+      [this, &state](jlm::rvsdg::input * input)
+      {
+        InvalidateUsersOf(state, *input->origin());
+      }));
+  state.Callbacks.push_back(notifiers.on_input_change.connect(
+      [this, &state](
+          jlm::rvsdg::input *,
+          jlm::rvsdg::output * oldOrigin,
+          jlm::rvsdg::output * newOrigin)
+      {
+        InvalidateUsersOf(state, *oldOrigin);
+        InvalidateUsersOf(state, *newOrigin);
+      }));
+  state.Callbacks.push_back(notifiers.on_input_destroy.connect(
+      [this, &state](jlm::rvsdg::input * input)
+      {
+        InvalidateUsersOf(state, *input->origin());
+      }));
+
+  // The inputs of simple nodes are not reported individually
+  state.Callbacks.push_back(notifiers.on_node_create.connect(
+      [this, &state](jlm::rvsdg::node * node)
+      {
+        for (size_t n = 0; n < node->ninputs(); n++)
+          InvalidateUsersOf(state, *node->input(n)->origin());
+      }));
+  state.Callbacks.push_back(notifiers.on_node_destroy.connect(
+      [this](jlm::rvsdg::node * node)
+      {
+        // The node is reported from the destructor of jlm::rvsdg::structural_node, where a
+        // dynamic_cast no longer yields lambda nodes.
+        if (jlm::rvsdg::is<lambda::operation>(node))
+          Invalidate(*static_cast<const lambda::node *>(node));
+      }));
+
+  state.Callbacks.push_back(notifiers.on_region_create.connect(
+      [this](jlm::rvsdg::region * subregion)
+      {
+        std::lock_guard<std::mutex> guard(Mutex_);
+        Connect(*subregion);
+      }));
+  state.Callbacks.push_back(notifiers.on_region_destroy.connect(
+      [this](jlm::rvsdg::region * subregion)
+      {
+        std::lock_guard<std::mutex> guard(Mutex_);
+        Disconnect(*subregion);
+      }));
+
+  for (auto & node : region.nodes)
+  {
+    if (auto structuralNode = dynamic_cast<jlm::rvsdg::structural_node *>(&node))
+    {
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+        Connect(*structuralNode->subregion(n));
+    }
+  }
+}
+
+void
+CallGraphIndex::Disconnect(const jlm::rvsdg::region & region)
+{
+  // The nodes of the region are removed without notifying the index, and the summaries of its
+  // lambda nodes, as well as of the lambda nodes routed through it, are therefore discarded now.
+  for (auto & node : region.nodes)
+  {
+    if (auto lambdaNode = dynamic_cast<const lambda::node *>(&node))
+      Invalidate(*lambdaNode);
+
+    if (auto structuralNode = dynamic_cast<const jlm::rvsdg::structural_node *>(&node))
+    {
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+        Disconnect(*structuralNode->subregion(n));
+    }
+  }
+
+  auto it = Regions_.find(&region);
+  for (auto & [output, entry] : it->second->RoutingOutputs)
+    Invalidate(*entry);
+
+  Regions_.erase(it);
+}
+
+void
+CallGraphIndex::Invalidate(const lambda::node & lambdaNode)
+{
+  // The entries are only inserted and removed by GetCallSummary(), which is never invoked while
+  // the graph is modified.
+  auto it = Entries_.find(&lambdaNode);
+  if (it != Entries_.end())
+    Invalidate(*it->second);
+}
+
+void
+CallGraphIndex::Invalidate(Entry & entry)
+{
+  if (entry.IsValid.exchange(false))
+    NumInvalidEntries_++;
+}
+
+void
+CallGraphIndex::InvalidateUsersOf(
+    const RegionState & regionState,
+    const jlm::rvsdg::output & output)
+{
+  auto range = regionState.RoutingOutputs.equal_range(&output);
+  for (auto it = range.first; it != range.second; it++)
+    Invalidate(*it->second);
+}
+
+void
+CallGraphIndex::RemoveRoutingOutputs(Entry & entry)
+{
+  for (auto & [region, output] : entry.RoutingOutputs)
+  {
+    // The state of a removed region has already been discarded
+    auto regionState = Regions_.find(region);
+    if (regionState == Regions_.end())
+      continue;
+
+    auto & routingOutputs = regionState->second->RoutingOutputs;
+    auto range = routingOutputs.equal_range(output);
+    for (auto it = range.first; it != range.second; it++)
+    {
+      if (it->second == &entry)
+      {
+        routingOutputs.erase(it);
+        break;
+      }
+    }
+  }
+
+  entry.RoutingOutputs.clear();
+}
+
+void
+CallGraphIndex::RemoveInvalidEntries()
+{
+  if (NumInvalidEntries_ * 2 <= Entries_.size())
+    return;
+
+  for (auto it = Entries_.begin(); it != Entries_.end();)
+  {
+    if (it->second->IsValid)
+    {
+      it++;
+      continue;
+    }
+
+    RemoveRoutingOutputs(*it->second);
+    it = Entries_.erase(it);
+  }
+
+  NumInvalidEntries_ = 0;
+}
+
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_LLVM_IR_CALLGRAPHINDEX_HPP
+#define JLM_LLVM_IR_CALLGRAPHINDEX_HPP
+
+#include <jlm/llvm/ir/operators/lambda.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/util/callbacks.hpp>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace jlm::llvm
+{
+
+/** \brief Caches the call summaries of the lambda nodes of an RVSDG module
+ *
+ * The index computes the \ref lambda::node::CallSummary of a lambda node on the first request and
+ * keeps it until the graph is modified in a way that affects it. To this end, the index records
+ * the outputs that route a lambda node to its users, and connects to the notifiers of all regions
+ * of the graph. The summary of a lambda node is discarded as soon as an input that uses one of
+ * its routing outputs is created, diverted, or removed, or when the lambda node is removed. All
+ * other modifications of the graph leave the cached summaries intact.
+ *
+ * The index is registered as an observer with its module, such that it is built only once and
+ * maintained across optimizations. Function-local optimizations might modify different regions of
+ * the graph concurrently. The routing outputs are therefore recorded per region, such that the
+ * callbacks of a region only access the state of this region, and discarding a summary only marks
+ * its entry as invalid. Only the creation and removal of regions is serialized by a mutex.
+ * Summaries must not be requested while the graph is modified concurrently.
+ *
+ * @see lambda::node::ComputeCallSummary()
+ */
+class CallGraphIndex final : public RvsdgModuleObserver
+{
+  struct Entry
+  {
+    std::unique_ptr<lambda::node::CallSummary> CallSummary;
+    std::vector<std::pair<const jlm::rvsdg::region *, const jlm::rvsdg::output *>> RoutingOutputs;
+    std::atomic<bool> IsValid;
+  };
+
+  struct RegionState
+  {
+    // The routing outputs of the region, and the entries of the lambda nodes they route
+    std::unordered_multimap<const jlm::rvsdg::output *, Entry *> RoutingOutputs;
+    std::vector<util::callback> Callbacks;
+  };
+
+public:
+  ~CallGraphIndex() noexcept override;
+
+  explicit CallGraphIndex(jlm::rvsdg::graph & graph);
+
+  CallGraphIndex(const CallGraphIndex &) = delete;
+
+  CallGraphIndex(CallGraphIndex &&) = delete;
+
+  CallGraphIndex &
+  operator=(const CallGraphIndex &) = delete;
+
+  CallGraphIndex &
+  operator=(CallGraphIndex &&) = delete;
+
+  void
+  OutputCopied(const jlm::rvsdg::output & original, const jlm::rvsdg::output & copy) override;
+
+  void
+  LambdaInvalidated(const lambda::node & lambdaNode) override;
+
+  void
+  ModuleInvalidated() override;
+
+  /**
+   * Returns the call summary of \p lambdaNode. The summary is computed if the index holds no valid
+   * summary for \p lambdaNode.
+   *
+   * @param lambdaNode A lambda node of the indexed graph.
+   *
+   * @return The call summary of \p lambdaNode. It remains valid until the graph is modified.
+   */
+  const lambda::node::CallSummary &
+  GetCallSummary(const lambda::node & lambdaNode);
+
+  /**
+   * @return The number of lambda nodes for which the index holds a valid call summary.
+   */
+  [[nodiscard]] size_t
+  NumCallSummaries() const noexcept;
+
+  /**
+   * Returns the call graph index of \p rvsdgModule. The index is created and registered as an
+   * observer with \p rvsdgModule if the module has none.
+   *
+   * @param rvsdgModule The RVSDG module.
+   *
+   * @return The call graph index of \p rvsdgModule.
+   */
+  static CallGraphIndex &
+  GetOrCreate(RvsdgModule & rvsdgModule);
+
+private:
+  /**
+   * Connects the index to the notifiers of \p region and all its subregions.
+   */
+  void
+  Connect(jlm::rvsdg::region & region);
+
+  /**
+   * Disconnects the index from the notifiers of \p region and all its subregions, and discards
+   * the summaries of all lambda nodes within them.
+   */
+  void
+  Disconnect(const jlm::rvsdg::region & region);
+
+  void
+  Invalidate(const lambda::node & lambdaNode);
+
+  void
+  Invalidate(Entry & entry);
+
+  /**
+   * Discards the summaries of all lambda nodes that are routed through \p output, which belongs
+   * to the region of \p regionState.
+   */
+  void
+  InvalidateUsersOf(const RegionState & regionState, const jlm::rvsdg::output & output);
+
+  /**
+   * Removes the routing outputs of \p entry from the states of their regions.
+   */
+  void
+  RemoveRoutingOutputs(Entry & entry);
+
+  /**
+   * Removes the entries that were discarded, once they outnumber the valid ones.
+   */
+  void
+  RemoveInvalidEntries();
+
+  // Serializes the accesses to Regions_, as well as the requests of summaries
+  std::mutex Mutex_;
+  std::unordered_map<const lambda::node *, std::unique_ptr<Entry>> Entries_;
+  std::unordered_map<const jlm::rvsdg::region *, std::unique_ptr<RegionState>> Regions_;
+  std::atomic<size_t> NumInvalidEntries_;
+};
+
+}
+
+#endif // JLM_LLVM_IR_CALLGRAPHINDEX_HPP
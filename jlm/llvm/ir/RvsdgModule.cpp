@@ -3,7 +3,14 @@
  * See COPYING for terms of redistribution.
  */
 
+#include <jlm/llvm/ir/operators/lambda.hpp>
 #include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/rvsdg/structural-node.hpp>
+#include <jlm/rvsdg/substitution.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
 
 namespace jlm::llvm
 {
@@ -26,4 +33,189 @@ impport::copy() const
   return std::unique_ptr<port>(new impport(*this));
 }
 
+/* RvsdgModuleObserver class */
+
+RvsdgModuleObserver::~RvsdgModuleObserver() noexcept = default;
+
+/* RvsdgModule class */
+
+RvsdgModuleObserver &
+RvsdgModule::AddObserver(std::unique_ptr<RvsdgModuleObserver> observer)
+{
+  Observers_.push_back(std::move(observer));
+  return *Observers_.back();
+}
+
+void
+RvsdgModule::RemoveObserver(const RvsdgModuleObserver & observer)
+{
+  auto it = std::find_if(
+      Observers_.begin(),
+      Observers_.end(),
+      [&](const std::unique_ptr<RvsdgModuleObserver> & o)
+      {
+        return o.get() == &observer;
+      });
+  JLM_ASSERT(it != Observers_.end());
+
+  Observers_.erase(it);
+}
+
+void
+RvsdgModule::NotifyOutputCopied(
+    const jlm::rvsdg::output & original,
+    const jlm::rvsdg::output & copy)
+{
+  for (auto & observer : Observers_)
+    observer->OutputCopied(original, copy);
+}
+
+/**
+ * Collects the arguments and node outputs of \p region along with their copies in \p copy, where
+ * \p copy was created by jlm::rvsdg::region::copy(). The copy appends the nodes in the order of
+ * their depth, and the nodes of both regions are therefore matched in this order.
+ *
+ * @return False if the nodes of \p region and \p copy do not match, otherwise true.
+ */
+static bool
+CollectCopiedOutputs(
+    const jlm::rvsdg::region & region,
+    const jlm::rvsdg::region & copy,
+    std::vector<std::pair<const jlm::rvsdg::output *, const jlm::rvsdg::output *>> & copies)
+{
+  if (region.narguments() != copy.narguments() || region.nnodes() != copy.nnodes())
+    return false;
+
+  for (size_t n = 0; n < region.narguments(); n++)
+    copies.emplace_back(region.argument(n), copy.argument(n));
+
+  std::vector<const jlm::rvsdg::node *> nodes;
+  for (auto & node : region.nodes)
+    nodes.push_back(&node);
+  std::stable_sort(
+      nodes.begin(),
+      nodes.end(),
+      [](const jlm::rvsdg::node * a, const jlm::rvsdg::node * b)
+      {
+        return a->depth() < b->depth();
+      });
+
+  auto copyNode = copy.nodes.begin();
+  for (auto node : nodes)
+  {
+    if (node->noutputs() != copyNode->noutputs() || !(node->operation() == copyNode->operation()))
+      return false;
+
+    for (size_t n = 0; n < node->noutputs(); n++)
+      copies.emplace_back(node->output(n), copyNode->output(n));
+
+    if (auto structuralNode = dynamic_cast<const jlm::rvsdg::structural_node *>(node))
+    {
+      auto structuralCopy = static_cast<const jlm::rvsdg::structural_node *>(&*copyNode);
+      if (structuralCopy->nsubregions() != structuralNode->nsubregions())
+        return false;
+
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+      {
+        if (!CollectCopiedOutputs(
+                *structuralNode->subregion(n),
+                *structuralCopy->subregion(n),
+                copies))
+          return false;
+      }
+    }
+
+    ++copyNode;
+  }
+
+  return true;
+}
+
+void
+RvsdgModule::NotifyRegionCopied(
+    const jlm::rvsdg::region & region,
+    const jlm::rvsdg::substitution_map & smap)
+{
+  if (Observers_.empty())
+    return;
+
+  std::vector<std::pair<const jlm::rvsdg::output *, const jlm::rvsdg::output *>> copies;
+  for (auto & node : region.nodes)
+  {
+    for (size_t n = 0; n < node.noutputs(); n++)
+    {
+      if (auto copy = smap.lookup(node.output(n)))
+        NotifyOutputCopied(*node.output(n), *copy);
+    }
+
+    auto structuralNode = dynamic_cast<const jlm::rvsdg::structural_node *>(&node);
+    if (structuralNode == nullptr)
+      continue;
+
+    // The outputs within the subregions of a structural node are not contained in smap, and are
+    // matched with the subregions of the copy instead.
+    if (node.noutputs() == 0)
+    {
+      InvalidateAnalyses();
+      continue;
+    }
+
+    // The copies are part of the region if it was copied into itself
+    auto copyOutput = smap.lookup(node.output(0));
+    if (copyOutput == nullptr)
+      continue;
+
+    auto copyNode = jlm::rvsdg::node_output::node(copyOutput);
+    auto structuralCopy = dynamic_cast<const jlm::rvsdg::structural_node *>(copyNode);
+    copies.clear();
+    bool isMatched =
+        structuralCopy && structuralCopy->nsubregions() == structuralNode->nsubregions();
+    for (size_t n = 0; isMatched && n < structuralNode->nsubregions(); n++)
+    {
+      isMatched = CollectCopiedOutputs(
+          *structuralNode->subregion(n),
+          *structuralCopy->subregion(n),
+          copies);
+    }
+
+    if (!isMatched)
+    {
+      InvalidateRegion(*copyOutput->region());
+      continue;
+    }
+
+    for (auto & [original, copy] : copies)
+      NotifyOutputCopied(*original, *copy);
+  }
+}
+
+void
+RvsdgModule::InvalidateLambda(const lambda::node & lambdaNode)
+{
+  for (auto & observer : Observers_)
+    observer->LambdaInvalidated(lambdaNode);
+}
+
+void
+RvsdgModule::InvalidateRegion(const jlm::rvsdg::region & region)
+{
+  for (auto r = &region; r->node() != nullptr; r = r->node()->region())
+  {
+    if (auto lambdaNode = dynamic_cast<const lambda::node *>(r->node()))
+    {
+      InvalidateLambda(*lambdaNode);
+      return;
+    }
+  }
+
+  InvalidateAnalyses();
+}
+
+void
+RvsdgModule::InvalidateAnalyses()
+{
+  for (auto & observer : Observers_)
+    observer->ModuleInvalidated();
+}
+
 }
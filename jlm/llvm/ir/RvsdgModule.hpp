@@ -11,9 +11,22 @@
 #include <jlm/rvsdg/graph.hpp>
 #include <jlm/util/file.hpp>
 
+#include <memory>
+#include <vector>
+
+namespace jlm::rvsdg
+{
+class substitution_map;
+}
+
 namespace jlm::llvm
 {
 
+namespace lambda
+{
+class node;
+}
+
 /* impport class */
 
 class impport final : public jlm::rvsdg::impport
@@ -86,6 +99,53 @@ is_export(const jlm::rvsdg::input * input)
   return result && result->region() == graph->root();
 }
 
+/** \brief Observer of the modifications of an RVSDG module
+ *
+ * Analyses register observers with a module in order to keep their results valid across
+ * optimizations. An optimization either reports the outputs it creates to the observers, or
+ * invalidates the observed analysis results.
+ *
+ * Removed nodes and outputs are not reported. An observer that keeps information about them
+ * connects to the notifiers of the regions of the module, e.g., jlm::rvsdg::notifiers::
+ * on_node_destroy, and discards the information as they are destroyed.
+ *
+ * @see RvsdgModule::NotifyOutputCopied()
+ * @see RvsdgModule::InvalidateLambda()
+ * @see RvsdgModule::InvalidateAnalyses()
+ */
+class RvsdgModuleObserver
+{
+public:
+  virtual ~RvsdgModuleObserver() noexcept;
+
+  /**
+   * Invoked after \p copy was created as a copy of \p original. The copy can hold all values that
+   * the original can hold, and a copy of a node that allocates memory allocates memory that behaves
+   * like the memory of the original node. An output can be a copy of several outputs.
+   *
+   * @param original The original output.
+   * @param copy The copy of \p original.
+   */
+  virtual void
+  OutputCopied(const jlm::rvsdg::output & original, const jlm::rvsdg::output & copy) = 0;
+
+  /**
+   * Invoked after the subregion of \p lambdaNode was modified in a way that cannot be reported
+   * through OutputCopied().
+   *
+   * @param lambdaNode The modified lambda node.
+   */
+  virtual void
+  LambdaInvalidated(const lambda::node & lambdaNode) = 0;
+
+  /**
+   * Invoked after the module was modified in a way that cannot be reported through
+   * OutputCopied() or LambdaInvalidated().
+   */
+  virtual void
+  ModuleInvalidated() = 0;
+};
+
 /** \brief RVSDG module class
  *
  */
@@ -138,6 +198,84 @@ public:
     return DataLayout_;
   }
 
+  /**
+   * Registers \p observer with the module. The module takes ownership of the observer.
+   *
+   * @param observer The observer to register.
+   *
+   * @return A reference to the registered observer.
+   */
+  RvsdgModuleObserver &
+  AddObserver(std::unique_ptr<RvsdgModuleObserver> observer);
+
+  /**
+   * Unregisters and destroys \p observer.
+   *
+   * @param observer An observer registered with AddObserver().
+   */
+  void
+  RemoveObserver(const RvsdgModuleObserver & observer);
+
+  /**
+   * @return The first registered observer of type T, or nullptr if there is none.
+   */
+  template<class T>
+  [[nodiscard]] T *
+  GetObserver() const noexcept
+  {
+    for (auto & observer : Observers_)
+    {
+      if (auto castedObserver = dynamic_cast<T *>(observer.get()))
+        return castedObserver;
+    }
+
+    return nullptr;
+  }
+
+  /**
+   * Reports to all observers that \p copy was created as a copy of \p original.
+   *
+   * @see RvsdgModuleObserver::OutputCopied()
+   */
+  void
+  NotifyOutputCopied(const jlm::rvsdg::output & original, const jlm::rvsdg::output & copy);
+
+  /**
+   * Reports to all observers that the nodes of \p region were copied, where \p smap maps the
+   * outputs of the nodes to their copies. The outputs within the subregions of structural nodes
+   * are not contained in \p smap, and are reported by matching the subregions of a structural node
+   * with the subregions of its copy. The lambda node containing the copies is only invalidated if
+   * the subregions do not match, or the copy of a structural node cannot be determined.
+   *
+   * @param region The region whose nodes were copied.
+   * @param smap The substitution map filled by jlm::rvsdg::region::copy().
+   */
+  void
+  NotifyRegionCopied(const jlm::rvsdg::region & region, const jlm::rvsdg::substitution_map & smap);
+
+  /**
+   * Reports to all observers that the subregion of \p lambdaNode was modified.
+   *
+   * @see RvsdgModuleObserver::LambdaInvalidated()
+   */
+  void
+  InvalidateLambda(const lambda::node & lambdaNode);
+
+  /**
+   * Reports to all observers that the lambda node containing \p region was modified, or that the
+   * module was modified if \p region is not contained in a lambda node.
+   */
+  void
+  InvalidateRegion(const jlm::rvsdg::region & region);
+
+  /**
+   * Reports to all observers that the module was modified.
+   *
+   * @see RvsdgModuleObserver::ModuleInvalidated()
+   */
+  void
+  InvalidateAnalyses();
+
   static std::unique_ptr<RvsdgModule>
   Create(
       const jlm::util::filepath & sourceFileName,
@@ -149,6 +287,7 @@ public:
 
 private:
   jlm::rvsdg::graph Rvsdg_;
+  std::vector<std::unique_ptr<RvsdgModuleObserver>> Observers_;
   std::string DataLayout_;
   std::string TargetTriple_;
   const jlm::util::filepath SourceFileName_;
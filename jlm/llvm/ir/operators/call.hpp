@@ -410,7 +410,9 @@ public:
     std::vector<jlm::rvsdg::output *> operands({ function });
     operands.insert(operands.end(), arguments.begin(), arguments.end());
 
-    return jlm::rvsdg::outputs(new CallNode(*function->region(), callOperation, operands));
+    auto & region = *function->region();
+    auto & arena = region.graph()->GetArena();
+    return jlm::rvsdg::outputs(new (arena) CallNode(region, callOperation, operands));
   }
 
   static std::vector<jlm::rvsdg::output *>
@@ -421,7 +423,8 @@ public:
   {
     CheckFunctionType(callOperation.GetFunctionType());
 
-    return jlm::rvsdg::outputs(new CallNode(region, callOperation, operands));
+    auto & arena = region.graph()->GetArena();
+    return jlm::rvsdg::outputs(new (arena) CallNode(region, callOperation, operands));
   }
 
   /**
@@ -239,9 +239,21 @@ node::copy(jlm::rvsdg::region * region, jlm::rvsdg::substitution_map & smap) con
 
 std::unique_ptr<node::CallSummary>
 node::ComputeCallSummary() const
+{
+  std::vector<const rvsdg::output *> routingOutputs;
+  return ComputeCallSummary(routingOutputs);
+}
+
+std::unique_ptr<node::CallSummary>
+node::ComputeCallSummary(std::vector<const rvsdg::output *> & routingOutputs) const
 {
   std::deque<rvsdg::input *> worklist;
-  worklist.insert(worklist.end(), output()->begin(), output()->end());
+  auto pushUsers = [&](rvsdg::output * output)
+  {
+    routingOutputs.push_back(output);
+    worklist.insert(worklist.end(), output->begin(), output->end());
+  };
+  pushUsers(output());
 
   std::vector<CallNode *> directCalls;
   rvsdg::result * rvsdgExport = nullptr;
@@ -255,59 +267,59 @@ node::ComputeCallSummary() const
     if (auto cvinput = dynamic_cast<lambda::cvinput *>(input))
     {
       auto argument = cvinput->argument();
-      worklist.insert(worklist.end(), argument->begin(), argument->end());
+      pushUsers(argument);
       continue;
     }
 
     if (auto gamma_input = dynamic_cast<rvsdg::gamma_input *>(input))
     {
       for (auto & argument : *gamma_input)
-        worklist.insert(worklist.end(), argument.begin(), argument.end());
+        pushUsers(&argument);
       continue;
     }
 
     if (auto result = is_gamma_result(input))
     {
       auto output = result->output();
-      worklist.insert(worklist.end(), output->begin(), output->end());
+      pushUsers(output);
       continue;
     }
 
     if (auto theta_input = dynamic_cast<rvsdg::theta_input *>(input))
     {
       auto argument = theta_input->argument();
-      worklist.insert(worklist.end(), argument->begin(), argument->end());
+      pushUsers(argument);
       continue;
     }
 
     if (auto result = is_theta_result(input))
     {
       auto output = result->output();
-      worklist.insert(worklist.end(), output->begin(), output->end());
+      pushUsers(output);
       continue;
     }
 
     if (auto cvinput = dynamic_cast<phi::cvinput *>(input))
     {
       auto argument = cvinput->argument();
-      worklist.insert(worklist.end(), argument->begin(), argument->end());
+      pushUsers(argument);
       continue;
     }
 
     if (auto rvresult = dynamic_cast<phi::rvresult *>(input))
     {
       auto argument = rvresult->argument();
-      worklist.insert(worklist.end(), argument->begin(), argument->end());
+      pushUsers(argument);
 
       auto output = rvresult->output();
-      worklist.insert(worklist.end(), output->begin(), output->end());
+      pushUsers(output);
       continue;
     }
 
     if (auto cvinput = dynamic_cast<delta::cvinput *>(input))
     {
       auto argument = cvinput->arguments.first();
-      worklist.insert(worklist.end(), argument->begin(), argument->end());
+      pushUsers(argument);
       continue;
     }
 
@@ -344,6 +356,30 @@ node::ComputeCallSummary() const
   return CallSummary::Create(rvsdgExport, std::move(directCalls), std::move(otherUsers));
 }
 
+static void
+CollectLambdaNodes(jlm::rvsdg::region & region, std::vector<lambda::node *> & lambdaNodes)
+{
+  for (auto & node : region.nodes)
+  {
+    if (auto lambdaNode = dynamic_cast<lambda::node *>(&node))
+    {
+      lambdaNodes.push_back(lambdaNode);
+    }
+    else if (auto phiNode = dynamic_cast<phi::node *>(&node))
+    {
+      CollectLambdaNodes(*phiNode->subregion(), lambdaNodes);
+    }
+  }
+}
+
+std::vector<lambda::node *>
+CollectLambdaNodes(jlm::rvsdg::region & region)
+{
+  std::vector<lambda::node *> lambdaNodes;
+  CollectLambdaNodes(region, lambdaNodes);
+  return lambdaNodes;
+}
+
 /* lambda context variable input class */
 
 cvinput::~cvinput() = default;
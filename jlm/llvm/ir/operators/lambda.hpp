@@ -372,6 +372,18 @@ public:
    */
   [[nodiscard]] std::unique_ptr<CallSummary>
   ComputeCallSummary() const;
+
+  /**
+   * Compute the \ref CallSummary of the lambda, and collect the outputs that route the lambda to
+   * its users, i.e., the output of the lambda, as well as all arguments and outputs of gamma,
+   * theta, lambda, phi, and delta nodes the lambda is passed through.
+   *
+   * @param routingOutputs The collected outputs.
+   *
+   * @return A new CallSummary instance.
+   */
+  [[nodiscard]] std::unique_ptr<CallSummary>
+  ComputeCallSummary(std::vector<const jlm::rvsdg::output *> & routingOutputs) const;
 };
 
 /** \brief Lambda context variable input
@@ -864,6 +876,17 @@ lambda::node::RemoveLambdaInputsWhere(const F & match)
   return numRemovedInputs;
 }
 
+/**
+ * Collects the lambda nodes of \p region in the order of its nodes. The lambda nodes of a phi node
+ * are collected at the position of the phi node.
+ *
+ * @param region The region, typically the root region of an RVSDG.
+ *
+ * @return The lambda nodes of \p region and of its phi nodes.
+ */
+std::vector<lambda::node *>
+CollectLambdaNodes(jlm::rvsdg::region & region);
+
 }
 }
 
@@ -337,7 +337,9 @@ public:
     operands.insert(operands.end(), states.begin(), states.end());
 
     LoadOperation loadOperation(loadedType, states.size(), alignment);
-    return rvsdg::outputs(new LoadNode(*address->region(), loadOperation, operands));
+    auto & region = *address->region();
+    auto & arena = region.graph()->GetArena();
+    return rvsdg::outputs(new (arena) LoadNode(region, loadOperation, operands));
   }
 
   static std::vector<rvsdg::output *>
@@ -346,7 +348,8 @@ public:
       const LoadOperation & loadOperation,
       const std::vector<rvsdg::output *> & operands)
   {
-    return rvsdg::outputs(new LoadNode(region, loadOperation, operands));
+    auto & arena = region.graph()->GetArena();
+    return rvsdg::outputs(new (arena) LoadNode(region, loadOperation, operands));
   }
 
 private:
@@ -282,7 +282,9 @@ public:
     operands.insert(operands.end(), states.begin(), states.end());
 
     StoreOperation storeOperation(storedType, states.size(), alignment);
-    return jlm::rvsdg::outputs(new StoreNode(*address->region(), storeOperation, operands));
+    auto & region = *address->region();
+    auto & arena = region.graph()->GetArena();
+    return jlm::rvsdg::outputs(new (arena) StoreNode(region, storeOperation, operands));
   }
 
   static std::vector<jlm::rvsdg::output *>
@@ -291,7 +293,8 @@ public:
       const StoreOperation & storeOperation,
       const std::vector<jlm::rvsdg::output *> & operands)
   {
-    return jlm::rvsdg::outputs(new StoreNode(region, storeOperation, operands));
+    auto & arena = region.graph()->GetArena();
+    return jlm::rvsdg::outputs(new (arena) StoreNode(region, storeOperation, operands));
   }
 
 private:
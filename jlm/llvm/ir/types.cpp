@@ -103,6 +103,19 @@ FunctionType::copy() const
   return std::unique_ptr<jlm::rvsdg::type>(new FunctionType(*this));
 }
 
+size_t
+FunctionType::hash() const noexcept
+{
+  auto hash = typeid(FunctionType).hash_code();
+  for (auto & type : ArgumentTypes_)
+    hash = hash * 31 + type->hash();
+
+  for (auto & type : ResultTypes_)
+    hash = hash * 31 + type->hash();
+
+  return hash;
+}
+
 FunctionType &
 FunctionType::operator=(const FunctionType & rhs)
 {
@@ -170,6 +183,12 @@ arraytype::copy() const
   return std::unique_ptr<jlm::rvsdg::type>(new arraytype(*this));
 }
 
+size_t
+arraytype::hash() const noexcept
+{
+  return (typeid(arraytype).hash_code() ^ element_type().hash()) * 31 + nelements_;
+}
+
 /* floating point type */
 
 fptype::~fptype()
@@ -200,6 +219,12 @@ fptype::copy() const
   return std::unique_ptr<jlm::rvsdg::type>(new fptype(*this));
 }
 
+size_t
+fptype::hash() const noexcept
+{
+  return typeid(fptype).hash_code() ^ std::hash<fpsize>()(size_);
+}
+
 /* vararg type */
 
 varargtype::~varargtype()
@@ -239,6 +264,14 @@ StructType::debug_string() const
   return "struct";
 }
 
+size_t
+StructType::hash() const noexcept
+{
+  auto hash = typeid(StructType).hash_code() ^ std::hash<std::string>()(Name_);
+  hash = hash * 31 + std::hash<const jlm::rvsdg::rcddeclaration *>()(&Declaration_);
+  return hash * 31 + IsPacked_;
+}
+
 std::unique_ptr<jlm::rvsdg::type>
 StructType::copy() const
 {
@@ -254,6 +287,14 @@ vectortype::operator==(const jlm::rvsdg::type & other) const noexcept
   return type && type->size_ == size_ && *type->type_ == *type_;
 }
 
+size_t
+vectortype::hash() const noexcept
+{
+  // Fixed and scalable vector types of the same size compare equal, and their hash values
+  // therefore do not depend on the concrete class.
+  return (typeid(vectortype).hash_code() ^ type_->hash()) * 31 + size_;
+}
+
 /* fixedvectortype */
 
 fixedvectortype::~fixedvectortype()
@@ -153,6 +153,9 @@ public:
   std::unique_ptr<jlm::rvsdg::type>
   copy() const override;
 
+  [[nodiscard]] size_t
+  hash() const noexcept override;
+
 private:
   std::vector<std::unique_ptr<jlm::rvsdg::type>> ResultTypes_;
   std::vector<std::unique_ptr<jlm::rvsdg::type>> ArgumentTypes_;
@@ -225,6 +228,9 @@ public:
   virtual std::unique_ptr<jlm::rvsdg::type>
   copy() const override;
 
+  [[nodiscard]] size_t
+  hash() const noexcept override;
+
   inline size_t
   nelements() const noexcept
   {
@@ -281,6 +287,9 @@ public:
   virtual std::unique_ptr<jlm::rvsdg::type>
   copy() const override;
 
+  [[nodiscard]] size_t
+  hash() const noexcept override;
+
   inline const fpsize &
   size() const noexcept
   {
@@ -389,6 +398,9 @@ public:
   [[nodiscard]] std::string
   debug_string() const override;
 
+  [[nodiscard]] size_t
+  hash() const noexcept override;
+
   static std::unique_ptr<StructType>
   Create(const std::string & name, bool isPacked, const jlm::rvsdg::rcddeclaration & declaration)
   {
@@ -454,6 +466,9 @@ public:
   virtual bool
   operator==(const jlm::rvsdg::type & other) const noexcept override;
 
+  [[nodiscard]] size_t
+  hash() const noexcept override;
+
   size_t
   size() const noexcept
   {
@@ -615,7 +630,10 @@ IsOrContains(const jlm::rvsdg::type & type)
   {
     auto & structDeclaration = structType->GetDeclaration();
     for (size_t n = 0; n < structDeclaration.nelements(); n++)
-      return IsOrContains<ELEMENTYPE>(structDeclaration.element(n));
+    {
+      if (IsOrContains<ELEMENTYPE>(structDeclaration.element(n)))
+        return true;
+    }
 
     return false;
   }
@@ -6,6 +6,7 @@
 #include <jlm/llvm/ir/operators.hpp>
 #include <jlm/llvm/ir/RvsdgModule.hpp>
 #include <jlm/llvm/opt/DeadNodeElimination.hpp>
+#include <jlm/rvsdg/NodeSideTable.hpp>
 #include <jlm/util/Statistics.hpp>
 #include <jlm/util/time.hpp>
 
@@ -35,20 +36,63 @@ is_phi_argument(const jlm::rvsdg::output * output)
  * to mark o2 alive in the future, we can immediately stop marking instead of reiterating through i1
  * ... iN again. Thus, by marking the entire simple node instead of just its outputs, we reduce the
  * runtime for marking Node2 from O(oN x iN) to O(oN + iN).
+ *
+ * The liveness of simple nodes is kept in a bit vector indexed by the node identifiers. The
+ * liveness of the outputs of a structural node and the arguments of its subregions is kept in bit
+ * vectors indexed by the output and argument indices, and these are associated with the structural
+ * node through a NodeSideTable. Neither marking nor sweeping therefore hashes any node or output.
+ * The sweep phase only removes outputs and arguments in descending index order, such that the
+ * indices of the outputs and arguments that are still queried remain valid.
+ *
+ * The context also provides the worklist of the mark phase, which avoids a recursion depth that is
+ * proportional to the length of the longest dependency chain in the RVSDG.
  */
 class DeadNodeElimination::Context final
 {
+  /**
+   * The liveness of the outputs of a structural node and the arguments of its subregions.
+   */
+  struct StructuralNodeLiveness
+  {
+    std::vector<bool> Outputs;
+    std::vector<std::vector<bool>> Arguments;
+  };
+
 public:
+  explicit Context(const jlm::rvsdg::graph & graph)
+      : SimpleNodes_(graph.NumNodeIds(), false),
+        RootArguments_(graph.root()->narguments(), false)
+  {}
+
   void
   MarkAlive(const jlm::rvsdg::output & output)
   {
     if (auto simpleOutput = dynamic_cast<const jlm::rvsdg::simple_output *>(&output))
     {
-      SimpleNodes_.Insert(simpleOutput->node());
+      auto id = simpleOutput->node()->GetId();
+      JLM_ASSERT(id < SimpleNodes_.size());
+      SimpleNodes_[id] = true;
       return;
     }
 
-    Outputs_.Insert(&output);
+    if (auto argument = dynamic_cast<const jlm::rvsdg::argument *>(&output))
+    {
+      auto node = argument->region()->node();
+      if (node == nullptr)
+      {
+        JLM_ASSERT(argument->index() < RootArguments_.size());
+        RootArguments_[argument->index()] = true;
+        return;
+      }
+
+      auto & liveness = GetOrCreateLiveness(*node);
+      liveness.Arguments[argument->region()->index()][argument->index()] = true;
+      return;
+    }
+
+    auto structuralOutput = util::AssertedCast<const jlm::rvsdg::structural_output>(&output);
+    auto & liveness = GetOrCreateLiveness(*structuralOutput->node());
+    liveness.Outputs[structuralOutput->index()] = true;
   }
 
   bool
@@ -56,10 +100,37 @@ public:
   {
     if (auto simpleOutput = dynamic_cast<const jlm::rvsdg::simple_output *>(&output))
     {
-      return SimpleNodes_.Contains(simpleOutput->node());
+      return SimpleNodes_[simpleOutput->node()->GetId()];
     }
 
-    return Outputs_.Contains(&output);
+    if (auto argument = dynamic_cast<const jlm::rvsdg::argument *>(&output))
+    {
+      auto node = argument->region()->node();
+      if (node == nullptr)
+      {
+        return argument->index() < RootArguments_.size() && RootArguments_[argument->index()];
+      }
+
+      if (!StructuralNodes_.Contains(*node))
+      {
+        return false;
+      }
+
+      auto & arguments = StructuralNodes_.Lookup(*node).Arguments[argument->region()->index()];
+      JLM_ASSERT(argument->index() < arguments.size());
+      return arguments[argument->index()];
+    }
+
+    auto structuralOutput = util::AssertedCast<const jlm::rvsdg::structural_output>(&output);
+    auto node = structuralOutput->node();
+    if (!StructuralNodes_.Contains(*node))
+    {
+      return false;
+    }
+
+    auto & outputs = StructuralNodes_.Lookup(*node).Outputs;
+    JLM_ASSERT(structuralOutput->index() < outputs.size());
+    return outputs[structuralOutput->index()];
   }
 
   bool
@@ -67,7 +138,12 @@ public:
   {
     if (auto simpleNode = dynamic_cast<const jlm::rvsdg::simple_node *>(&node))
     {
-      return SimpleNodes_.Contains(simpleNode);
+      return SimpleNodes_[simpleNode->GetId()];
+    }
+
+    if (!StructuralNodes_.Contains(node))
+    {
+      return false;
     }
 
     for (size_t n = 0; n < node.noutputs(); n++)
@@ -81,15 +157,63 @@ public:
     return false;
   }
 
+  void
+  PushOutput(const jlm::rvsdg::output & output)
+  {
+    Worklist_.push_back(&output);
+  }
+
+  /**
+   * @return The next output of the worklist that is not yet marked as alive, or nullptr if there
+   * is no such output.
+   */
+  const jlm::rvsdg::output *
+  PopOutput() noexcept
+  {
+    while (!Worklist_.empty())
+    {
+      auto output = Worklist_.back();
+      Worklist_.pop_back();
+      if (!IsAlive(*output))
+      {
+        return output;
+      }
+    }
+
+    return nullptr;
+  }
+
   static std::unique_ptr<Context>
-  Create()
+  Create(const jlm::rvsdg::graph & graph)
   {
-    return std::make_unique<Context>();
+    return std::make_unique<Context>(graph);
   }
 
 private:
-  util::HashSet<const jlm::rvsdg::simple_node *> SimpleNodes_;
-  util::HashSet<const jlm::rvsdg::output *> Outputs_;
+  StructuralNodeLiveness &
+  GetOrCreateLiveness(const jlm::rvsdg::node & node)
+  {
+    if (StructuralNodes_.Contains(node))
+    {
+      return StructuralNodes_.Lookup(node);
+    }
+
+    auto & liveness = StructuralNodes_[node];
+    liveness.Outputs.resize(node.noutputs(), false);
+    auto & structuralNode = *util::AssertedCast<const jlm::rvsdg::structural_node>(&node);
+    liveness.Arguments.resize(structuralNode.nsubregions());
+    for (size_t n = 0; n < structuralNode.nsubregions(); n++)
+    {
+      liveness.Arguments[n].resize(structuralNode.subregion(n)->narguments(), false);
+    }
+
+    return liveness;
+  }
+
+  std::vector<bool> SimpleNodes_;
+  std::vector<bool> RootArguments_;
+  rvsdg::NodeSideTable<StructuralNodeLiveness> StructuralNodes_;
+  std::vector<const jlm::rvsdg::output *> Worklist_;
 };
 
 /** \brief Dead Node Elimination statistics class
@@ -188,7 +312,7 @@ DeadNodeElimination::DeadNodeElimination() = default;
 void
 DeadNodeElimination::run(jlm::rvsdg::region & region)
 {
-  Context_ = Context::Create();
+  Context_ = Context::Create(*region.graph());
 
   MarkRegion(region);
   SweepRegion(region);
@@ -200,9 +324,9 @@ DeadNodeElimination::run(jlm::rvsdg::region & region)
 void
 DeadNodeElimination::run(RvsdgModule & module, jlm::util::StatisticsCollector & statisticsCollector)
 {
-  Context_ = Context::Create();
-
   auto & rvsdg = module.Rvsdg();
+  Context_ = Context::Create(rvsdg);
+
   auto statistics = Statistics::Create(module.SourceFileName());
   statistics->StartMarkStatistics(rvsdg);
   MarkRegion(*rvsdg.root());
@@ -218,23 +342,31 @@ DeadNodeElimination::run(RvsdgModule & module, jlm::util::StatisticsCollector &
   Context_.reset();
 }
 
+bool
+DeadNodeElimination::ReportsModifications() const noexcept
+{
+  // Dead node elimination only removes nodes and outputs
+  return true;
+}
+
 void
 DeadNodeElimination::MarkRegion(const jlm::rvsdg::region & region)
 {
   for (size_t n = 0; n < region.nresults(); n++)
   {
-    MarkOutput(*region.result(n)->origin());
+    Context_->PushOutput(*region.result(n)->origin());
+  }
+
+  while (auto output = Context_->PopOutput())
+  {
+    MarkOutput(*output);
   }
 }
 
 void
 DeadNodeElimination::MarkOutput(const jlm::rvsdg::output & output)
 {
-  if (Context_->IsAlive(output))
-  {
-    return;
-  }
-
+  JLM_ASSERT(!Context_->IsAlive(output));
   Context_->MarkAlive(output);
 
   if (is_import(&output))
@@ -244,33 +376,33 @@ DeadNodeElimination::MarkOutput(const jlm::rvsdg::output & output)
 
   if (auto gammaOutput = is_gamma_output(&output))
   {
-    MarkOutput(*gammaOutput->node()->predicate()->origin());
+    Context_->PushOutput(*gammaOutput->node()->predicate()->origin());
     for (const auto & result : gammaOutput->results)
     {
-      MarkOutput(*result.origin());
+      Context_->PushOutput(*result.origin());
     }
     return;
   }
 
   if (auto argument = is_gamma_argument(&output))
   {
-    MarkOutput(*argument->input()->origin());
+    Context_->PushOutput(*argument->input()->origin());
     return;
   }
 
   if (auto thetaOutput = is_theta_output(&output))
   {
-    MarkOutput(*thetaOutput->node()->predicate()->origin());
-    MarkOutput(*thetaOutput->result()->origin());
-    MarkOutput(*thetaOutput->input()->origin());
+    Context_->PushOutput(*thetaOutput->node()->predicate()->origin());
+    Context_->PushOutput(*thetaOutput->result()->origin());
+    Context_->PushOutput(*thetaOutput->input()->origin());
     return;
   }
 
   if (auto thetaArgument = is_theta_argument(&output))
   {
     auto thetaInput = util::AssertedCast<const jlm::rvsdg::theta_input>(thetaArgument->input());
-    MarkOutput(*thetaInput->output());
-    MarkOutput(*thetaInput->origin());
+    Context_->PushOutput(*thetaInput->output());
+    Context_->PushOutput(*thetaInput->origin());
     return;
   }
 
@@ -278,7 +410,7 @@ DeadNodeElimination::MarkOutput(const jlm::rvsdg::output & output)
   {
     for (auto & result : o->node()->fctresults())
     {
-      MarkOutput(*result.origin());
+      Context_->PushOutput(*result.origin());
     }
     return;
   }
@@ -290,14 +422,14 @@ DeadNodeElimination::MarkOutput(const jlm::rvsdg::output & output)
 
   if (auto cv = dynamic_cast<const lambda::cvargument *>(&output))
   {
-    MarkOutput(*cv->input()->origin());
+    Context_->PushOutput(*cv->input()->origin());
     return;
   }
 
   if (is_phi_output(&output))
   {
     auto structuralOutput = util::AssertedCast<const jlm::rvsdg::structural_output>(&output);
-    MarkOutput(*structuralOutput->results.first()->origin());
+    Context_->PushOutput(*structuralOutput->results.first()->origin());
     return;
   }
 
@@ -306,24 +438,24 @@ DeadNodeElimination::MarkOutput(const jlm::rvsdg::output & output)
     auto argument = util::AssertedCast<const jlm::rvsdg::argument>(&output);
     if (argument->input())
     {
-      MarkOutput(*argument->input()->origin());
+      Context_->PushOutput(*argument->input()->origin());
     }
     else
     {
-      MarkOutput(*argument->region()->result(argument->index())->origin());
+      Context_->PushOutput(*argument->region()->result(argument->index())->origin());
     }
     return;
   }
 
   if (auto deltaOutput = dynamic_cast<const delta::output *>(&output))
   {
-    MarkOutput(*deltaOutput->node()->subregion()->result(0)->origin());
+    Context_->PushOutput(*deltaOutput->node()->subregion()->result(0)->origin());
     return;
   }
 
   if (auto deltaCvArgument = dynamic_cast<const delta::cvargument *>(&output))
   {
-    MarkOutput(*deltaCvArgument->input()->origin());
+    Context_->PushOutput(*deltaCvArgument->input()->origin());
     return;
   }
 
@@ -332,7 +464,7 @@ DeadNodeElimination::MarkOutput(const jlm::rvsdg::output & output)
     auto node = simpleOutput->node();
     for (size_t n = 0; n < node->ninputs(); n++)
     {
-      MarkOutput(*node->input(n)->origin());
+      Context_->PushOutput(*node->input(n)->origin());
     }
     return;
   }
@@ -507,7 +639,7 @@ DeadNodeElimination::SweepLambda(lambda::node & lambdaNode) const
 void
 DeadNodeElimination::SweepPhi(phi::node & phiNode) const
 {
-  util::HashSet<const rvsdg::argument *> deadRecursionArguments;
+  std::vector<bool> deadRecursionArguments(phiNode.subregion()->narguments(), false);
 
   auto isDeadOutput = [&](const phi::rvoutput & output)
   {
@@ -517,7 +649,7 @@ DeadNodeElimination::SweepPhi(phi::node & phiNode) const
     auto isDead = !Context_->IsAlive(output) && !Context_->IsAlive(*argument);
     if (isDead)
     {
-      deadRecursionArguments.Insert(argument);
+      deadRecursionArguments[argument->index()] = true;
     }
 
     return isDead;
@@ -536,7 +668,7 @@ DeadNodeElimination::SweepPhi(phi::node & phiNode) const
 
     // Only remove the recursion argument if its output was removed in isDeadOutput()
     JLM_ASSERT(is<phi::rvargument>(&argument));
-    return deadRecursionArguments.Contains(&argument);
+    return static_cast<bool>(deadRecursionArguments[argument.index()]);
   };
   phiNode.RemovePhiArgumentsWhere(isDeadArgument);
 }
@@ -550,4 +682,271 @@ DeadNodeElimination::SweepDelta(delta::node & deltaNode)
   deltaNode.PruneDeltaInputs();
 }
 
+/** \brief Worklist of the incremental Dead Node Elimination
+ *
+ * Keeps track of the nodes that might have become dead. A node is only contained once in the
+ * worklist, and nodes that are removed from the graph are also removed from the worklist.
+ */
+class DeadNodeWorklist final
+{
+public:
+  void
+  Push(jlm::rvsdg::node & node)
+  {
+    if (Nodes_.Insert(&node))
+    {
+      Worklist_.push_back(&node);
+    }
+  }
+
+  /**
+   * Pushes the node that produces \p output. For the argument of a subregion, this is the
+   * structural node of the subregion. Nothing is pushed for the arguments of the root region.
+   */
+  void
+  PushProducer(const jlm::rvsdg::output & output)
+  {
+    if (auto node = jlm::rvsdg::node_output::node(&output))
+    {
+      Push(*node);
+    }
+    else if (auto node = output.region()->node())
+    {
+      Push(*node);
+    }
+  }
+
+  jlm::rvsdg::node *
+  Pop()
+  {
+    while (!Worklist_.empty())
+    {
+      auto node = Worklist_.back();
+      Worklist_.pop_back();
+      if (Nodes_.Remove(node))
+      {
+        return node;
+      }
+    }
+
+    return nullptr;
+  }
+
+  /**
+   * Removes \p node and all nodes in its subregions from the worklist.
+   */
+  void
+  Remove(const jlm::rvsdg::node & node)
+  {
+    Nodes_.Remove(const_cast<jlm::rvsdg::node *>(&node));
+
+    if (auto structuralNode = dynamic_cast<const jlm::rvsdg::structural_node *>(&node))
+    {
+      for (size_t r = 0; r < structuralNode->nsubregions(); r++)
+      {
+        for (auto & subregionNode : structuralNode->subregion(r)->nodes)
+        {
+          Remove(subregionNode);
+        }
+      }
+    }
+  }
+
+  [[nodiscard]] bool
+  IsEmpty() const noexcept
+  {
+    return Nodes_.Size() == 0;
+  }
+
+private:
+  util::HashSet<jlm::rvsdg::node *> Nodes_;
+  std::vector<jlm::rvsdg::node *> Worklist_;
+};
+
+static void
+PruneGamma(jlm::rvsdg::gamma_node & gammaNode, DeadNodeWorklist & worklist)
+{
+  // Remove dead outputs and results
+  for (size_t n = gammaNode.noutputs() - 1; n != static_cast<size_t>(-1); n--)
+  {
+    if (!gammaNode.output(n)->IsDead())
+    {
+      continue;
+    }
+
+    for (size_t r = 0; r < gammaNode.nsubregions(); r++)
+    {
+      worklist.PushProducer(*gammaNode.subregion(r)->result(n)->origin());
+      gammaNode.subregion(r)->RemoveResult(n);
+    }
+    gammaNode.RemoveOutput(n);
+  }
+
+  // Remove dead arguments and inputs
+  for (size_t n = gammaNode.ninputs() - 1; n >= 1; n--)
+  {
+    auto input = gammaNode.input(n);
+
+    bool isDead = true;
+    for (auto & argument : input->arguments)
+    {
+      if (!argument.IsDead())
+      {
+        isDead = false;
+        break;
+      }
+    }
+    if (isDead)
+    {
+      worklist.PushProducer(*input->origin());
+      for (size_t r = 0; r < gammaNode.nsubregions(); r++)
+      {
+        gammaNode.subregion(r)->RemoveArgument(n - 1);
+      }
+      gammaNode.RemoveInput(n);
+    }
+  }
+}
+
+static void
+PruneTheta(jlm::rvsdg::theta_node & thetaNode, DeadNodeWorklist & worklist)
+{
+  // A loop variable is dead iff its output is dead and its argument is either dead or only used by
+  // its own result
+  auto isDeadOutput = [&](const jlm::rvsdg::theta_output & output)
+  {
+    auto argument = output.argument();
+    auto isDead = argument->IsDead()
+               || (argument->nusers() == 1 && *argument->begin() == output.result());
+    if (isDead)
+    {
+      worklist.PushProducer(*output.result()->origin());
+    }
+
+    return isDead;
+  };
+  auto deadInputs = thetaNode.RemoveThetaOutputsWhere(isDeadOutput);
+
+  auto isDeadInput = [&](const jlm::rvsdg::theta_input & input)
+  {
+    if (!deadInputs.Contains(&input))
+    {
+      return false;
+    }
+
+    worklist.PushProducer(*input.origin());
+    return true;
+  };
+  thetaNode.RemoveThetaInputsWhere(isDeadInput);
+
+  JLM_ASSERT(thetaNode.ninputs() == thetaNode.noutputs());
+}
+
+static void
+PruneLambda(lambda::node & lambdaNode, DeadNodeWorklist & worklist)
+{
+  auto isDeadInput = [&](const lambda::cvinput & input)
+  {
+    worklist.PushProducer(*input.origin());
+    return true;
+  };
+  lambdaNode.RemoveLambdaInputsWhere(isDeadInput);
+}
+
+static void
+PrunePhi(phi::node & phiNode, DeadNodeWorklist & worklist)
+{
+  util::HashSet<const rvsdg::argument *> deadRecursionArguments;
+
+  auto isDeadOutput = [&](const phi::rvoutput & output)
+  {
+    auto argument = output.argument();
+
+    // A recursion variable is only dead iff its output AND argument are dead
+    if (!argument->IsDead())
+    {
+      return false;
+    }
+
+    worklist.PushProducer(*output.result()->origin());
+    deadRecursionArguments.Insert(argument);
+    return true;
+  };
+  phiNode.RemovePhiOutputsWhere(isDeadOutput);
+
+  auto isDeadArgument = [&](const rvsdg::argument & argument)
+  {
+    if (argument.input())
+    {
+      worklist.PushProducer(*argument.input()->origin());
+      return true;
+    }
+
+    // Only remove the recursion argument if its output was removed in isDeadOutput()
+    JLM_ASSERT(is<phi::rvargument>(&argument));
+    return deadRecursionArguments.Contains(&argument);
+  };
+  phiNode.RemovePhiArgumentsWhere(isDeadArgument);
+}
+
+static void
+PruneDelta(delta::node & deltaNode, DeadNodeWorklist & worklist)
+{
+  auto isDeadInput = [&](const delta::cvinput & input)
+  {
+    worklist.PushProducer(*input.origin());
+    return true;
+  };
+  deltaNode.RemoveDeltaInputsWhere(isDeadInput);
+}
+
+void
+DeadNodeElimination::RemoveDeadNodes(const std::vector<jlm::rvsdg::node *> & nodes)
+{
+  DeadNodeWorklist worklist;
+  for (auto node : nodes)
+  {
+    worklist.Push(*node);
+  }
+
+  while (auto node = worklist.Pop())
+  {
+    if (!node->has_users())
+    {
+      for (size_t n = 0; n < node->ninputs(); n++)
+      {
+        worklist.PushProducer(*node->input(n)->origin());
+      }
+
+      if (!worklist.IsEmpty())
+      {
+        worklist.Remove(*node);
+      }
+      remove(node);
+      continue;
+    }
+
+    if (auto gammaNode = dynamic_cast<jlm::rvsdg::gamma_node *>(node))
+    {
+      PruneGamma(*gammaNode, worklist);
+    }
+    else if (auto thetaNode = dynamic_cast<jlm::rvsdg::theta_node *>(node))
+    {
+      PruneTheta(*thetaNode, worklist);
+    }
+    else if (auto lambdaNode = dynamic_cast<lambda::node *>(node))
+    {
+      PruneLambda(*lambdaNode, worklist);
+    }
+    else if (auto phiNode = dynamic_cast<phi::node *>(node))
+    {
+      PrunePhi(*phiNode, worklist);
+    }
+    else if (auto deltaNode = dynamic_cast<delta::node *>(node))
+    {
+      PruneDelta(*deltaNode, worklist);
+    }
+  }
+}
+
 }
@@ -10,6 +10,8 @@
 #include <jlm/rvsdg/simple-node.hpp>
 #include <jlm/rvsdg/structural-node.hpp>
 
+#include <vector>
+
 namespace jlm::rvsdg
 {
 class gamma_node;
@@ -77,6 +79,30 @@ public:
   void
   run(RvsdgModule & module, jlm::util::StatisticsCollector & statisticsCollector) override;
 
+  [[nodiscard]] bool
+  ReportsModifications() const noexcept override;
+
+  /**
+   * Incrementally removes dead nodes, outputs, and inputs starting from \p nodes.
+   *
+   * In contrast to run(), this method does not mark the entire RVSDG. It only inspects the nodes in
+   * \p nodes, e.g., the nodes whose outputs lost users due to divert_users() or the removal of
+   * other nodes, and the nodes that are affected by their removal. A node without users is removed.
+   * Dead outputs and arguments of a structural node are pruned, i.e., gamma exit and entry
+   * variables, theta loop variables, phi recursion and context variables, as well as lambda and
+   * delta context variables. Every removed input or result makes the producer of its origin a
+   * candidate for removal. The removal therefore cascades through a region and across the
+   * boundaries of structural nodes.
+   *
+   * Values that are only kept alive by a cycle are not removed, e.g., a loop variable whose result
+   * is computed from its own argument, or a recursion variable that is only used within its own
+   * phi node. A full run() is necessary to remove them.
+   *
+   * @param nodes The nodes that might have become dead.
+   */
+  static void
+  RemoveDeadNodes(const std::vector<jlm::rvsdg::node *> & nodes);
+
 private:
   void
   MarkRegion(const jlm::rvsdg::region & region);
@@ -3,8 +3,10 @@
  * See COPYING for terms of redistribution.
  */
 
+#include <jlm/llvm/ir/operators/lambda.hpp>
 #include <jlm/llvm/ir/RvsdgModule.hpp>
 #include <jlm/llvm/opt/OptimizationSequence.hpp>
+#include <jlm/util/Parallel.hpp>
 #include <jlm/util/Statistics.hpp>
 #include <jlm/util/time.hpp>
 
@@ -66,6 +68,22 @@ private:
 
 OptimizationSequence::~OptimizationSequence() noexcept = default;
 
+void
+OptimizationSequence::RunOnFunctions(
+    RvsdgModule & rvsdgModule,
+    const std::vector<optimization *> & optimizations)
+{
+  auto lambdaNodes = lambda::CollectLambdaNodes(*rvsdgModule.Rvsdg().root());
+  util::ParallelForEach(
+      lambdaNodes,
+      NumJobs_,
+      [&](lambda::node * lambdaNode)
+      {
+        for (auto optimization : optimizations)
+          optimization->RunOnFunction(*lambdaNode);
+      });
+}
+
 void
 OptimizationSequence::run(
     RvsdgModule & rvsdgModule,
@@ -74,13 +92,45 @@ OptimizationSequence::run(
   auto statistics = Statistics::Create(rvsdgModule.SourceFileName());
   statistics->StartMeasuring(rvsdgModule.Rvsdg());
 
-  for (const auto & optimization : Optimizations_)
+  auto it = Optimizations_.begin();
+  while (it != Optimizations_.end())
   {
-    optimization->run(rvsdgModule, statisticsCollector);
+    if (NumJobs_ <= 1 || !(*it)->IsFunctionLocal())
+    {
+      (*it)->run(rvsdgModule, statisticsCollector);
+      if (!(*it)->ReportsModifications())
+        rvsdgModule.InvalidateAnalyses();
+
+      it++;
+      continue;
+    }
+
+    std::vector<optimization *> functionLocalOptimizations;
+    while (it != Optimizations_.end() && (*it)->IsFunctionLocal())
+      functionLocalOptimizations.push_back(*it++);
+
+    RunOnFunctions(rvsdgModule, functionLocalOptimizations);
+
+    // RunOnFunction() has no access to the module, so only optimizations that create no outputs
+    // keep the analyses valid.
+    for (auto optimization : functionLocalOptimizations)
+    {
+      if (!optimization->ReportsModifications())
+      {
+        rvsdgModule.InvalidateAnalyses();
+        break;
+      }
+    }
   }
 
   statistics->EndMeasuring(rvsdgModule.Rvsdg());
   statisticsCollector.CollectDemandedStatistics(std::move(statistics));
 }
 
+bool
+OptimizationSequence::ReportsModifications() const noexcept
+{
+  return true;
+}
+
 }
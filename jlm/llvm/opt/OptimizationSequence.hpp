@@ -13,6 +13,18 @@ namespace jlm::llvm
 
 /**
  * Sequentially applies a list of optimizations to an Rvsdg.
+ *
+ * If more than one job is requested, then maximal runs of consecutive function-local
+ * optimizations are applied to all lambda nodes of the module concurrently, where each lambda node
+ * is processed by a single thread at a time. The optimizations of a run are applied to a lambda
+ * node in the given order. As lambda nodes are processed independently from each other, the result
+ * is the same regardless of the number of jobs.
+ *
+ * The analyses of the module are invalidated after every optimization that does not report its
+ * modifications.
+ *
+ * \see optimization::IsFunctionLocal()
+ * \see optimization::ReportsModifications()
  */
 class OptimizationSequence final : public optimization
 {
@@ -21,24 +33,37 @@ public:
 
   ~OptimizationSequence() noexcept override;
 
-  explicit OptimizationSequence(std::vector<optimization *> optimizations)
-      : Optimizations_(std::move(optimizations))
+  explicit OptimizationSequence(std::vector<optimization *> optimizations, size_t numJobs = 1)
+      : NumJobs_(numJobs),
+        Optimizations_(std::move(optimizations))
   {}
 
   void
   run(RvsdgModule & rvsdgModule, util::StatisticsCollector & statisticsCollector) override;
 
+  [[nodiscard]] bool
+  ReportsModifications() const noexcept override;
+
   static void
   CreateAndRun(
       RvsdgModule & rvsdgModule,
       util::StatisticsCollector & statisticsCollector,
-      std::vector<optimization *> optimizations)
+      std::vector<optimization *> optimizations,
+      size_t numJobs = 1)
   {
-    OptimizationSequence sequentialApplication(std::move(optimizations));
+    OptimizationSequence sequentialApplication(std::move(optimizations), numJobs);
     sequentialApplication.run(rvsdgModule, statisticsCollector);
   }
 
 private:
+  /**
+   * Applies the function-local optimizations \p optimizations to all lambda nodes of \p
+   * rvsdgModule using NumJobs_ threads.
+   */
+  void
+  RunOnFunctions(RvsdgModule & rvsdgModule, const std::vector<optimization *> & optimizations);
+
+  size_t NumJobs_;
   std::vector<optimization *> Optimizations_;
 };
 
@@ -111,6 +111,9 @@ AgnosticMemoryNodeProvider::ProvisionMemoryNodes(
   for (auto & deltaNode : pointsToGraph.DeltaNodes())
     memoryNodes.Insert(&deltaNode);
 
+  for (auto & fieldNode : pointsToGraph.FieldNodes())
+    memoryNodes.Insert(&fieldNode);
+
   for (auto & lambdaNode : pointsToGraph.LambdaNodes())
     memoryNodes.Insert(&lambdaNode);
 
@@ -0,0 +1,931 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/llvm/ir/CallGraphIndex.hpp>
+#include <jlm/llvm/ir/operators.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/alias-analyses/Andersen.hpp>
+#include <jlm/llvm/opt/alias-analyses/PointsToGraph.hpp>
+#include <jlm/rvsdg/traverser.hpp>
+#include <jlm/util/Statistics.hpp>
+#include <jlm/util/time.hpp>
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace jlm::llvm::aa
+{
+
+/**
+ * Determines whether values of type \p type can carry pointers, and are therefore represented by
+ * register PointerObjects. Aggregates are handled field-insensitively, i.e., a single register
+ * PointerObject represents all pointers within the aggregate. Variadic argument lists are treated
+ * as aggregates of their arguments.
+ */
+static bool
+IsOrContainsPointerType(const jlm::rvsdg::type & type)
+{
+  return IsOrContains<PointerType>(type) || jlm::rvsdg::is<varargtype>(type);
+}
+
+static bool
+IsVaListAlloca(const jlm::rvsdg::valuetype & type)
+{
+  auto structType = dynamic_cast<const StructType *>(&type);
+
+  if (structType != nullptr && structType->GetName() == "struct.__va_list_tag")
+    return true;
+
+  if (structType != nullptr)
+  {
+    auto & declaration = structType->GetDeclaration();
+
+    for (size_t n = 0; n < declaration.nelements(); n++)
+    {
+      if (IsVaListAlloca(declaration.element(n)))
+        return true;
+    }
+  }
+
+  if (auto arrayType = dynamic_cast<const arraytype *>(&type))
+    return IsVaListAlloca(arrayType->element_type());
+
+  return false;
+}
+
+/** \brief Collect statistics about Andersen alias analysis pass
+ *
+ */
+class Andersen::Statistics final : public jlm::util::Statistics
+{
+public:
+  ~Statistics() override = default;
+
+  explicit Statistics(jlm::util::filepath sourceFile)
+      : jlm::util::Statistics(Statistics::Id::AndersenAnalysis),
+        NumRvsdgNodes_(0),
+        SourceFile_(std::move(sourceFile)),
+        NumPointerObjects_(0),
+        NumPointsToGraphNodes_(0),
+        NumMemoryNodes_(0),
+        NumRegisterNodes_(0),
+        NumUniqueRegisterNodes_(0),
+        NumEscapedMemoryNodes_(0)
+  {}
+
+  void
+  StartConstraintBuildingStatistics(const jlm::rvsdg::graph & graph) noexcept
+  {
+    NumRvsdgNodes_ = jlm::rvsdg::nnodes(graph.root());
+    ConstraintBuildingTimer_.start();
+  }
+
+  void
+  StopConstraintBuildingStatistics(const PointerObjectSet & set) noexcept
+  {
+    ConstraintBuildingTimer_.stop();
+    NumPointerObjects_ = set.NumPointerObjects();
+  }
+
+  void
+  StartConstraintSolvingStatistics() noexcept
+  {
+    ConstraintSolvingTimer_.start();
+  }
+
+  void
+  StopConstraintSolvingStatistics() noexcept
+  {
+    ConstraintSolvingTimer_.stop();
+  }
+
+  void
+  StartPointsToGraphConstructionStatistics() noexcept
+  {
+    PointsToGraphConstructionTimer_.start();
+  }
+
+  void
+  StopPointsToGraphConstructionStatistics(const PointsToGraph & pointsToGraph)
+  {
+    PointsToGraphConstructionTimer_.stop();
+    NumPointsToGraphNodes_ = pointsToGraph.NumNodes();
+    NumMemoryNodes_ = pointsToGraph.NumMemoryNodes();
+    NumRegisterNodes_ = pointsToGraph.NumRegisterNodes();
+    NumUniqueRegisterNodes_ = pointsToGraph.NumUniqueRegisterNodes();
+    NumEscapedMemoryNodes_ = pointsToGraph.GetEscapedMemoryNodes().Size();
+  }
+
+  [[nodiscard]] std::string
+  ToString() const override
+  {
+    return jlm::util::strfmt(
+        "AndersenAnalysis ",
+        SourceFile_.to_str(),
+        " ",
+        "#RvsdgNodes:",
+        NumRvsdgNodes_,
+        " ",
+        "#PointerObjects:",
+        NumPointerObjects_,
+        " ",
+        "#PointsToGraphNodes:",
+        NumPointsToGraphNodes_,
+        " ",
+        "#MemoryNodes:",
+        NumMemoryNodes_,
+        " ",
+        "#RegisterNodes:",
+        NumRegisterNodes_,
+        " ",
+        "#UniqueRegisterNodes:",
+        NumUniqueRegisterNodes_,
+        " ",
+        "#EscapedMemoryNodes:",
+        NumEscapedMemoryNodes_,
+        " ",
+        "ConstraintBuildingTime[ns]:",
+        ConstraintBuildingTimer_.ns(),
+        " ",
+        "ConstraintSolvingTime[ns]:",
+        ConstraintSolvingTimer_.ns(),
+        " ",
+        "PointsToGraphConstructionTime[ns]:",
+        PointsToGraphConstructionTimer_.ns());
+  }
+
+  static std::unique_ptr<Statistics>
+  Create(const jlm::util::filepath & sourceFile)
+  {
+    return std::make_unique<Statistics>(sourceFile);
+  }
+
+private:
+  size_t NumRvsdgNodes_;
+  jlm::util::filepath SourceFile_;
+
+  size_t NumPointerObjects_;
+
+  size_t NumPointsToGraphNodes_;
+  size_t NumMemoryNodes_;
+  size_t NumRegisterNodes_;
+  size_t NumUniqueRegisterNodes_;
+  size_t NumEscapedMemoryNodes_;
+
+  util::timer ConstraintBuildingTimer_;
+  util::timer ConstraintSolvingTimer_;
+  util::timer PointsToGraphConstructionTimer_;
+};
+
+Andersen::~Andersen() = default;
+
+Andersen::Andersen()
+    : CallGraphIndex_(nullptr)
+{}
+
+PointerObject::Index
+Andersen::GetRegister(const jlm::rvsdg::output & output) const
+{
+  auto & registerMap = Set_->GetRegisterMap();
+  JLM_ASSERT(registerMap.find(&output) != registerMap.end());
+  return registerMap.at(&output);
+}
+
+void
+Andersen::AnalyzeSimpleNode(const jlm::rvsdg::simple_node & node)
+{
+  if (is<alloca_op>(&node))
+    AnalyzeAlloca(node);
+  else if (is<malloc_op>(&node))
+    AnalyzeMalloc(node);
+  else if (is<LoadOperation>(&node))
+    AnalyzeLoad(*util::AssertedCast<const LoadNode>(&node));
+  else if (is<StoreOperation>(&node))
+    AnalyzeStore(*util::AssertedCast<const StoreNode>(&node));
+  else if (is<CallOperation>(&node))
+    AnalyzeCall(*util::AssertedCast<const CallNode>(&node));
+  else if (is<GetElementPtrOperation>(&node))
+    AnalyzeGep(node);
+  else if (is<bitcast_op>(&node))
+    AnalyzeBitcast(node);
+  else if (is<bits2ptr_op>(&node))
+    AnalyzeBits2ptr(node);
+  else if (is<ptr2bits_op>(&node))
+    AnalyzePtr2bits(node);
+  else if (is<ConstantPointerNullOperation>(&node))
+    AnalyzeConstantPointerNull(node);
+  else if (is<UndefValueOperation>(&node))
+    AnalyzeUndef(node);
+  else if (is<Memcpy>(&node))
+    AnalyzeMemcpy(node);
+  else if (is<ConstantArray>(&node))
+    AnalyzeConstantArray(node);
+  else if (is<ConstantStruct>(&node))
+    AnalyzeConstantStruct(node);
+  else if (is<ConstantAggregateZero>(&node))
+    AnalyzeConstantAggregateZero(node);
+  else if (is<ExtractValue>(&node))
+    AnalyzeExtractValue(node);
+  else if (is<valist_op>(&node))
+    AnalyzeValist(node);
+  else
+  {
+    // Ensure that we really took care of all pointer-producing instructions
+    for (size_t n = 0; n < node.noutputs(); n++)
+    {
+      if (IsOrContainsPointerType(node.output(n)->type()))
+        JLM_UNREACHABLE("We should have never reached this statement.");
+    }
+  }
+}
+
+void
+Andersen::AnalyzeAlloca(const jlm::rvsdg::simple_node & node)
+{
+  JLM_ASSERT(is<alloca_op>(&node));
+
+  auto outputRegister = Set_->CreateRegisterPointerObject(*node.output(0));
+  auto allocaMemoryObject = Set_->CreateAllocaMemoryObject(node);
+  Constraints_->AddPointerPointeeConstraint(outputRegister, allocaMemoryObject);
+
+  // FIXME: Steensgaard lets va_list allocas point to unknown memory. External memory is the
+  // closest we can represent.
+  auto & op = *util::AssertedCast<const alloca_op>(&node.operation());
+  if (IsVaListAlloca(op.value_type()))
+    Constraints_->AddPointsToExternalConstraint(allocaMemoryObject);
+}
+
+void
+Andersen::AnalyzeMalloc(const jlm::rvsdg::simple_node & node)
+{
+  JLM_ASSERT(is<malloc_op>(&node));
+
+  auto outputRegister = Set_->CreateRegisterPointerObject(*node.output(0));
+  auto mallocMemoryObject = Set_->CreateMallocMemoryObject(node);
+  Constraints_->AddPointerPointeeConstraint(outputRegister, mallocMemoryObject);
+}
+
+void
+Andersen::AnalyzeLoad(const LoadNode & loadNode)
+{
+  auto & value = *loadNode.GetValueOutput();
+  if (!IsOrContainsPointerType(value.type()))
+    return;
+
+  auto addressRegister = GetRegister(*loadNode.GetAddressInput()->origin());
+  auto valueRegister = Set_->CreateRegisterPointerObject(value);
+  Constraints_->AddConstraint(SupersetOfAllPointeesConstraint(valueRegister, addressRegister));
+}
+
+void
+Andersen::AnalyzeStore(const StoreNode & storeNode)
+{
+  auto & value = *storeNode.GetValueInput()->origin();
+  if (!IsOrContainsPointerType(value.type()))
+    return;
+
+  auto addressRegister = GetRegister(*storeNode.GetAddressInput()->origin());
+  auto valueRegister = GetRegister(value);
+  Constraints_->AddConstraint(AllPointeesPointToSupersetConstraint(addressRegister, valueRegister));
+}
+
+void
+Andersen::AnalyzeCall(const CallNode & callNode)
+{
+  auto callTypeClassifier = CallNode::ClassifyCall(callNode);
+  switch (callTypeClassifier->GetCallType())
+  {
+  case CallTypeClassifier::CallType::NonRecursiveDirectCall:
+  case CallTypeClassifier::CallType::RecursiveDirectCall:
+    // The arguments and results are connected to the callee once the traversal is done
+    for (size_t n = 0; n < callNode.NumResults(); n++)
+    {
+      auto & callResult = *callNode.Result(n);
+      if (IsOrContainsPointerType(callResult.type()))
+        Set_->CreateRegisterPointerObject(callResult);
+    }
+    DirectCalls_.push_back(&callNode);
+    break;
+  case CallTypeClassifier::CallType::ExternalCall:
+  case CallTypeClassifier::CallType::IndirectCall:
+    // The callee is either outside the module, or a function that is not only called directly.
+    // The arguments of the latter point to external, and its results escape (see AnalyzeLambda).
+    for (size_t n = 0; n < callNode.NumArguments(); n++)
+    {
+      auto & callArgument = *callNode.Argument(n)->origin();
+      if (IsOrContainsPointerType(callArgument.type()))
+        Constraints_->AddRegisterContentEscapedConstraint(GetRegister(callArgument));
+    }
+
+    for (size_t n = 0; n < callNode.NumResults(); n++)
+    {
+      auto & callResult = *callNode.Result(n);
+      if (IsOrContainsPointerType(callResult.type()))
+      {
+        auto resultRegister = Set_->CreateRegisterPointerObject(callResult);
+        Constraints_->AddPointsToExternalConstraint(resultRegister);
+      }
+    }
+    break;
+  default:
+    JLM_UNREACHABLE("Unhandled call type.");
+  }
+}
+
+void
+Andersen::AnalyzeDirectCall(const CallNode & callNode, const lambda::node & lambdaNode)
+{
+  JLM_ASSERT(lambdaNode.nfctarguments() == callNode.NumArguments());
+  for (size_t n = 0; n < callNode.NumArguments(); n++)
+  {
+    auto & callArgument = *callNode.Argument(n)->origin();
+    auto & lambdaArgument = *lambdaNode.fctargument(n);
+
+    if (!IsOrContainsPointerType(callArgument.type()))
+      continue;
+
+    // FIXME: The content of variadic arguments is only accessible through va_list allocas, which
+    // point to external. Let it escape until va_list allocas are handled properly.
+    if (jlm::rvsdg::is<varargtype>(callArgument.type()))
+    {
+      Constraints_->AddRegisterContentEscapedConstraint(GetRegister(callArgument));
+      continue;
+    }
+
+    Constraints_->AddConstraint(
+        SupersetConstraint(GetRegister(lambdaArgument), GetRegister(callArgument)));
+  }
+
+  auto subregion = lambdaNode.subregion();
+  JLM_ASSERT(subregion->nresults() == callNode.NumResults());
+  for (size_t n = 0; n < callNode.NumResults(); n++)
+  {
+    auto & callResult = *callNode.Result(n);
+    auto & lambdaResult = *subregion->result(n)->origin();
+
+    if (!IsOrContainsPointerType(callResult.type()))
+      continue;
+
+    Constraints_->AddConstraint(
+        SupersetConstraint(GetRegister(callResult), GetRegister(lambdaResult)));
+  }
+}
+
+void
+Andersen::AnalyzeGep(const jlm::rvsdg::simple_node & node)
+{
+  JLM_ASSERT(is<GetElementPtrOperation>(&node));
+
+  // The analysis is field-insensitive, so the result points to the same memory as the base
+  auto baseRegister = GetRegister(*node.input(0)->origin());
+  Set_->MapRegisterToExistingPointerObject(*node.output(0), baseRegister);
+}
+
+void
+Andersen::AnalyzeBitcast(const jlm::rvsdg::simple_node & node)
+{
+  JLM_ASSERT(is<bitcast_op>(&node));
+
+  auto & operand = *node.input(0)->origin();
+  auto & result = *node.output(0);
+
+  if (IsOrContainsPointerType(operand.type()))
+  {
+    Set_->MapRegisterToExistingPointerObject(result, GetRegister(operand));
+  }
+  else if (IsOrContainsPointerType(result.type()))
+  {
+    // The pointer is created from a non-pointer value, see AnalyzeBits2ptr()
+    auto resultRegister = Set_->CreateRegisterPointerObject(result);
+    Constraints_->AddPointsToExternalConstraint(resultRegister);
+  }
+}
+
+void
+Andersen::AnalyzeBits2ptr(const jlm::rvsdg::simple_node & node)
+{
+  JLM_ASSERT(is<bits2ptr_op>(&node));
+
+  // Every pointer converted to an integer escapes (see AnalyzePtr2bits()), so the result can only
+  // point to external or escaped memory.
+  auto resultRegister = Set_->CreateRegisterPointerObject(*node.output(0));
+  Constraints_->AddPointsToExternalConstraint(resultRegister);
+}
+
+void
+Andersen::AnalyzePtr2bits(const jlm::rvsdg::simple_node & node)
+{
+  JLM_ASSERT(is<ptr2bits_op>(&node));
+
+  auto operandRegister = GetRegister(*node.input(0)->origin());
+  Constraints_->AddRegisterContentEscapedConstraint(operandRegister);
+}
+
+void
+Andersen::AnalyzeConstantPointerNull(const jlm::rvsdg::simple_node & node)
+{
+  JLM_ASSERT(is<ConstantPointerNullOperation>(&node));
+
+  // ConstantPointerNull cannot point to any memory location. We therefore only create a register
+  // for it, but let it not point to anything.
+  Set_->CreateRegisterPointerObject(*node.output(0));
+}
+
+void
+Andersen::AnalyzeUndef(const jlm::rvsdg::simple_node & node)
+{
+  JLM_ASSERT(is<UndefValueOperation>(&node));
+  auto & output = *node.output(0);
+
+  if (!IsOrContainsPointerType(output.type()))
+    return;
+
+  // UndefValue cannot point to any memory location. We therefore only create a register for it,
+  // but let it not point to anything.
+  Set_->CreateRegisterPointerObject(output);
+}
+
+void
+Andersen::AnalyzeMemcpy(const jlm::rvsdg::simple_node & node)
+{
+  JLM_ASSERT(is<Memcpy>(&node));
+
+  auto destinationRegister = GetRegister(*node.input(0)->origin());
+  auto sourceRegister = GetRegister(*node.input(1)->origin());
+
+  // The copied memory content is modeled as a load from the source followed by a store to the
+  // destination
+  auto contentRegister = Set_->CreateDummyRegisterPointerObject();
+  Constraints_->AddConstraint(SupersetOfAllPointeesConstraint(contentRegister, sourceRegister));
+  Constraints_->AddConstraint(
+      AllPointeesPointToSupersetConstraint(destinationRegister, contentRegister));
+}
+
+void
+Andersen::AnalyzeConstantArray(const jlm::rvsdg::simple_node & node)
+{
+  JLM_ASSERT(is<ConstantArray>(&node));
+  auto & output = *node.output(0);
+
+  if (!IsOrContainsPointerType(output.type()))
+    return;
+
+  auto outputRegister = Set_->CreateRegisterPointerObject(output);
+  for (size_t n = 0; n < node.ninputs(); n++)
+  {
+    auto & origin = *node.input(n)->origin();
+    Constraints_->AddConstraint(SupersetConstraint(outputRegister, GetRegister(origin)));
+  }
+}
+
+void
+Andersen::AnalyzeConstantStruct(const jlm::rvsdg::simple_node & node)
+{
+  JLM_ASSERT(is<ConstantStruct>(&node));
+  auto & output = *node.output(0);
+
+  if (!IsOrContainsPointerType(output.type()))
+    return;
+
+  auto outputRegister = Set_->CreateRegisterPointerObject(output);
+  for (size_t n = 0; n < node.ninputs(); n++)
+  {
+    auto & origin = *node.input(n)->origin();
+    if (IsOrContainsPointerType(origin.type()))
+      Constraints_->AddConstraint(SupersetConstraint(outputRegister, GetRegister(origin)));
+  }
+}
+
+void
+Andersen::AnalyzeConstantAggregateZero(const jlm::rvsdg::simple_node & node)
+{
+  JLM_ASSERT(is<ConstantAggregateZero>(&node));
+  auto & output = *node.output(0);
+
+  if (!IsOrContainsPointerType(output.type()))
+    return;
+
+  // ConstantAggregateZero cannot point to any memory location. We therefore only create a
+  // register for it, but let it not point to anything.
+  Set_->CreateRegisterPointerObject(output);
+}
+
+void
+Andersen::AnalyzeExtractValue(const jlm::rvsdg::simple_node & node)
+{
+  JLM_ASSERT(is<ExtractValue>(&node));
+
+  auto & result = *node.output(0);
+  if (!IsOrContainsPointerType(result.type()))
+    return;
+
+  // The analysis is field-insensitive, so the result points to everything the aggregate points to
+  auto aggregateRegister = GetRegister(*node.input(0)->origin());
+  Set_->MapRegisterToExistingPointerObject(result, aggregateRegister);
+}
+
+void
+Andersen::AnalyzeValist(const jlm::rvsdg::simple_node & node)
+{
+  JLM_ASSERT(is<valist_op>(&node));
+
+  auto outputRegister = Set_->CreateRegisterPointerObject(*node.output(0));
+  for (size_t n = 0; n < node.ninputs(); n++)
+  {
+    auto & origin = *node.input(n)->origin();
+    if (IsOrContainsPointerType(origin.type()))
+      Constraints_->AddConstraint(SupersetConstraint(outputRegister, GetRegister(origin)));
+  }
+}
+
+void
+Andersen::AnalyzeLambda(const lambda::node & lambda)
+{
+  // Handle context variables
+  for (auto & cv : lambda.ctxvars())
+  {
+    if (!IsOrContainsPointerType(cv.type()))
+      continue;
+
+    Set_->MapRegisterToExistingPointerObject(*cv.argument(), GetRegister(*cv.origin()));
+  }
+
+  // Handle function arguments. Functions that are exported or have other users than direct calls
+  // can be invoked with arguments that we know nothing about.
+  auto hasOnlyDirectCalls = CallGraphIndex_
+                              ? CallGraphIndex_->GetCallSummary(lambda).HasOnlyDirectCalls()
+                              : lambda.ComputeCallSummary()->HasOnlyDirectCalls();
+  for (auto & argument : lambda.fctarguments())
+  {
+    if (!IsOrContainsPointerType(argument.type()))
+      continue;
+
+    auto argumentRegister = Set_->CreateRegisterPointerObject(argument);
+    if (!hasOnlyDirectCalls)
+      Constraints_->AddPointsToExternalConstraint(argumentRegister);
+  }
+
+  AnalyzeRegion(*lambda.subregion());
+
+  // Handle function results. They escape if the function can be invoked from unknown callers.
+  if (!hasOnlyDirectCalls)
+  {
+    for (auto & result : lambda.fctresults())
+    {
+      if (IsOrContainsPointerType(result.type()))
+        Constraints_->AddRegisterContentEscapedConstraint(GetRegister(*result.origin()));
+    }
+  }
+
+  // Handle function
+  auto outputRegister = Set_->CreateRegisterPointerObject(*lambda.output());
+  auto functionMemoryObject = Set_->CreateFunctionMemoryObject(lambda);
+  Constraints_->AddPointerPointeeConstraint(outputRegister, functionMemoryObject);
+}
+
+void
+Andersen::AnalyzeDelta(const delta::node & delta)
+{
+  // Handle context variables
+  for (auto & input : delta.ctxvars())
+  {
+    if (!IsOrContainsPointerType(input.type()))
+      continue;
+
+    Set_->MapRegisterToExistingPointerObject(
+        *input.arguments.first(),
+        GetRegister(*input.origin()));
+  }
+
+  AnalyzeRegion(*delta.subregion());
+
+  auto outputRegister = Set_->CreateRegisterPointerObject(*delta.output());
+  auto globalMemoryObject = Set_->CreateGlobalMemoryObject(delta);
+  Constraints_->AddPointerPointeeConstraint(outputRegister, globalMemoryObject);
+
+  // The global variable is initialized with the result of the delta
+  auto & origin = *delta.result()->origin();
+  if (IsOrContainsPointerType(origin.type()))
+    Constraints_->AddConstraint(SupersetConstraint(globalMemoryObject, GetRegister(origin)));
+}
+
+void
+Andersen::AnalyzePhi(const phi::node & phi)
+{
+  // Handle context variables
+  for (auto cv = phi.begin_cv(); cv != phi.end_cv(); cv++)
+  {
+    if (!IsOrContainsPointerType(cv->type()))
+      continue;
+
+    Set_->MapRegisterToExistingPointerObject(*cv->argument(), GetRegister(*cv->origin()));
+  }
+
+  // Handle recursion variable arguments
+  for (auto rv = phi.begin_rv(); rv != phi.end_rv(); rv++)
+  {
+    if (!IsOrContainsPointerType(rv->type()))
+      continue;
+
+    Set_->CreateRegisterPointerObject(*rv->argument());
+  }
+
+  AnalyzeRegion(*phi.subregion());
+
+  // Handle recursion variable outputs
+  for (auto rv = phi.begin_rv(); rv != phi.end_rv(); rv++)
+  {
+    if (!IsOrContainsPointerType(rv->type()))
+      continue;
+
+    auto argumentRegister = GetRegister(*rv->argument());
+    auto & origin = *rv->result()->origin();
+    Constraints_->AddConstraint(SupersetConstraint(argumentRegister, GetRegister(origin)));
+    Set_->MapRegisterToExistingPointerObject(*rv.output(), argumentRegister);
+  }
+}
+
+void
+Andersen::AnalyzeGamma(const jlm::rvsdg::gamma_node & node)
+{
+  // Handle entry variables
+  for (auto ev = node.begin_entryvar(); ev != node.end_entryvar(); ev++)
+  {
+    if (!IsOrContainsPointerType(ev->type()))
+      continue;
+
+    auto originRegister = GetRegister(*ev->origin());
+    for (auto & argument : *ev)
+      Set_->MapRegisterToExistingPointerObject(argument, originRegister);
+  }
+
+  // Handle subregions
+  for (size_t n = 0; n < node.nsubregions(); n++)
+    AnalyzeRegion(*node.subregion(n));
+
+  // Handle exit variables
+  for (auto ex = node.begin_exitvar(); ex != node.end_exitvar(); ex++)
+  {
+    if (!IsOrContainsPointerType(ex->type()))
+      continue;
+
+    auto outputRegister = Set_->CreateRegisterPointerObject(*ex.output());
+    for (auto & result : *ex)
+    {
+      auto & origin = *result.origin();
+      Constraints_->AddConstraint(SupersetConstraint(outputRegister, GetRegister(origin)));
+    }
+  }
+}
+
+void
+Andersen::AnalyzeTheta(const jlm::rvsdg::theta_node & theta)
+{
+  // Handle loop variable arguments. They hold the value of the input in the first iteration.
+  for (auto thetaOutput : theta)
+  {
+    if (!IsOrContainsPointerType(thetaOutput->type()))
+      continue;
+
+    auto argumentRegister = Set_->CreateRegisterPointerObject(*thetaOutput->argument());
+    auto & origin = *thetaOutput->input()->origin();
+    Constraints_->AddConstraint(SupersetConstraint(argumentRegister, GetRegister(origin)));
+  }
+
+  AnalyzeRegion(*theta.subregion());
+
+  // Handle loop variable results. They flow into the arguments of the next iteration, and the
+  // output holds the value of any of the iterations.
+  for (auto thetaOutput : theta)
+  {
+    if (!IsOrContainsPointerType(thetaOutput->type()))
+      continue;
+
+    auto argumentRegister = GetRegister(*thetaOutput->argument());
+    auto & origin = *thetaOutput->result()->origin();
+    Constraints_->AddConstraint(SupersetConstraint(argumentRegister, GetRegister(origin)));
+    Set_->MapRegisterToExistingPointerObject(*thetaOutput, argumentRegister);
+  }
+}
+
+void
+Andersen::AnalyzeStructuralNode(const jlm::rvsdg::structural_node & node)
+{
+  if (auto lambdaNode = dynamic_cast<const lambda::node *>(&node))
+    AnalyzeLambda(*lambdaNode);
+  else if (auto deltaNode = dynamic_cast<const delta::node *>(&node))
+    AnalyzeDelta(*deltaNode);
+  else if (auto gammaNode = dynamic_cast<const rvsdg::gamma_node *>(&node))
+    AnalyzeGamma(*gammaNode);
+  else if (auto thetaNode = dynamic_cast<const rvsdg::theta_node *>(&node))
+    AnalyzeTheta(*thetaNode);
+  else if (auto phiNode = dynamic_cast<const phi::node *>(&node))
+    AnalyzePhi(*phiNode);
+  else
+    JLM_UNREACHABLE("Unhandled structural node type.");
+}
+
+void
+Andersen::AnalyzeRegion(jlm::rvsdg::region & region)
+{
+  using namespace jlm::rvsdg;
+
+  topdown_traverser traverser(&region);
+  for (auto & node : traverser)
+  {
+    if (auto simpleNode = dynamic_cast<const simple_node *>(node))
+    {
+      AnalyzeSimpleNode(*simpleNode);
+      continue;
+    }
+
+    AnalyzeStructuralNode(*util::AssertedCast<const structural_node>(node));
+  }
+}
+
+void
+Andersen::AnalyzeRvsdg(const jlm::rvsdg::graph & graph)
+{
+  auto & rootRegion = *graph.root();
+
+  // Handle imports
+  for (size_t n = 0; n < rootRegion.narguments(); n++)
+  {
+    auto & argument = *rootRegion.argument(n);
+    if (!jlm::rvsdg::is<PointerType>(argument.type()))
+      continue;
+
+    auto importRegister = Set_->CreateRegisterPointerObject(argument);
+    auto importMemoryObject = Set_->CreateImportMemoryObject(argument);
+    Constraints_->AddPointerPointeeConstraint(importRegister, importMemoryObject);
+  }
+
+  AnalyzeRegion(rootRegion);
+
+  // Handle direct calls
+  for (auto callNode : DirectCalls_)
+  {
+    auto callTypeClassifier = CallNode::ClassifyCall(*callNode);
+    AnalyzeDirectCall(*callNode, *callTypeClassifier->GetLambdaOutput().node());
+  }
+
+  // Handle exports
+  for (size_t n = 0; n < rootRegion.nresults(); n++)
+  {
+    auto & origin = *rootRegion.result(n)->origin();
+    if (IsOrContainsPointerType(origin.type()))
+      Constraints_->AddRegisterContentEscapedConstraint(GetRegister(origin));
+  }
+}
+
+std::unique_ptr<PointsToGraph>
+Andersen::Analyze(const RvsdgModule & rvsdgModule)
+{
+  util::StatisticsCollector statisticsCollector;
+  return Analyze(rvsdgModule, statisticsCollector);
+}
+
+std::unique_ptr<PointsToGraph>
+Andersen::Analyze(const RvsdgModule & module, jlm::util::StatisticsCollector & statisticsCollector)
+{
+  Set_ = std::make_unique<PointerObjectSet>();
+  Constraints_ = std::make_unique<PointerObjectConstraintSet>(*Set_);
+  CallGraphIndex_ = module.GetObserver<CallGraphIndex>();
+  auto statistics = Statistics::Create(module.SourceFileName());
+
+  statistics->StartConstraintBuildingStatistics(module.Rvsdg());
+  AnalyzeRvsdg(module.Rvsdg());
+  statistics->StopConstraintBuildingStatistics(*Set_);
+
+  statistics->StartConstraintSolvingStatistics();
+  Constraints_->Solve();
+  statistics->StopConstraintSolvingStatistics();
+
+  statistics->StartPointsToGraphConstructionStatistics();
+  auto pointsToGraph = ConstructPointsToGraphFromPointerObjectSet(*Set_);
+  statistics->StopPointsToGraphConstructionStatistics(*pointsToGraph);
+
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+
+  // Discard internal state to free up memory after we are done with the analysis
+  Constraints_.reset();
+  Set_.reset();
+  DirectCalls_.clear();
+  CallGraphIndex_ = nullptr;
+
+  return pointsToGraph;
+}
+
+std::unique_ptr<PointsToGraph>
+Andersen::ConstructPointsToGraphFromPointerObjectSet(const PointerObjectSet & set)
+{
+  auto pointsToGraph = PointsToGraph::Create();
+
+  // Create the memory nodes
+  std::vector<PointsToGraph::MemoryNode *> memoryNodes(set.NumPointerObjects(), nullptr);
+  for (auto [allocaNode, index] : set.GetAllocaMap())
+    memoryNodes[index] = &PointsToGraph::AllocaNode::Create(*pointsToGraph, *allocaNode);
+
+  for (auto [mallocNode, index] : set.GetMallocMap())
+    memoryNodes[index] = &PointsToGraph::MallocNode::Create(*pointsToGraph, *mallocNode);
+
+  for (auto [deltaNode, index] : set.GetGlobalMap())
+    memoryNodes[index] = &PointsToGraph::DeltaNode::Create(*pointsToGraph, *deltaNode);
+
+  for (auto [lambdaNode, index] : set.GetFunctionMap())
+    memoryNodes[index] = &PointsToGraph::LambdaNode::Create(*pointsToGraph, *lambdaNode);
+
+  for (auto [argument, index] : set.GetImportMap())
+    memoryNodes[index] = &PointsToGraph::ImportNode::Create(*pointsToGraph, *argument);
+
+  // External memory can point to all escaped memory
+  auto & externalMemoryNode = pointsToGraph->GetExternalMemoryNode();
+  std::vector<PointsToGraph::MemoryNode *> escapedMemoryNodes;
+  for (PointerObject::Index index = 0; index < set.NumPointerObjects(); index++)
+  {
+    if (memoryNodes[index] != nullptr && set.GetPointerObject(index).HasEscaped())
+    {
+      memoryNodes[index]->MarkAsModuleEscaping();
+      externalMemoryNode.AddEdge(*memoryNodes[index]);
+      escapedMemoryNodes.push_back(memoryNodes[index]);
+    }
+  }
+
+  auto addEdges = [&](PointsToGraph::Node & node, PointerObject::Index index)
+  {
+    for (auto pointee : set.GetPointsToSet(index).Items())
+      node.AddEdge(*memoryNodes[pointee]);
+
+    if (set.GetPointerObject(index).PointsToExternal())
+      node.AddEdge(externalMemoryNode);
+  };
+
+  // Create the edges of the memory nodes. Memory nodes reach the escaped memory nodes through the
+  // external memory node, as every escaped memory node would otherwise get an edge to all others.
+  for (PointerObject::Index index = 0; index < set.NumPointerObjects(); index++)
+  {
+    if (memoryNodes[index] != nullptr)
+      addEdges(*memoryNodes[index], index);
+  }
+
+  // Create the register nodes and their edges. Registers with equal points-to sets share a single
+  // register node, which is identified by the representative pointer object of the registers.
+  auto hashPointsToSet = [&](PointerObject::Index index)
+  {
+    size_t hash = set.GetPointerObject(index).PointsToExternal();
+    for (auto pointee : set.GetPointsToSet(index).Items())
+      hash = hash * 31 + pointee;
+    return hash;
+  };
+
+  auto isEqualPointsToSet = [&](PointerObject::Index index1, PointerObject::Index index2)
+  {
+    return set.GetPointerObject(index1).PointsToExternal()
+            == set.GetPointerObject(index2).PointsToExternal()
+        && set.GetPointsToSet(index1) == set.GetPointsToSet(index2);
+  };
+
+  std::vector<std::pair<PointerObject::Index, util::HashSet<const rvsdg::output *>>> registers;
+  std::unordered_multimap<size_t, size_t> registersByHash;
+  for (auto [output, index] : set.GetRegisterMap())
+  {
+    auto hash = hashPointsToSet(index);
+    auto [begin, end] = registersByHash.equal_range(hash);
+    auto it = std::find_if(
+        begin,
+        end,
+        [&](const auto & entry)
+        {
+          return isEqualPointsToSet(registers[entry.second].first, index);
+        });
+
+    if (it != end)
+    {
+      registers[it->second].second.Insert(output);
+      continue;
+    }
+
+    registersByHash.emplace(hash, registers.size());
+    registers.push_back({ index, util::HashSet<const rvsdg::output *>({ output }) });
+  }
+
+  // The memory node providers only consult the targets of register nodes, so registers that point
+  // to external get explicit edges to all escaped memory nodes.
+  for (auto & [index, outputs] : registers)
+  {
+    auto & registerNode = PointsToGraph::RegisterNode::Create(*pointsToGraph, std::move(outputs));
+    addEdges(registerNode, index);
+
+    if (set.GetPointerObject(index).PointsToExternal())
+    {
+      for (auto escapedMemoryNode : escapedMemoryNodes)
+        registerNode.AddEdge(*escapedMemoryNode);
+    }
+  }
+
+  return pointsToGraph;
+}
+
+}
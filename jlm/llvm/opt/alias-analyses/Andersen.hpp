@@ -0,0 +1,186 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_LLVM_OPT_ALIAS_ANALYSES_ANDERSEN_HPP
+#define JLM_LLVM_OPT_ALIAS_ANALYSES_ANDERSEN_HPP
+
+#include <jlm/llvm/ir/operators.hpp>
+#include <jlm/llvm/opt/alias-analyses/AliasAnalysis.hpp>
+#include <jlm/llvm/opt/alias-analyses/PointerObjectSet.hpp>
+
+#include <vector>
+
+namespace jlm::llvm
+{
+class CallGraphIndex;
+}
+
+namespace jlm::llvm::aa
+{
+
+/** \brief Andersen alias analysis
+ *
+ * This class implements an inclusion-based, flow-insensitive, and field-insensitive alias
+ * analysis. Every RVSDG output that can hold a pointer is represented by a register
+ * PointerObject, and every alloca, malloc, delta, lambda, and import by a memory PointerObject.
+ * The analysis traverses the RVSDG once and emits a constraint for every pointer-related
+ * operation into a PointerObjectConstraintSet. The solution of the constraints is then converted
+ * to a PointsToGraph.
+ *
+ * Unlike Steensgaard, the analysis does not merge the points-to sets of values that flow into each
+ * other, which results in considerably smaller points-to sets.
+ *
+ * @see PointerObjectSet
+ * @see PointerObjectConstraintSet
+ */
+class Andersen final : public AliasAnalysis
+{
+  class Statistics;
+
+public:
+  ~Andersen() override;
+
+  Andersen();
+
+  Andersen(const Andersen &) = delete;
+
+  Andersen(Andersen &&) = delete;
+
+  Andersen &
+  operator=(const Andersen &) = delete;
+
+  Andersen &
+  operator=(Andersen &&) = delete;
+
+  std::unique_ptr<PointsToGraph>
+  Analyze(const RvsdgModule & module, jlm::util::StatisticsCollector & statisticsCollector)
+      override;
+
+  /**
+   * \brief Analyze RVSDG module without collecting statistics.
+   *
+   * @param rvsdgModule RVSDG module the analysis is performed on.
+   *
+   * @return A PointsTo graph.
+   */
+  std::unique_ptr<PointsToGraph>
+  Analyze(const RvsdgModule & rvsdgModule);
+
+  /**
+   * Converts the solution of the constraints in \p set to a PointsToGraph. Memory objects and
+   * registers that point to external get an edge to the external memory node, which in turn has an
+   * edge to all memory nodes of escaped memory objects. Registers that point to external also get
+   * a direct edge to all memory nodes of escaped memory objects.
+   *
+   * @param set The PointerObjectSet with solved points-to sets.
+   *
+   * @return A PointsTo graph.
+   */
+  static std::unique_ptr<PointsToGraph>
+  ConstructPointsToGraphFromPointerObjectSet(const PointerObjectSet & set);
+
+private:
+  void
+  AnalyzeRvsdg(const jlm::rvsdg::graph & graph);
+
+  void
+  AnalyzeRegion(jlm::rvsdg::region & region);
+
+  void
+  AnalyzeLambda(const lambda::node & node);
+
+  void
+  AnalyzeDelta(const delta::node & node);
+
+  void
+  AnalyzePhi(const phi::node & node);
+
+  void
+  AnalyzeGamma(const jlm::rvsdg::gamma_node & node);
+
+  void
+  AnalyzeTheta(const jlm::rvsdg::theta_node & node);
+
+  void
+  AnalyzeSimpleNode(const jlm::rvsdg::simple_node & node);
+
+  void
+  AnalyzeStructuralNode(const jlm::rvsdg::structural_node & node);
+
+  void
+  AnalyzeAlloca(const jlm::rvsdg::simple_node & node);
+
+  void
+  AnalyzeMalloc(const jlm::rvsdg::simple_node & node);
+
+  void
+  AnalyzeLoad(const LoadNode & loadNode);
+
+  void
+  AnalyzeStore(const StoreNode & storeNode);
+
+  void
+  AnalyzeCall(const CallNode & callNode);
+
+  void
+  AnalyzeDirectCall(const CallNode & callNode, const lambda::node & lambdaNode);
+
+  void
+  AnalyzeGep(const jlm::rvsdg::simple_node & node);
+
+  void
+  AnalyzeBitcast(const jlm::rvsdg::simple_node & node);
+
+  void
+  AnalyzeBits2ptr(const jlm::rvsdg::simple_node & node);
+
+  void
+  AnalyzePtr2bits(const jlm::rvsdg::simple_node & node);
+
+  void
+  AnalyzeConstantPointerNull(const jlm::rvsdg::simple_node & node);
+
+  void
+  AnalyzeUndef(const jlm::rvsdg::simple_node & node);
+
+  void
+  AnalyzeMemcpy(const jlm::rvsdg::simple_node & node);
+
+  void
+  AnalyzeConstantArray(const jlm::rvsdg::simple_node & node);
+
+  void
+  AnalyzeConstantStruct(const jlm::rvsdg::simple_node & node);
+
+  void
+  AnalyzeConstantAggregateZero(const jlm::rvsdg::simple_node & node);
+
+  void
+  AnalyzeExtractValue(const jlm::rvsdg::simple_node & node);
+
+  void
+  AnalyzeValist(const jlm::rvsdg::simple_node & node);
+
+  /**
+   * @return The register PointerObject of the rvsdg \p output. The output must already have been
+   * visited by the analysis.
+   */
+  [[nodiscard]] PointerObject::Index
+  GetRegister(const jlm::rvsdg::output & output) const;
+
+  std::unique_ptr<PointerObjectSet> Set_;
+  std::unique_ptr<PointerObjectConstraintSet> Constraints_;
+
+  // Direct calls are connected to their callee after the traversal, as the results of the callee
+  // are not yet visited for recursive calls.
+  std::vector<const CallNode *> DirectCalls_;
+
+  // The call graph index of the analyzed module, or nullptr if the module has none
+  CallGraphIndex * CallGraphIndex_;
+};
+
+}
+
+#endif
@@ -0,0 +1,539 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/llvm/ir/operators.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/alias-analyses/MemoryNodeCoarsener.hpp>
+#include <jlm/llvm/opt/alias-analyses/MemoryNodeProvisioning.hpp>
+#include <jlm/util/Statistics.hpp>
+#include <jlm/util/time.hpp>
+
+#include <unordered_map>
+#include <vector>
+
+namespace jlm::llvm::aa
+{
+
+using MemoryNodeSet = util::HashSet<const PointsToGraph::MemoryNode *>;
+using RepresentativeMap =
+    std::unordered_map<const PointsToGraph::MemoryNode *, const PointsToGraph::MemoryNode *>;
+
+/** \brief Partition of memory nodes
+ *
+ * The partition starts out with a single class that contains all memory nodes, and is refined with
+ * memory node sets. A refinement with a memory node set splits every class that is only partially
+ * contained in the set. After all refinements, every refinement set is a union of classes.
+ */
+class MemoryNodePartition final
+{
+public:
+  explicit MemoryNodePartition(const MemoryNodeSet & memoryNodes)
+  {
+    ClassSizes_.push_back(memoryNodes.Size());
+    for (auto & memoryNode : memoryNodes.Items())
+      ClassIds_[memoryNode] = 0;
+  }
+
+  void
+  Refine(const MemoryNodeSet & memoryNodes)
+  {
+    std::unordered_map<size_t, std::vector<const PointsToGraph::MemoryNode *>> splitClasses;
+    for (auto & memoryNode : memoryNodes.Items())
+    {
+      JLM_ASSERT(ClassIds_.find(memoryNode) != ClassIds_.end());
+      splitClasses[ClassIds_[memoryNode]].push_back(memoryNode);
+    }
+
+    for (auto & [classId, memoryNodesInSet] : splitClasses)
+    {
+      if (memoryNodesInSet.size() == ClassSizes_[classId])
+        continue;
+
+      auto newClassId = ClassSizes_.size();
+      ClassSizes_.push_back(memoryNodesInSet.size());
+      ClassSizes_[classId] -= memoryNodesInSet.size();
+      for (auto & memoryNode : memoryNodesInSet)
+        ClassIds_[memoryNode] = newClassId;
+    }
+  }
+
+  [[nodiscard]] size_t
+  NumClasses() const noexcept
+  {
+    return ClassSizes_.size();
+  }
+
+  /**
+   * @return A map from every memory node of the partition to the representative of its class.
+   */
+  [[nodiscard]] RepresentativeMap
+  GetRepresentatives() const
+  {
+    std::vector<const PointsToGraph::MemoryNode *> classRepresentatives(
+        ClassSizes_.size(),
+        nullptr);
+
+    RepresentativeMap representatives;
+    for (auto & [memoryNode, classId] : ClassIds_)
+    {
+      if (classRepresentatives[classId] == nullptr)
+        classRepresentatives[classId] = memoryNode;
+
+      representatives[memoryNode] = classRepresentatives[classId];
+    }
+
+    return representatives;
+  }
+
+private:
+  std::unordered_map<const PointsToGraph::MemoryNode *, size_t> ClassIds_;
+  std::vector<size_t> ClassSizes_;
+};
+
+/** \brief The memory node sets of a seed provisioning that are used within a lambda node
+ *
+ * The region and call memory node sets are referenced in the seed provisioning and not copied.
+ */
+class LambdaMemoryNodeSets final
+{
+public:
+  LambdaMemoryNodeSets(
+      const lambda::node & lambdaNode,
+      const MemoryNodeProvisioning & seedProvisioning)
+      : SeedProvisioning_(seedProvisioning)
+  {
+    CollectRegion(*lambdaNode.subregion());
+  }
+
+  LambdaMemoryNodeSets(const LambdaMemoryNodeSets &) = delete;
+
+  LambdaMemoryNodeSets &
+  operator=(const LambdaMemoryNodeSets &) = delete;
+
+  /**
+   * @return The union of all memory node sets.
+   */
+  [[nodiscard]] MemoryNodeSet
+  GetMemoryNodes() const
+  {
+    MemoryNodeSet memoryNodes;
+    ForEachSet(
+        [&](const MemoryNodeSet & memoryNodeSet)
+        {
+          memoryNodes.UnionWith(memoryNodeSet);
+        });
+
+    return memoryNodes;
+  }
+
+  template<typename F>
+  void
+  ForEachSet(const F & f) const
+  {
+    for (auto & [region, memoryNodes] : RegionEntryNodes_)
+      f(*memoryNodes);
+    for (auto & [region, memoryNodes] : RegionExitNodes_)
+      f(*memoryNodes);
+    for (auto & [callNode, memoryNodes] : CallEntryNodes_)
+      f(*memoryNodes);
+    for (auto & [callNode, memoryNodes] : CallExitNodes_)
+      f(*memoryNodes);
+    for (auto & [output, memoryNodes] : OutputNodes_)
+      f(memoryNodes);
+    for (auto & memoryNodes : AllocatedNodes_)
+      f(memoryNodes);
+  }
+
+  std::unordered_map<const jlm::rvsdg::region *, const MemoryNodeSet *> RegionEntryNodes_;
+  std::unordered_map<const jlm::rvsdg::region *, const MemoryNodeSet *> RegionExitNodes_;
+  std::unordered_map<const CallNode *, const MemoryNodeSet *> CallEntryNodes_;
+  std::unordered_map<const CallNode *, const MemoryNodeSet *> CallExitNodes_;
+  std::unordered_map<const jlm::rvsdg::output *, MemoryNodeSet> OutputNodes_;
+  std::vector<MemoryNodeSet> AllocatedNodes_;
+
+private:
+  void
+  CollectRegion(const jlm::rvsdg::region & region)
+  {
+    RegionEntryNodes_[&region] = &SeedProvisioning_.GetRegionEntryNodes(region);
+    RegionExitNodes_[&region] = &SeedProvisioning_.GetRegionExitNodes(region);
+
+    for (auto & node : region.nodes)
+    {
+      if (auto structuralNode = dynamic_cast<const jlm::rvsdg::structural_node *>(&node))
+      {
+        for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+          CollectRegion(*structuralNode->subregion(n));
+      }
+      else if (auto callNode = dynamic_cast<const CallNode *>(&node))
+      {
+        CallEntryNodes_[callNode] = &SeedProvisioning_.GetCallEntryNodes(*callNode);
+        CallExitNodes_[callNode] = &SeedProvisioning_.GetCallExitNodes(*callNode);
+      }
+      else if (auto loadNode = dynamic_cast<const LoadNode *>(&node))
+      {
+        CollectOutput(*loadNode->GetAddressInput()->origin());
+      }
+      else if (auto storeNode = dynamic_cast<const StoreNode *>(&node))
+      {
+        CollectOutput(*storeNode->GetAddressInput()->origin());
+      }
+      else if (jlm::rvsdg::is<free_op>(&node))
+      {
+        CollectOutput(*node.input(0)->origin());
+      }
+      else if (jlm::rvsdg::is<Memcpy>(&node))
+      {
+        CollectOutput(*node.input(0)->origin());
+        CollectOutput(*node.input(1)->origin());
+      }
+      else if (jlm::rvsdg::is<alloca_op>(&node))
+      {
+        auto simpleNode = util::AssertedCast<const jlm::rvsdg::simple_node>(&node);
+        auto & pointsToGraph = SeedProvisioning_.GetPointsToGraph();
+        CollectAllocatedNode(pointsToGraph.GetAllocaNode(*simpleNode));
+      }
+      else if (jlm::rvsdg::is<malloc_op>(&node))
+      {
+        auto simpleNode = util::AssertedCast<const jlm::rvsdg::simple_node>(&node);
+        auto & pointsToGraph = SeedProvisioning_.GetPointsToGraph();
+        CollectAllocatedNode(pointsToGraph.GetMallocNode(*simpleNode));
+      }
+    }
+  }
+
+  void
+  CollectAllocatedNode(const PointsToGraph::MemoryNode & memoryNode)
+  {
+    // The state of the memory node and its fields is replaced by the allocation, and they can
+    // therefore neither be grouped with other memory nodes nor with each other.
+    AllocatedNodes_.push_back({ &memoryNode });
+    for (auto & fieldNode : SeedProvisioning_.GetPointsToGraph().GetFieldNodes(memoryNode))
+      AllocatedNodes_.push_back({ &fieldNode });
+  }
+
+  void
+  CollectOutput(const jlm::rvsdg::output & output)
+  {
+    if (OutputNodes_.find(&output) == OutputNodes_.end())
+      OutputNodes_[&output] = SeedProvisioning_.GetOutputNodes(output);
+  }
+
+  const MemoryNodeProvisioning & SeedProvisioning_;
+};
+
+/** \brief Memory node provisioning of the MemoryNodeCoarsener
+ *
+ * The provisioning only holds the memory node sets of the coarsened lambda nodes. The memory node
+ * sets of all other lambda nodes are delegated to the seed provisioning.
+ */
+class CoarsenedMemoryNodeProvisioning final : public MemoryNodeProvisioning
+{
+public:
+  ~CoarsenedMemoryNodeProvisioning() noexcept override = default;
+
+  explicit CoarsenedMemoryNodeProvisioning(const MemoryNodeProvisioning & seedProvisioning)
+      : SeedProvisioning_(seedProvisioning)
+  {}
+
+  CoarsenedMemoryNodeProvisioning(const CoarsenedMemoryNodeProvisioning &) = delete;
+
+  CoarsenedMemoryNodeProvisioning(CoarsenedMemoryNodeProvisioning &&) = delete;
+
+  CoarsenedMemoryNodeProvisioning &
+  operator=(const CoarsenedMemoryNodeProvisioning &) = delete;
+
+  CoarsenedMemoryNodeProvisioning &
+  operator=(CoarsenedMemoryNodeProvisioning &&) = delete;
+
+  [[nodiscard]] const PointsToGraph &
+  GetPointsToGraph() const noexcept override
+  {
+    return SeedProvisioning_.GetPointsToGraph();
+  }
+
+  [[nodiscard]] const MemoryNodeSet &
+  GetRegionEntryNodes(const jlm::rvsdg::region & region) const override
+  {
+    if (auto it = RegionEntryNodes_.find(&region); it != RegionEntryNodes_.end())
+      return it->second;
+
+    return SeedProvisioning_.GetRegionEntryNodes(region);
+  }
+
+  [[nodiscard]] const MemoryNodeSet &
+  GetRegionExitNodes(const jlm::rvsdg::region & region) const override
+  {
+    if (auto it = RegionExitNodes_.find(&region); it != RegionExitNodes_.end())
+      return it->second;
+
+    return SeedProvisioning_.GetRegionExitNodes(region);
+  }
+
+  [[nodiscard]] const MemoryNodeSet &
+  GetCallEntryNodes(const CallNode & callNode) const override
+  {
+    if (auto it = CallEntryNodes_.find(&callNode); it != CallEntryNodes_.end())
+      return it->second;
+
+    return SeedProvisioning_.GetCallEntryNodes(callNode);
+  }
+
+  [[nodiscard]] const MemoryNodeSet &
+  GetCallExitNodes(const CallNode & callNode) const override
+  {
+    if (auto it = CallExitNodes_.find(&callNode); it != CallExitNodes_.end())
+      return it->second;
+
+    return SeedProvisioning_.GetCallExitNodes(callNode);
+  }
+
+  [[nodiscard]] MemoryNodeSet
+  GetOutputNodes(const jlm::rvsdg::output & output) const override
+  {
+    JLM_ASSERT(is<PointerType>(output.type()));
+
+    if (auto it = OutputNodes_.find(&output); it != OutputNodes_.end())
+      return it->second;
+
+    // The output is not used as an address within a coarsened lambda node. Map its memory nodes
+    // to the representatives of its lambda node, if the lambda node was coarsened.
+    auto memoryNodes = SeedProvisioning_.GetOutputNodes(output);
+
+    auto lambdaNode = GetLambdaNode(output);
+    if (lambdaNode == nullptr || Representatives_.find(lambdaNode) == Representatives_.end())
+      return memoryNodes;
+
+    return MapMemoryNodes(memoryNodes, Representatives_.at(lambdaNode));
+  }
+
+  void
+  AddLambda(
+      const lambda::node & lambdaNode,
+      const LambdaMemoryNodeSets & memoryNodeSets,
+      RepresentativeMap representatives)
+  {
+    for (auto & [region, memoryNodes] : memoryNodeSets.RegionEntryNodes_)
+      RegionEntryNodes_[region] = MapMemoryNodes(*memoryNodes, representatives);
+    for (auto & [region, memoryNodes] : memoryNodeSets.RegionExitNodes_)
+      RegionExitNodes_[region] = MapMemoryNodes(*memoryNodes, representatives);
+    for (auto & [callNode, memoryNodes] : memoryNodeSets.CallEntryNodes_)
+      CallEntryNodes_[callNode] = MapMemoryNodes(*memoryNodes, representatives);
+    for (auto & [callNode, memoryNodes] : memoryNodeSets.CallExitNodes_)
+      CallExitNodes_[callNode] = MapMemoryNodes(*memoryNodes, representatives);
+    for (auto & [output, memoryNodes] : memoryNodeSets.OutputNodes_)
+      OutputNodes_[output] = MapMemoryNodes(memoryNodes, representatives);
+
+    Representatives_[&lambdaNode] = std::move(representatives);
+  }
+
+  static MemoryNodeSet
+  MapMemoryNodes(const MemoryNodeSet & memoryNodes, const RepresentativeMap & representatives)
+  {
+    MemoryNodeSet mappedMemoryNodes;
+    for (auto & memoryNode : memoryNodes.Items())
+    {
+      auto it = representatives.find(memoryNode);
+      mappedMemoryNodes.Insert(it != representatives.end() ? it->second : memoryNode);
+    }
+
+    return mappedMemoryNodes;
+  }
+
+private:
+  static const lambda::node *
+  GetLambdaNode(const jlm::rvsdg::output & output)
+  {
+    auto region = output.region();
+    while (!region->IsRootRegion())
+    {
+      if (auto lambdaNode = dynamic_cast<const lambda::node *>(region->node()))
+        return lambdaNode;
+
+      region = region->node()->region();
+    }
+
+    return nullptr;
+  }
+
+  const MemoryNodeProvisioning & SeedProvisioning_;
+  std::unordered_map<const jlm::rvsdg::region *, MemoryNodeSet> RegionEntryNodes_;
+  std::unordered_map<const jlm::rvsdg::region *, MemoryNodeSet> RegionExitNodes_;
+  std::unordered_map<const CallNode *, MemoryNodeSet> CallEntryNodes_;
+  std::unordered_map<const CallNode *, MemoryNodeSet> CallExitNodes_;
+  std::unordered_map<const jlm::rvsdg::output *, MemoryNodeSet> OutputNodes_;
+  std::unordered_map<const lambda::node *, RepresentativeMap> Representatives_;
+};
+
+/** \brief Memory node coarsener statistics
+ *
+ * The statistics collected when running the memory node coarsener.
+ *
+ * @see MemoryNodeCoarsener
+ */
+class MemoryNodeCoarsener::Statistics final : public util::Statistics
+{
+public:
+  ~Statistics() override = default;
+
+  Statistics(util::filepath sourceFile, size_t budget)
+      : util::Statistics(Statistics::Id::MemoryNodeProvisioning),
+        SourceFile_(std::move(sourceFile)),
+        Budget_(budget),
+        NumLambdaNodes_(0),
+        NumCoarsenedLambdaNodes_(0),
+        NumMemoryNodes_(0),
+        NumCoarsenedMemoryNodes_(0)
+  {}
+
+  void
+  Start() noexcept
+  {
+    Timer_.start();
+  }
+
+  void
+  Stop() noexcept
+  {
+    Timer_.stop();
+  }
+
+  void
+  AddLambda(size_t numMemoryNodes) noexcept
+  {
+    NumLambdaNodes_++;
+    NumMemoryNodes_ += numMemoryNodes;
+    NumCoarsenedMemoryNodes_ += numMemoryNodes;
+  }
+
+  void
+  AddCoarsenedLambda(size_t numMemoryNodes, size_t numCoarsenedMemoryNodes) noexcept
+  {
+    NumLambdaNodes_++;
+    NumCoarsenedLambdaNodes_++;
+    NumMemoryNodes_ += numMemoryNodes;
+    NumCoarsenedMemoryNodes_ += numCoarsenedMemoryNodes;
+  }
+
+  [[nodiscard]] std::string
+  ToString() const override
+  {
+    return util::strfmt(
+        "MemoryNodeCoarsener ",
+        SourceFile_.to_str(),
+        " ",
+        "Budget:",
+        Budget_,
+        " ",
+        "#LambdaNodes:",
+        NumLambdaNodes_,
+        " ",
+        "#CoarsenedLambdaNodes:",
+        NumCoarsenedLambdaNodes_,
+        " ",
+        "#MemoryNodes:",
+        NumMemoryNodes_,
+        " ",
+        "#CoarsenedMemoryNodes:",
+        NumCoarsenedMemoryNodes_,
+        " ",
+        "Time[ns]:",
+        Timer_.ns());
+  }
+
+  static std::unique_ptr<Statistics>
+  Create(const util::filepath & sourceFile, size_t budget)
+  {
+    return std::make_unique<Statistics>(sourceFile, budget);
+  }
+
+private:
+  util::filepath SourceFile_;
+  size_t Budget_;
+  size_t NumLambdaNodes_;
+  size_t NumCoarsenedLambdaNodes_;
+  size_t NumMemoryNodes_;
+  size_t NumCoarsenedMemoryNodes_;
+  util::timer Timer_;
+};
+
+static void
+CoarsenRegion(
+    const jlm::rvsdg::region & region,
+    const MemoryNodeProvisioning & seedProvisioning,
+    size_t budget,
+    CoarsenedMemoryNodeProvisioning & provisioning,
+    MemoryNodeCoarsener::Statistics & statistics)
+{
+  for (auto & node : region.nodes)
+  {
+    if (auto phiNode = dynamic_cast<const phi::node *>(&node))
+    {
+      CoarsenRegion(*phiNode->subregion(), seedProvisioning, budget, provisioning, statistics);
+    }
+    else if (auto lambdaNode = dynamic_cast<const lambda::node *>(&node))
+    {
+      LambdaMemoryNodeSets memoryNodeSets(*lambdaNode, seedProvisioning);
+
+      auto memoryNodes = memoryNodeSets.GetMemoryNodes();
+      if (memoryNodes.Size() <= budget)
+      {
+        statistics.AddLambda(memoryNodes.Size());
+        continue;
+      }
+
+      MemoryNodePartition partition(memoryNodes);
+      memoryNodeSets.ForEachSet(
+          [&](const MemoryNodeSet & memoryNodeSet)
+          {
+            partition.Refine(memoryNodeSet);
+          });
+
+      statistics.AddCoarsenedLambda(memoryNodes.Size(), partition.NumClasses());
+      provisioning.AddLambda(*lambdaNode, memoryNodeSets, partition.GetRepresentatives());
+    }
+  }
+}
+
+MemoryNodeCoarsener::~MemoryNodeCoarsener() noexcept = default;
+
+MemoryNodeCoarsener::MemoryNodeCoarsener()
+    : MemoryNodeCoarsener(DefaultBudget)
+{}
+
+MemoryNodeCoarsener::MemoryNodeCoarsener(size_t budget)
+    : Budget_(budget)
+{}
+
+std::unique_ptr<MemoryNodeProvisioning>
+MemoryNodeCoarsener::EliminateMemoryNodes(
+    const RvsdgModule & rvsdgModule,
+    const MemoryNodeProvisioning & seedProvisioning,
+    jlm::util::StatisticsCollector & statisticsCollector)
+{
+  auto statistics = Statistics::Create(rvsdgModule.SourceFileName(), Budget_);
+  auto provisioning = std::make_unique<CoarsenedMemoryNodeProvisioning>(seedProvisioning);
+
+  statistics->Start();
+  CoarsenRegion(*rvsdgModule.Rvsdg().root(), seedProvisioning, Budget_, *provisioning, *statistics);
+  statistics->Stop();
+
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+
+  return provisioning;
+}
+
+std::unique_ptr<MemoryNodeProvisioning>
+MemoryNodeCoarsener::Create(
+    const RvsdgModule & rvsdgModule,
+    const MemoryNodeProvisioning & seedProvisioning,
+    size_t budget,
+    jlm::util::StatisticsCollector & statisticsCollector)
+{
+  MemoryNodeCoarsener coarsener(budget);
+  return coarsener.EliminateMemoryNodes(rvsdgModule, seedProvisioning, statisticsCollector);
+}
+
+}
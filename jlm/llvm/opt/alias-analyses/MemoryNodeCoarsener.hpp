@@ -0,0 +1,112 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_LLVM_OPT_ALIAS_ANALYSES_MEMORYNODECOARSENER_HPP
+#define JLM_LLVM_OPT_ALIAS_ANALYSES_MEMORYNODECOARSENER_HPP
+
+#include <jlm/llvm/opt/alias-analyses/MemoryNodeEliminator.hpp>
+
+#include <cstddef>
+
+namespace jlm::llvm::aa
+{
+
+/** \brief Coarsens the memory nodes of a MemoryNodeProvisioning
+ *
+ * The MemoryStateEncoder routes one memory state edge per memory node through every lambda, call,
+ * gamma, and theta node. The memory node coarsener bounds the number of these edges by grouping
+ * all memory nodes of a lambda node that are never distinguished within it. Two memory nodes are
+ * distinguished if one of them is provided for a region, call, load, store, free, or memcpy of the
+ * lambda node, but the other one is not, or if one of them is an alloca or malloc node of the
+ * lambda node or a field node of such a node. Each group of memory nodes is then replaced by a
+ * single representative memory node, and therefore only a single state edge is routed for the
+ * entire group.
+ *
+ * As all memory nodes of a group are referenced by the exact same operations of a lambda node, the
+ * coarsening does not introduce any additional dependencies between memory operations. However,
+ * computing the groups requires time proportional to the sum of the sizes of all memory node sets
+ * in a lambda node. The coarsener therefore only groups the memory nodes of lambda nodes that
+ * reference more memory nodes than a given budget. The memory node sets of all other lambda nodes
+ * are taken from the seed provisioning, which must outlive the coarsened provisioning.
+ *
+ * @see MemoryNodeEliminator
+ * @see MemoryStateEncoder
+ */
+class MemoryNodeCoarsener final : public MemoryNodeEliminator
+{
+public:
+  class Statistics;
+
+  static constexpr size_t DefaultBudget = 64;
+
+  ~MemoryNodeCoarsener() noexcept override;
+
+  MemoryNodeCoarsener();
+
+  /**
+   * @param budget The maximal number of memory nodes a lambda node can reference before its memory
+   * nodes are coarsened.
+   */
+  explicit MemoryNodeCoarsener(size_t budget);
+
+  MemoryNodeCoarsener(const MemoryNodeCoarsener &) = delete;
+
+  MemoryNodeCoarsener(MemoryNodeCoarsener &&) = delete;
+
+  MemoryNodeCoarsener &
+  operator=(const MemoryNodeCoarsener &) = delete;
+
+  MemoryNodeCoarsener &
+  operator=(MemoryNodeCoarsener &&) = delete;
+
+  [[nodiscard]] size_t
+  GetBudget() const noexcept
+  {
+    return Budget_;
+  }
+
+  /**
+   * Coarsens the memory nodes of all lambda nodes that reference more memory nodes than the
+   * budget.
+   *
+   * @param rvsdgModule The RVSDG module from which the seedProvisioning was computed from.
+   * @param seedProvisioning A provisioning from which memory nodes will be coarsened. It must
+   * outlive the returned provisioning.
+   * @param statisticsCollector The statistics collector for collecting pass statistics.
+   *
+   * @return A new instance of MemoryNodeProvisioning.
+   */
+  std::unique_ptr<MemoryNodeProvisioning>
+  EliminateMemoryNodes(
+      const RvsdgModule & rvsdgModule,
+      const MemoryNodeProvisioning & seedProvisioning,
+      jlm::util::StatisticsCollector & statisticsCollector) override;
+
+  /**
+   * Creates a MemoryNodeCoarsener and calls the EliminateMemoryNodes() method.
+   *
+   * @param rvsdgModule The RVSDG module from which the seedProvisioning was computed from.
+   * @param seedProvisioning A provisioning from which memory nodes will be coarsened. It must
+   * outlive the returned provisioning.
+   * @param budget The maximal number of memory nodes a lambda node can reference before its memory
+   * nodes are coarsened.
+   * @param statisticsCollector The statistics collector for collecting pass statistics.
+   *
+   * @return A new instance of MemoryNodeProvisioning.
+   */
+  static std::unique_ptr<MemoryNodeProvisioning>
+  Create(
+      const RvsdgModule & rvsdgModule,
+      const MemoryNodeProvisioning & seedProvisioning,
+      size_t budget,
+      jlm::util::StatisticsCollector & statisticsCollector);
+
+private:
+  size_t Budget_;
+};
+
+}
+
+#endif // JLM_LLVM_OPT_ALIAS_ANALYSES_MEMORYNODECOARSENER_HPP
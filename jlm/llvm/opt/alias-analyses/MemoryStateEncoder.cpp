@@ -26,6 +26,7 @@ public:
   explicit EncodingStatistics(jlm::util::filepath sourceFile)
       : Statistics(Statistics::Id::BasicEncoderEncoding),
         NumNodesBefore_(0),
+        NumMemoryStateEdges_(0),
         SourceFile_(std::move(sourceFile))
   {}
 
@@ -42,6 +43,43 @@ public:
     Timer_.stop();
   }
 
+  /**
+   * Counts the memory state edges of the encoded \p graph. The graph should be free of dead nodes.
+   */
+  void
+  CountMemoryStateEdges(const jlm::rvsdg::graph & graph)
+  {
+    std::function<size_t(const jlm::rvsdg::region &)> countEdges =
+        [&](const jlm::rvsdg::region & region)
+    {
+      size_t numEdges = 0;
+      for (size_t n = 0; n < region.nresults(); n++)
+      {
+        if (is<MemoryStateType>(region.result(n)->type()))
+          numEdges++;
+      }
+
+      for (auto & node : region.nodes)
+      {
+        for (size_t n = 0; n < node.ninputs(); n++)
+        {
+          if (is<MemoryStateType>(node.input(n)->type()))
+            numEdges++;
+        }
+
+        if (auto structuralNode = dynamic_cast<const jlm::rvsdg::structural_node *>(&node))
+        {
+          for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+            numEdges += countEdges(*structuralNode->subregion(n));
+        }
+      }
+
+      return numEdges;
+    };
+
+    NumMemoryStateEdges_ = countEdges(*graph.root());
+  }
+
   [[nodiscard]] std::string
   ToString() const override
   {
@@ -52,6 +90,9 @@ public:
         "#RvsdgNodes:",
         NumNodesBefore_,
         " ",
+        "#MemoryStateEdges:",
+        NumMemoryStateEdges_,
+        " ",
         "Time[ns]:",
         Timer_.ns());
   }
@@ -65,6 +106,7 @@ public:
 private:
   jlm::util::timer Timer_;
   size_t NumNodesBefore_;
+  size_t NumMemoryStateEdges_;
   jlm::util::filepath SourceFile_;
 };
 
@@ -413,9 +455,10 @@ private:
 class MemoryStateEncoder::Context final
 {
 public:
-  explicit Context(const MemoryNodeProvisioning & provisioning)
+  Context(RvsdgModule & rvsdgModule, const MemoryNodeProvisioning & provisioning)
       : RegionalizedStateMap_(provisioning),
-        Provisioning_(provisioning)
+        Provisioning_(provisioning),
+        RvsdgModule_(rvsdgModule)
   {}
 
   Context(const Context &) = delete;
@@ -440,15 +483,22 @@ public:
     return Provisioning_;
   }
 
+  RvsdgModule &
+  GetRvsdgModule() const noexcept
+  {
+    return RvsdgModule_;
+  }
+
   static std::unique_ptr<MemoryStateEncoder::Context>
-  Create(const MemoryNodeProvisioning & provisioning)
+  Create(RvsdgModule & rvsdgModule, const MemoryNodeProvisioning & provisioning)
   {
-    return std::make_unique<Context>(provisioning);
+    return std::make_unique<Context>(rvsdgModule, provisioning);
   }
 
 private:
   RegionalizedStateMap RegionalizedStateMap_;
   const MemoryNodeProvisioning & Provisioning_;
+  RvsdgModule & RvsdgModule_;
 };
 
 MemoryStateEncoder::~MemoryStateEncoder() noexcept = default;
@@ -461,21 +511,24 @@ MemoryStateEncoder::Encode(
     const MemoryNodeProvisioning & provisioning,
     jlm::util::StatisticsCollector & statisticsCollector)
 {
-  Context_ = Context::Create(provisioning);
+  Context_ = Context::Create(rvsdgModule, provisioning);
   auto statistics = EncodingStatistics::Create(rvsdgModule.SourceFileName());
 
   statistics->Start(rvsdgModule.Rvsdg());
   EncodeRegion(*rvsdgModule.Rvsdg().root());
   statistics->Stop();
 
-  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
-
   // Discard internal state to free up memory after we are done with the encoding
   Context_.reset();
 
   // Remove all nodes that became dead throughout the encoding.
   DeadNodeElimination deadNodeElimination;
   deadNodeElimination.run(rvsdgModule, statisticsCollector);
+
+  if (statisticsCollector.IsDemanded(*statistics))
+    statistics->CountMemoryStateEdges(rvsdgModule.Rvsdg());
+
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
 }
 
 void
@@ -591,10 +644,17 @@ MemoryStateEncoder::EncodeAlloca(const jlm::rvsdg::simple_node & allocaNode)
   JLM_ASSERT(is<alloca_op>(&allocaNode));
   auto & stateMap = Context_->GetRegionalizedStateMap();
 
-  auto & allocaMemoryNode =
-      Context_->GetMemoryNodeProvisioning().GetPointsToGraph().GetAllocaNode(allocaNode);
+  auto & pointsToGraph = Context_->GetMemoryNodeProvisioning().GetPointsToGraph();
+  auto & allocaMemoryNode = pointsToGraph.GetAllocaNode(allocaNode);
   auto memoryNodeStatePair = stateMap.GetState(*allocaNode.region(), allocaMemoryNode);
   memoryNodeStatePair->ReplaceState(*allocaNode.output(1));
+
+  // The fields of the memory are allocated along with it
+  for (auto & fieldNode : pointsToGraph.GetFieldNodes(allocaMemoryNode))
+  {
+    auto fieldNodeStatePair = stateMap.GetState(*allocaNode.region(), fieldNode);
+    fieldNodeStatePair->ReplaceState(*allocaNode.output(1));
+  }
 }
 
 void
@@ -603,8 +663,8 @@ MemoryStateEncoder::EncodeMalloc(const jlm::rvsdg::simple_node & mallocNode)
   JLM_ASSERT(is<malloc_op>(&mallocNode));
   auto & stateMap = Context_->GetRegionalizedStateMap();
 
-  auto & mallocMemoryNode =
-      Context_->GetMemoryNodeProvisioning().GetPointsToGraph().GetMallocNode(mallocNode);
+  auto & pointsToGraph = Context_->GetMemoryNodeProvisioning().GetPointsToGraph();
+  auto & mallocMemoryNode = pointsToGraph.GetMallocNode(mallocNode);
 
   /**
    * We use a static heap model. This means that multiple invocations of an malloc
@@ -612,10 +672,19 @@ MemoryStateEncoder::EncodeMalloc(const jlm::rvsdg::simple_node & mallocNode)
    * merge the previous and the current state to ensure that the previous state
    * is not just simply replaced and therefore "lost".
    */
-  auto memoryNodeStatePair = stateMap.GetState(*mallocNode.region(), mallocMemoryNode);
   auto mallocState = mallocNode.output(1);
-  auto mergedState = MemStateMergeOperator::Create({ mallocState, &memoryNodeStatePair->State() });
-  memoryNodeStatePair->ReplaceState(*mergedState);
+  auto mergeState = [&](const PointsToGraph::MemoryNode & memoryNode)
+  {
+    auto memoryNodeStatePair = stateMap.GetState(*mallocNode.region(), memoryNode);
+    auto mergedState =
+        MemStateMergeOperator::Create({ mallocState, &memoryNodeStatePair->State() });
+    memoryNodeStatePair->ReplaceState(*mergedState);
+  };
+
+  // The fields of the memory are allocated along with it
+  mergeState(mallocMemoryNode);
+  for (auto & fieldNode : pointsToGraph.GetFieldNodes(mallocMemoryNode))
+    mergeState(fieldNode);
 }
 
 void
@@ -635,6 +704,7 @@ MemoryStateEncoder::EncodeLoad(const LoadNode & loadNode)
       loadOperation.GetLoadedType(),
       loadOperation.GetAlignment());
   oldResult->divert_users(outputs[0]);
+  Context_->GetRvsdgModule().NotifyOutputCopied(*oldResult, *outputs[0]);
 
   StateMap::MemoryNodeStatePair::ReplaceStates(
       memoryNodeStatePairs,
@@ -4,14 +4,88 @@
  */
 
 #include <jlm/llvm/opt/alias-analyses/AgnosticMemoryNodeProvider.hpp>
+#include <jlm/llvm/opt/alias-analyses/Andersen.hpp>
+#include <jlm/llvm/opt/alias-analyses/MemoryNodeCoarsener.hpp>
 #include <jlm/llvm/opt/alias-analyses/MemoryStateEncoder.hpp>
 #include <jlm/llvm/opt/alias-analyses/Optimization.hpp>
+#include <jlm/llvm/opt/alias-analyses/PointsToGraphCache.hpp>
 #include <jlm/llvm/opt/alias-analyses/RegionAwareMemoryNodeProvider.hpp>
 #include <jlm/llvm/opt/alias-analyses/Steensgaard.hpp>
 
 namespace jlm::llvm::aa
 {
 
+/**
+ * Encodes the memory states of \p rvsdgModule with the memory nodes of \p seedProvisioning. The
+ * memory nodes are coarsened before the encoding if \p coarseningBudget is given.
+ *
+ * @see MemoryNodeCoarsener
+ */
+static void
+EncodeMemoryStates(
+    RvsdgModule & rvsdgModule,
+    const MemoryNodeProvisioning & seedProvisioning,
+    const std::optional<size_t> & coarseningBudget,
+    util::StatisticsCollector & statisticsCollector)
+{
+  MemoryStateEncoder encoder;
+  if (!coarseningBudget.has_value())
+  {
+    encoder.Encode(rvsdgModule, seedProvisioning, statisticsCollector);
+    return;
+  }
+
+  auto provisioning = MemoryNodeCoarsener::Create(
+      rvsdgModule,
+      seedProvisioning,
+      *coarseningBudget,
+      statisticsCollector);
+  encoder.Encode(rvsdgModule, *provisioning, statisticsCollector);
+}
+
+AndersenAgnostic::~AndersenAgnostic() noexcept = default;
+
+void
+AndersenAgnostic::run(RvsdgModule & rvsdgModule, util::StatisticsCollector & statisticsCollector)
+{
+  Andersen andersen;
+  auto & pointsToGraph =
+      PointsToGraphCache::GetPointsToGraph(rvsdgModule, andersen, "Andersen", statisticsCollector);
+
+  auto seedProvisioning =
+      AgnosticMemoryNodeProvider::Create(rvsdgModule, pointsToGraph, statisticsCollector);
+  EncodeMemoryStates(rvsdgModule, *seedProvisioning, CoarseningBudget_, statisticsCollector);
+}
+
+bool
+AndersenAgnostic::ReportsModifications() const noexcept
+{
+  return true;
+}
+
+AndersenRegionAware::~AndersenRegionAware() noexcept = default;
+
+void
+AndersenRegionAware::run(RvsdgModule & rvsdgModule, util::StatisticsCollector & statisticsCollector)
+{
+  Andersen andersen;
+  auto & pointsToGraph =
+      PointsToGraphCache::GetPointsToGraph(rvsdgModule, andersen, "Andersen", statisticsCollector);
+
+  auto seedProvisioning = RegionAwareMemoryNodeProvider::Create(
+      rvsdgModule,
+      pointsToGraph,
+      statisticsCollector,
+      NumThreads_);
+  EncodeMemoryStates(rvsdgModule, *seedProvisioning, CoarseningBudget_, statisticsCollector);
+}
+
+bool
+AndersenRegionAware::ReportsModifications() const noexcept
+{
+  return true;
+}
+
 SteensgaardAgnostic::~SteensgaardAgnostic() noexcept = default;
 
 void
@@ -20,13 +94,49 @@ SteensgaardAgnostic::run(
     jlm::util::StatisticsCollector & statisticsCollector)
 {
   Steensgaard steensgaard;
-  auto pointsToGraph = steensgaard.Analyze(rvsdgModule, statisticsCollector);
+  auto & pointsToGraph = PointsToGraphCache::GetPointsToGraph(
+      rvsdgModule,
+      steensgaard,
+      "Steensgaard",
+      statisticsCollector);
 
-  auto provisioning =
-      AgnosticMemoryNodeProvider::Create(rvsdgModule, *pointsToGraph, statisticsCollector);
+  auto seedProvisioning =
+      AgnosticMemoryNodeProvider::Create(rvsdgModule, pointsToGraph, statisticsCollector);
+  EncodeMemoryStates(rvsdgModule, *seedProvisioning, CoarseningBudget_, statisticsCollector);
+}
 
-  MemoryStateEncoder encoder;
-  encoder.Encode(rvsdgModule, *provisioning, statisticsCollector);
+bool
+SteensgaardAgnostic::ReportsModifications() const noexcept
+{
+  return true;
+}
+
+SteensgaardFieldSensitiveRegionAware::~SteensgaardFieldSensitiveRegionAware() noexcept = default;
+
+void
+SteensgaardFieldSensitiveRegionAware::run(
+    RvsdgModule & rvsdgModule,
+    util::StatisticsCollector & statisticsCollector)
+{
+  Steensgaard steensgaard(true);
+  auto & pointsToGraph = PointsToGraphCache::GetPointsToGraph(
+      rvsdgModule,
+      steensgaard,
+      "SteensgaardFieldSensitive",
+      statisticsCollector);
+
+  auto seedProvisioning = RegionAwareMemoryNodeProvider::Create(
+      rvsdgModule,
+      pointsToGraph,
+      statisticsCollector,
+      NumThreads_);
+  EncodeMemoryStates(rvsdgModule, *seedProvisioning, CoarseningBudget_, statisticsCollector);
+}
+
+bool
+SteensgaardFieldSensitiveRegionAware::ReportsModifications() const noexcept
+{
+  return true;
 }
 
 SteensgaardRegionAware::~SteensgaardRegionAware() noexcept = default;
@@ -37,13 +147,24 @@ SteensgaardRegionAware::run(
     util::StatisticsCollector & statisticsCollector)
 {
   Steensgaard steensgaard;
-  auto pointsToGraph = steensgaard.Analyze(rvsdgModule, statisticsCollector);
+  auto & pointsToGraph = PointsToGraphCache::GetPointsToGraph(
+      rvsdgModule,
+      steensgaard,
+      "Steensgaard",
+      statisticsCollector);
 
-  auto provisioning =
-      RegionAwareMemoryNodeProvider::Create(rvsdgModule, *pointsToGraph, statisticsCollector);
+  auto seedProvisioning = RegionAwareMemoryNodeProvider::Create(
+      rvsdgModule,
+      pointsToGraph,
+      statisticsCollector,
+      NumThreads_);
+  EncodeMemoryStates(rvsdgModule, *seedProvisioning, CoarseningBudget_, statisticsCollector);
+}
 
-  MemoryStateEncoder encoder;
-  encoder.Encode(rvsdgModule, *provisioning, statisticsCollector);
+bool
+SteensgaardRegionAware::ReportsModifications() const noexcept
+{
+  return true;
 }
 
 }
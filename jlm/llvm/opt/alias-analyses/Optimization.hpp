@@ -8,9 +8,91 @@
 
 #include <jlm/llvm/opt/optimization.hpp>
 
+#include <cstddef>
+#include <optional>
+
 namespace jlm::llvm::aa
 {
 
+/** \brief Andersen alias analysis with agnostic memory state encoding
+ *
+ * @see Andersen
+ * @see AgnosticMemoryNodeProvider
+ */
+class AndersenAgnostic final : public optimization
+{
+public:
+  ~AndersenAgnostic() noexcept override;
+
+  /**
+   * @param coarseningBudget The budget of the MemoryNodeCoarsener. The memory nodes are not
+   * coarsened if no budget is given.
+   */
+  explicit AndersenAgnostic(std::optional<size_t> coarseningBudget = std::nullopt)
+      : CoarseningBudget_(coarseningBudget)
+  {}
+
+  [[nodiscard]] const std::optional<size_t> &
+  GetCoarseningBudget() const noexcept
+  {
+    return CoarseningBudget_;
+  }
+
+  void
+  run(RvsdgModule & rvsdgModule, jlm::util::StatisticsCollector & statisticsCollector) override;
+
+  [[nodiscard]] bool
+  ReportsModifications() const noexcept override;
+
+private:
+  std::optional<size_t> CoarseningBudget_;
+};
+
+/** \brief Andersen alias analysis with region-aware memory state encoding
+ *
+ * @see Andersen
+ * @see RegionAwareMemoryNodeProvider
+ */
+class AndersenRegionAware final : public optimization
+{
+public:
+  ~AndersenRegionAware() noexcept override;
+
+  /**
+   * @param numThreads The maximal number of threads used for the memory node provisioning.
+   * @param coarseningBudget The budget of the MemoryNodeCoarsener. The memory nodes are not
+   * coarsened if no budget is given.
+   */
+  explicit AndersenRegionAware(
+      size_t numThreads = 1,
+      std::optional<size_t> coarseningBudget = std::nullopt)
+      : NumThreads_(numThreads),
+        CoarseningBudget_(coarseningBudget)
+  {}
+
+  [[nodiscard]] size_t
+  NumThreads() const noexcept
+  {
+    return NumThreads_;
+  }
+
+  [[nodiscard]] const std::optional<size_t> &
+  GetCoarseningBudget() const noexcept
+  {
+    return CoarseningBudget_;
+  }
+
+  void
+  run(RvsdgModule & rvsdgModule, jlm::util::StatisticsCollector & statisticsCollector) override;
+
+  [[nodiscard]] bool
+  ReportsModifications() const noexcept override;
+
+private:
+  size_t NumThreads_;
+  std::optional<size_t> CoarseningBudget_;
+};
+
 /** \brief Steensgaard alias analysis with agnostic memory state encoding
  *
  * @see Steensgaard
@@ -21,8 +103,76 @@ class SteensgaardAgnostic final : public optimization
 public:
   ~SteensgaardAgnostic() noexcept override;
 
+  /**
+   * @param coarseningBudget The budget of the MemoryNodeCoarsener. The memory nodes are not
+   * coarsened if no budget is given.
+   */
+  explicit SteensgaardAgnostic(std::optional<size_t> coarseningBudget = std::nullopt)
+      : CoarseningBudget_(coarseningBudget)
+  {}
+
+  [[nodiscard]] const std::optional<size_t> &
+  GetCoarseningBudget() const noexcept
+  {
+    return CoarseningBudget_;
+  }
+
+  void
+  run(RvsdgModule & rvsdgModule, jlm::util::StatisticsCollector & statisticsCollector) override;
+
+  [[nodiscard]] bool
+  ReportsModifications() const noexcept override;
+
+private:
+  std::optional<size_t> CoarseningBudget_;
+};
+
+/** \brief Field-sensitive Steensgaard alias analysis with region-aware memory state encoding
+ *
+ * The field nodes are only of use with a region-aware encoding, as the agnostic encoding routes
+ * all memory nodes through all memory operations.
+ *
+ * @see Steensgaard
+ * @see RegionAwareMemoryNodeProvider
+ */
+class SteensgaardFieldSensitiveRegionAware final : public optimization
+{
+public:
+  ~SteensgaardFieldSensitiveRegionAware() noexcept override;
+
+  /**
+   * @param numThreads The maximal number of threads used for the memory node provisioning.
+   * @param coarseningBudget The budget of the MemoryNodeCoarsener. The memory nodes are not
+   * coarsened if no budget is given.
+   */
+  explicit SteensgaardFieldSensitiveRegionAware(
+      size_t numThreads = 1,
+      std::optional<size_t> coarseningBudget = std::nullopt)
+      : NumThreads_(numThreads),
+        CoarseningBudget_(coarseningBudget)
+  {}
+
+  [[nodiscard]] size_t
+  NumThreads() const noexcept
+  {
+    return NumThreads_;
+  }
+
+  [[nodiscard]] const std::optional<size_t> &
+  GetCoarseningBudget() const noexcept
+  {
+    return CoarseningBudget_;
+  }
+
   void
   run(RvsdgModule & rvsdgModule, jlm::util::StatisticsCollector & statisticsCollector) override;
+
+  [[nodiscard]] bool
+  ReportsModifications() const noexcept override;
+
+private:
+  size_t NumThreads_;
+  std::optional<size_t> CoarseningBudget_;
 };
 
 /** \brief Steensgaard alias analysis with region-aware memory state encoding
@@ -35,8 +185,39 @@ class SteensgaardRegionAware final : public optimization
 public:
   ~SteensgaardRegionAware() noexcept override;
 
+  /**
+   * @param numThreads The maximal number of threads used for the memory node provisioning.
+   * @param coarseningBudget The budget of the MemoryNodeCoarsener. The memory nodes are not
+   * coarsened if no budget is given.
+   */
+  explicit SteensgaardRegionAware(
+      size_t numThreads = 1,
+      std::optional<size_t> coarseningBudget = std::nullopt)
+      : NumThreads_(numThreads),
+        CoarseningBudget_(coarseningBudget)
+  {}
+
+  [[nodiscard]] size_t
+  NumThreads() const noexcept
+  {
+    return NumThreads_;
+  }
+
+  [[nodiscard]] const std::optional<size_t> &
+  GetCoarseningBudget() const noexcept
+  {
+    return CoarseningBudget_;
+  }
+
   void
   run(RvsdgModule & rvsdgModule, jlm::util::StatisticsCollector & statisticsCollector) override;
+
+  [[nodiscard]] bool
+  ReportsModifications() const noexcept override;
+
+private:
+  size_t NumThreads_;
+  std::optional<size_t> CoarseningBudget_;
 };
 
 }
@@ -5,7 +5,10 @@
 
 #include <jlm/llvm/opt/alias-analyses/PointerObjectSet.hpp>
 
+#include <algorithm>
+#include <numeric>
 #include <queue>
+#include <set>
 
 namespace jlm::llvm::aa
 {
@@ -25,6 +28,12 @@ PointerObjectSet::CreateRegisterPointerObject(const rvsdg::output & rvsdgOutput)
   return RegisterMap_[&rvsdgOutput] = AddPointerObject(PointerObjectKind::Register);
 }
 
+PointerObject::Index
+PointerObjectSet::CreateDummyRegisterPointerObject()
+{
+  return AddPointerObject(PointerObjectKind::Register);
+}
+
 void
 PointerObjectSet::MapRegisterToExistingPointerObject(
     const rvsdg::output & rvsdgOutput,
@@ -127,7 +136,7 @@ PointerObjectSet::GetPointerObject(PointerObject::Index index) const
   return PointerObjects_[index];
 }
 
-const util::HashSet<PointerObject::Index> &
+const util::SparseBitVector &
 PointerObjectSet::GetPointsToSet(PointerObject::Index idx) const
 {
   JLM_ASSERT(idx <= NumPointerObjects());
@@ -146,6 +155,17 @@ PointerObjectSet::AddToPointsToSet(PointerObject::Index pointer, PointerObject::
   return PointsToSets_[pointer].Insert(pointee);
 }
 
+// Makes all pointees members of P(pointer)
+bool
+PointerObjectSet::AddToPointsToSet(
+    PointerObject::Index pointer,
+    const util::SparseBitVector & pointees)
+{
+  JLM_ASSERT(pointer < NumPointerObjects());
+
+  return PointsToSets_[pointer].UnionWith(pointees);
+}
+
 // Makes P(superset) a superset of P(subset)
 bool
 PointerObjectSet::MakePointsToSetSuperset(
@@ -209,7 +229,11 @@ SupersetOfAllPointeesConstraint::Apply(PointerObjectSet & set)
   for (PointerObject::Index x : set.GetPointsToSet(Pointer_).Items())
     modified |= set.MakePointsToSetSuperset(Loaded_, x);
 
-  // Handling pointing to external is done by MakePointsToSetSuperset,
+  // Loading from external memory can produce a pointer to any external or escaped memory
+  if (set.GetPointerObject(Pointer_).PointsToExternal())
+    modified |= set.GetPointerObject(Loaded_).MarkAsPointsToExternal();
+
+  // Handling pointing to external for the pointees is done by MakePointsToSetSuperset,
   // Propagating escaped status is handled by different constraints
 
   return modified;
@@ -250,8 +274,385 @@ PointerObjectConstraintSet::AddConstraint(ConstraintVariant c)
   Constraints_.push_back(c);
 }
 
+/**
+ * Worklist based solver for the constraints of a PointerObjectConstraintSet.
+ *
+ * Each PointerObject is a node in a constraint graph, with an edge from x to y for every
+ * constraint of the form P(y) is a superset of P(x). Store and load constraints are attached to
+ * their pointer, and add new edges whenever new pointees reach the pointer. PointerObjects that
+ * are found to form a cycle are unified, with the union-find representative holding the
+ * points-to-set and the PointsToExternal flag of all of them. The Escaped flag is kept for each
+ * PointerObject, as it is not shared along edges.
+ */
+class WorklistSolver final
+{
+  using Index = PointerObject::Index;
+
+public:
+  WorklistSolver(
+      PointerObjectSet & set,
+      const std::vector<PointerObjectConstraintSet::ConstraintVariant> & constraints)
+      : Set_(set),
+        Parent_(set.NumPointerObjects()),
+        SupersetEdges_(set.NumPointerObjects()),
+        StoreConstraints_(set.NumPointerObjects()),
+        LoadConstraints_(set.NumPointerObjects()),
+        NewPointees_(set.NumPointerObjects()),
+        PointeesEscaping_(set.NumPointerObjects(), false),
+        PointeesEscapingChanged_(set.NumPointerObjects(), false),
+        InWorklist_(set.NumPointerObjects(), false),
+        DfsNumber_(set.NumPointerObjects()),
+        LowLink_(set.NumPointerObjects()),
+        OnStack_(set.NumPointerObjects(), false),
+        Visited_(set.NumPointerObjects(), 0),
+        Generation_(0)
+  {
+    for (auto & constraint : constraints)
+    {
+      if (auto superset = std::get_if<SupersetConstraint>(&constraint))
+        SupersetEdges_[superset->GetSubset()].Insert(superset->GetSuperset());
+      else if (auto store = std::get_if<AllPointeesPointToSupersetConstraint>(&constraint))
+        StoreConstraints_[store->GetPointer1()].push_back(store->GetPointer2());
+      else if (auto load = std::get_if<SupersetOfAllPointeesConstraint>(&constraint))
+        LoadConstraints_[load->GetPointer()].push_back(load->GetLoaded());
+    }
+
+    for (Index idx = 0; idx < Set_.NumPointerObjects(); idx++)
+    {
+      Parent_[idx] = idx;
+      NewPointees_[idx] = Set_.GetPointsToSet(idx);
+      if (Set_.GetPointerObject(idx).HasEscaped())
+        MarkPointeesAsEscaping(idx);
+      PushToWorklist(idx);
+    }
+  }
+
+  void
+  Solve()
+  {
+    // Collapse the cycles formed by the initial superset constraints up front
+    std::vector<Index> roots(Set_.NumPointerObjects());
+    std::iota(roots.begin(), roots.end(), 0);
+    CollapseCycles(roots);
+
+    while (!Worklist_.empty())
+    {
+      auto node = Worklist_.front();
+      Worklist_.pop();
+      InWorklist_[node] = false;
+
+      // Unified PointerObjects are handled by their representative
+      if (Find(node) != node)
+        continue;
+
+      ProcessNode(node);
+
+      if (!CycleCandidates_.empty())
+      {
+        CollapseCycles(CycleCandidates_);
+        CycleCandidates_.clear();
+      }
+    }
+
+    // Unified PointerObjects share the solution of their representative
+    for (Index idx = 0; idx < Set_.NumPointerObjects(); idx++)
+    {
+      auto representative = Find(idx);
+      if (representative != idx)
+        Set_.MakePointsToSetSuperset(idx, representative);
+    }
+  }
+
+private:
+  Index
+  Find(Index idx) noexcept
+  {
+    while (Parent_[idx] != idx)
+    {
+      Parent_[idx] = Parent_[Parent_[idx]];
+      idx = Parent_[idx];
+    }
+
+    return idx;
+  }
+
+  void
+  PushToWorklist(Index node)
+  {
+    if (InWorklist_[node])
+      return;
+
+    InWorklist_[node] = true;
+    Worklist_.push(node);
+  }
+
+  // Marks that all current and future pointees of the representative node escape
+  void
+  MarkPointeesAsEscaping(Index node)
+  {
+    if (PointeesEscaping_[node])
+      return;
+
+    PointeesEscaping_[node] = true;
+    PointeesEscapingChanged_[node] = true;
+    PushToWorklist(node);
+  }
+
+  void
+  MarkAsEscaped(Index pointerObject)
+  {
+    if (!Set_.GetPointerObject(pointerObject).MarkAsEscaped())
+      return;
+
+    // Escaped implies pointing to external, which is shared by all unified PointerObjects and
+    // must be propagated along the edges of the representative
+    auto node = Find(pointerObject);
+    Set_.GetPointerObject(node).MarkAsPointsToExternal();
+    MarkPointeesAsEscaping(node);
+    PushToWorklist(node);
+  }
+
+  // Adds the edge making P(superset) a superset of P(subset), and propagates the full P(subset)
+  void
+  AddEdge(Index subset, Index superset)
+  {
+    if (subset == superset || !SupersetEdges_[subset].Insert(superset))
+      return;
+
+    Propagate(subset, superset, Set_.GetPointsToSet(subset));
+  }
+
+  void
+  Propagate(Index subset, Index superset, const util::SparseBitVector & pointees)
+  {
+    auto addedPointees = pointees;
+    addedPointees.DifferenceWith(Set_.GetPointsToSet(superset));
+
+    bool modified = false;
+    if (!addedPointees.IsEmpty())
+    {
+      Set_.AddToPointsToSet(superset, addedPointees);
+      NewPointees_[superset].UnionWith(addedPointees);
+      modified = true;
+    }
+
+    if (Set_.GetPointerObject(subset).PointsToExternal())
+      modified |= Set_.GetPointerObject(superset).MarkAsPointsToExternal();
+
+    if (modified)
+      PushToWorklist(superset);
+
+    // Lazy cycle detection: Identical points-to-sets at both ends of an edge hint at a cycle.
+    // Every edge triggers a search at most once.
+    auto size = Set_.GetPointsToSet(subset).Size();
+    if (size != 0 && size == Set_.GetPointsToSet(superset).Size()
+        && CheckedEdges_.emplace(subset, superset).second)
+    {
+      CycleCandidates_.push_back(superset);
+    }
+  }
+
+  void
+  ProcessNode(Index node)
+  {
+    auto newPointees = std::move(NewPointees_[node]);
+    NewPointees_[node].Clear();
+
+    // Mark pointees of escaped PointerObjects as escaped
+    if (PointeesEscaping_[node])
+    {
+      auto & escapingPointees =
+          PointeesEscapingChanged_[node] ? Set_.GetPointsToSet(node) : newPointees;
+      for (auto pointee : escapingPointees.Items())
+        MarkAsEscaped(pointee);
+    }
+    PointeesEscapingChanged_[node] = false;
+
+    // for all x in P(node), make P(x) a superset of P(value)
+    for (auto value : StoreConstraints_[node])
+    {
+      // Storing to external makes everything in P(value) escape
+      if (Set_.GetPointerObject(node).PointsToExternal())
+        MarkPointeesAsEscaping(Find(value));
+
+      for (auto pointee : newPointees.Items())
+        AddEdge(Find(value), Find(pointee));
+    }
+
+    // for all x in P(node), make P(loaded) a superset of P(x)
+    for (auto loaded : LoadConstraints_[node])
+    {
+      // Loading from external makes P(loaded) point to external
+      if (Set_.GetPointerObject(node).PointsToExternal())
+      {
+        auto loadedNode = Find(loaded);
+        if (Set_.GetPointerObject(loadedNode).MarkAsPointsToExternal())
+          PushToWorklist(loadedNode);
+      }
+
+      for (auto pointee : newPointees.Items())
+        AddEdge(Find(pointee), Find(loaded));
+    }
+
+    // Propagate the new pointees along all edges
+    for (auto superset : SupersetEdges_[node].Items())
+    {
+      superset = Find(superset);
+      if (superset != node)
+        Propagate(node, superset, newPointees);
+    }
+  }
+
+  // Merges the representative node other into the representative node
+  void
+  Unify(Index node, Index other)
+  {
+    Parent_[other] = node;
+
+    Set_.MakePointsToSetSuperset(node, other);
+    NewPointees_[node] = Set_.GetPointsToSet(node);
+    NewPointees_[other].Clear();
+
+    if (PointeesEscaping_[other])
+      MarkPointeesAsEscaping(node);
+
+    SupersetEdges_[node].UnionWith(SupersetEdges_[other]);
+    SupersetEdges_[other].Clear();
+    StoreConstraints_[node].insert(
+        StoreConstraints_[node].end(),
+        StoreConstraints_[other].begin(),
+        StoreConstraints_[other].end());
+    StoreConstraints_[other].clear();
+    LoadConstraints_[node].insert(
+        LoadConstraints_[node].end(),
+        LoadConstraints_[other].begin(),
+        LoadConstraints_[other].end());
+    LoadConstraints_[other].clear();
+
+    PushToWorklist(node);
+  }
+
+  /**
+   * Finds the strongly connected components reachable from \p roots with Tarjan's algorithm, and
+   * unifies the PointerObjects of each component.
+   */
+  void
+  CollapseCycles(const std::vector<Index> & roots)
+  {
+    struct Frame
+    {
+      Index Node;
+      std::vector<Index> Successors;
+      size_t Next;
+    };
+
+    Generation_++;
+    size_t dfsNumber = 0;
+    std::vector<Frame> frames;
+    std::vector<Index> stack;
+
+    auto visit = [&](Index node)
+    {
+      Visited_[node] = Generation_;
+      DfsNumber_[node] = LowLink_[node] = dfsNumber++;
+      OnStack_[node] = true;
+      stack.push_back(node);
+
+      std::vector<Index> successors;
+      for (auto superset : SupersetEdges_[node].Items())
+      {
+        superset = Find(superset);
+        if (superset != node)
+          successors.push_back(superset);
+      }
+      frames.push_back({ node, std::move(successors), 0 });
+    };
+
+    for (auto root : roots)
+    {
+      root = Find(root);
+      if (Visited_[root] == Generation_)
+        continue;
+
+      visit(root);
+      while (!frames.empty())
+      {
+        auto & frame = frames.back();
+        if (frame.Next < frame.Successors.size())
+        {
+          auto successor = frame.Successors[frame.Next++];
+          if (Visited_[successor] != Generation_)
+            visit(successor);
+          else if (OnStack_[successor])
+            LowLink_[frame.Node] = std::min(LowLink_[frame.Node], DfsNumber_[successor]);
+          continue;
+        }
+
+        auto node = frame.Node;
+        frames.pop_back();
+        if (!frames.empty())
+          LowLink_[frames.back().Node] = std::min(LowLink_[frames.back().Node], LowLink_[node]);
+
+        if (LowLink_[node] != DfsNumber_[node])
+          continue;
+
+        Index member;
+        do
+        {
+          member = stack.back();
+          stack.pop_back();
+          OnStack_[member] = false;
+          if (member != node)
+            Unify(node, member);
+        } while (member != node);
+      }
+    }
+  }
+
+  PointerObjectSet & Set_;
+
+  // Union-find forest of unified PointerObjects
+  std::vector<Index> Parent_;
+
+  // For each representative x, the PointerObjects y where P(y) must be a superset of P(x)
+  std::vector<util::HashSet<Index>> SupersetEdges_;
+
+  // For each representative x, the values v where P(p) must be a superset of P(v) for all p in P(x)
+  std::vector<std::vector<Index>> StoreConstraints_;
+
+  // For each representative x, the registers r where P(r) must be a superset of P(p) for all p in
+  // P(x)
+  std::vector<std::vector<Index>> LoadConstraints_;
+
+  // For each representative, the pointees added since it was last processed
+  std::vector<util::SparseBitVector> NewPointees_;
+
+  // Representatives whose pointees all escape, and whether this is not yet processed
+  std::vector<bool> PointeesEscaping_;
+  std::vector<bool> PointeesEscapingChanged_;
+
+  std::queue<Index> Worklist_;
+  std::vector<bool> InWorklist_;
+
+  // State for lazy cycle detection
+  std::set<std::pair<Index, Index>> CheckedEdges_;
+  std::vector<Index> CycleCandidates_;
+  std::vector<size_t> DfsNumber_;
+  std::vector<size_t> LowLink_;
+  std::vector<bool> OnStack_;
+  std::vector<size_t> Visited_;
+  size_t Generation_;
+};
+
 void
 PointerObjectConstraintSet::Solve()
+{
+  WorklistSolver solver(Set_, Constraints_);
+  solver.Solve();
+}
+
+void
+PointerObjectConstraintSet::SolveNaively()
 {
   // Keep applying constraints until no sets are modified
   bool modified = true;
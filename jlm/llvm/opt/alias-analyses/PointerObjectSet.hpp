@@ -12,6 +12,7 @@
 #include <jlm/util/common.hpp>
 #include <jlm/util/HashSet.hpp>
 #include <jlm/util/Math.hpp>
+#include <jlm/util/SparseBitVector.hpp>
 
 #include <cstdint>
 #include <unordered_map>
@@ -125,7 +126,7 @@ class PointerObjectSet final
   std::vector<PointerObject> PointerObjects_;
 
   // For each PointerObject, a set of the other PointerObjects it points to
-  std::vector<util::HashSet<PointerObject::Index>> PointsToSets_;
+  std::vector<util::SparseBitVector> PointsToSets_;
 
   // Mapping from register to PointerObject
   // Unlike the other maps, several rvsdg::output* can share register PointerObject
@@ -161,6 +162,15 @@ public:
   PointerObject::Index
   CreateRegisterPointerObject(const rvsdg::output & rvsdgOutput);
 
+  /**
+   * Creates a PointerObject of register kind that is not associated with any rvsdg output.
+   * Useful for intermediate values that only exist within constraints, e.g., the copied memory
+   * content of a memcpy.
+   * @return the index of the new PointerObject in the PointerObjectSet
+   */
+  PointerObject::Index
+  CreateDummyRegisterPointerObject();
+
   /**
    * Reuses an existing PointerObject of register type for an additional rvsdg output.
    * This is useful when two rvsdg outputs can be shown to always hold the exact same value.
@@ -214,7 +224,7 @@ public:
   [[nodiscard]] const PointerObject &
   GetPointerObject(PointerObject::Index index) const;
 
-  const util::HashSet<PointerObject::Index> &
+  const util::SparseBitVector &
   GetPointsToSet(PointerObject::Index idx) const;
 
   /**
@@ -226,6 +236,15 @@ public:
   bool
   AddToPointsToSet(PointerObject::Index pointer, PointerObject::Index pointee);
 
+  /**
+   * Adds all of \p pointees to P(\p pointer)
+   * @param pointer the index of the PointerObject that shall point to the pointees
+   * @param pointees the indices of the PointerObjects that are pointed at, can not be registers.
+   * @return true if P(\p pointer) was changed by this operation
+   */
+  bool
+  AddToPointsToSet(PointerObject::Index pointer, const util::SparseBitVector & pointees);
+
   /**
    * Makes P(\p superset) a superset of P(\p subset), by adding any elements in the set difference
    * @param superset the index of the PointerObject that shall point to everything subset points to
@@ -261,6 +280,18 @@ public:
         Subset_(subset)
   {}
 
+  [[nodiscard]] PointerObject::Index
+  GetSuperset() const noexcept
+  {
+    return Superset_;
+  }
+
+  [[nodiscard]] PointerObject::Index
+  GetSubset() const noexcept
+  {
+    return Subset_;
+  }
+
   /**
    * \brief Applies the constraint to the \p set
    * \return true if this operation modified any PointerObjects or points-to-sets
@@ -285,6 +316,18 @@ public:
         Pointer2_(pointer2)
   {}
 
+  [[nodiscard]] PointerObject::Index
+  GetPointer1() const noexcept
+  {
+    return Pointer1_;
+  }
+
+  [[nodiscard]] PointerObject::Index
+  GetPointer2() const noexcept
+  {
+    return Pointer2_;
+  }
+
   /**
    * \brief Applies the constraint to the \p set
    * \return true if this operation modified any PointerObjects or points-to-sets
@@ -297,6 +340,7 @@ public:
  * A constraint of the form:
  * P(loaded) is a superset of P(x) for all x in P(pointer)
  * Example of application is a load, e.g. when loaded = *pointer
+ * If pointer points to external, loaded also points to external.
  */
 class SupersetOfAllPointeesConstraint final
 {
@@ -309,6 +353,18 @@ public:
         Pointer_(pointer)
   {}
 
+  [[nodiscard]] PointerObject::Index
+  GetLoaded() const noexcept
+  {
+    return Loaded_;
+  }
+
+  [[nodiscard]] PointerObject::Index
+  GetPointer() const noexcept
+  {
+    return Pointer_;
+  }
+
   /**
    * \brief Applies the constraint to the \p set
    * \return true if this operation modified any PointerObjects or points-to-sets
@@ -376,12 +432,28 @@ public:
   void
   AddConstraint(ConstraintVariant c);
 
+  /**
+   * Finds the least solution of the points-to-sets that satisfies all constraints.
+   *
+   * The constraints are turned into a constraint graph, where an edge from x to y denotes that
+   * P(y) is a superset of P(x). Load and store constraints add edges as the points-to-sets grow.
+   * PointerObjects are processed from a worklist, and only the pointees that were added since a
+   * PointerObject was last processed are propagated along its edges (difference propagation).
+   * Cycles in the constraint graph are detected lazily, when an edge connects two PointerObjects
+   * with identical points-to-sets, and the PointerObjects of a cycle are collapsed into one.
+   *
+   * The result is identical to the one of SolveNaively().
+   */
+  void
+  Solve();
+
   /**
    * Iterates over and applies constraints until all points-to-sets satisfy them.
    * This operation potentially has a long runtime, with an upper bound of O(n^3).
+   * It is kept as a reference for validating Solve().
    */
   void
-  Solve();
+  SolveNaively();
 
 private:
   /**
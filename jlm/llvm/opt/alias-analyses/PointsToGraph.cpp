@@ -9,6 +9,7 @@
 
 #include <typeindex>
 #include <unordered_map>
+#include <vector>
 
 namespace jlm::llvm::aa
 {
@@ -51,6 +52,44 @@ PointsToGraph::DeltaNodes() const
   return { DeltaNodeConstIterator(DeltaNodes_.begin()), DeltaNodeConstIterator(DeltaNodes_.end()) };
 }
 
+PointsToGraph::FieldNodeRange
+PointsToGraph::FieldNodes()
+{
+  return { FieldNodeIterator(FieldNodes_.begin()), FieldNodeIterator(FieldNodes_.end()) };
+}
+
+PointsToGraph::FieldNodeConstRange
+PointsToGraph::FieldNodes() const
+{
+  return { FieldNodeConstIterator(FieldNodes_.begin()), FieldNodeConstIterator(FieldNodes_.end()) };
+}
+
+PointsToGraph::FieldNodeRange
+PointsToGraph::GetFieldNodes(const PointsToGraph::MemoryNode & object)
+{
+  auto index = object.GetIndex();
+  return { FieldNodeIterator(FieldNodes_.lower_bound({ index, 0 })),
+           FieldNodeIterator(FieldNodes_.lower_bound({ index + 1, 0 })) };
+}
+
+PointsToGraph::FieldNodeConstRange
+PointsToGraph::GetFieldNodes(const PointsToGraph::MemoryNode & object) const
+{
+  auto index = object.GetIndex();
+  return { FieldNodeConstIterator(FieldNodes_.lower_bound({ index, 0 })),
+           FieldNodeConstIterator(FieldNodes_.lower_bound({ index + 1, 0 })) };
+}
+
+const PointsToGraph::FieldNode &
+PointsToGraph::GetFieldNode(const PointsToGraph::MemoryNode & object, size_t offset) const
+{
+  auto it = FieldNodes_.find({ object.GetIndex(), offset });
+  if (it == FieldNodes_.end())
+    throw jlm::util::error("Cannot find field node in points-to graph.");
+
+  return *it->second;
+}
+
 PointsToGraph::LambdaNodeRange
 PointsToGraph::LambdaNodes()
 {
@@ -104,6 +143,13 @@ PointsToGraph::RegisterNodes() const
            RegisterNodeConstIterator(RegisterNodes_.end()) };
 }
 
+const PointsToGraph::MemoryNode &
+PointsToGraph::GetMemoryNode(size_t index) const
+{
+  JLM_ASSERT(index < Nodes_.size() && Nodes_[index] != nullptr);
+  return *util::AssertedCast<const PointsToGraph::MemoryNode>(Nodes_[index]);
+}
+
 PointsToGraph::AllocaNode &
 PointsToGraph::AddAllocaNode(std::unique_ptr<PointsToGraph::AllocaNode> node)
 {
@@ -122,6 +168,15 @@ PointsToGraph::AddDeltaNode(std::unique_ptr<PointsToGraph::DeltaNode> node)
   return *tmp;
 }
 
+PointsToGraph::FieldNode &
+PointsToGraph::AddFieldNode(std::unique_ptr<PointsToGraph::FieldNode> node)
+{
+  auto tmp = node.get();
+  FieldNodes_[{ node->GetObject().GetIndex(), node->GetOffset() }] = std::move(node);
+
+  return *tmp;
+}
+
 PointsToGraph::LambdaNode &
 PointsToGraph::AddLambdaNode(std::unique_ptr<PointsToGraph::LambdaNode> node)
 {
@@ -144,11 +199,33 @@ PointsToGraph::RegisterNode &
 PointsToGraph::AddRegisterNode(std::unique_ptr<PointsToGraph::RegisterNode> node)
 {
   auto tmp = node.get();
-  RegisterNodes_[&node->GetOutput()] = std::move(node);
+  for (auto output : node->GetOutputs().Items())
+  {
+    UnmapRegister(*output);
+    OutputRegisterNodes_[output] = tmp;
+  }
+  RegisterNodes_[tmp] = std::move(node);
 
   return *tmp;
 }
 
+void
+PointsToGraph::UnmapRegister(const rvsdg::output & output)
+{
+  auto it = OutputRegisterNodes_.find(&output);
+  if (it == OutputRegisterNodes_.end())
+    return;
+
+  auto registerNode = it->second;
+  OutputRegisterNodes_.erase(it);
+  registerNode->Outputs_.Remove(&output);
+  if (registerNode->Outputs_.Size() == 0)
+  {
+    RemoveNode(*registerNode);
+    RegisterNodes_.erase(registerNode);
+  }
+}
+
 PointsToGraph::ImportNode &
 PointsToGraph::AddImportNode(std::unique_ptr<PointsToGraph::ImportNode> node)
 {
@@ -158,6 +235,184 @@ PointsToGraph::AddImportNode(std::unique_ptr<PointsToGraph::ImportNode> node)
   return *tmp;
 }
 
+void
+PointsToGraph::AddCopy(const rvsdg::output & original, const rvsdg::output & copy)
+{
+  auto originalNode = rvsdg::node_output::node(&original);
+  auto copyNode = rvsdg::node_output::node(&copy);
+  const PointsToGraph::MemoryNode * originalMemoryNode = nullptr;
+  PointsToGraph::MemoryNode * copyMemoryNode = nullptr;
+  if (originalNode && copyNode && original.index() == 0)
+  {
+    auto allocaNode = AllocaNodes_.find(originalNode);
+    if (allocaNode != AllocaNodes_.end() && is<alloca_op>(copyNode)
+        && AllocaNodes_.find(copyNode) == AllocaNodes_.end())
+    {
+      originalMemoryNode = allocaNode->second.get();
+      copyMemoryNode = &AllocaNode::Create(*this, *copyNode);
+      MirrorMemoryNode(*originalMemoryNode, *copyMemoryNode);
+    }
+
+    auto mallocNode = MallocNodes_.find(originalNode);
+    if (mallocNode != MallocNodes_.end() && is<malloc_op>(copyNode)
+        && MallocNodes_.find(copyNode) == MallocNodes_.end())
+    {
+      originalMemoryNode = mallocNode->second.get();
+      copyMemoryNode = &MallocNode::Create(*this, *copyNode);
+      MirrorMemoryNode(*originalMemoryNode, *copyMemoryNode);
+    }
+  }
+
+  auto originalRegisterNode = OutputRegisterNodes_.find(&original);
+  if (originalRegisterNode == OutputRegisterNodes_.end())
+    return;
+
+  // A copy of a register points to the same memory nodes as the original, and therefore shares
+  // the register node of the original.
+  auto & registerNode = *originalRegisterNode->second;
+  auto copyRegisterNode = OutputRegisterNodes_.find(&copy);
+  if (copyMemoryNode == nullptr)
+  {
+    if (copyRegisterNode == OutputRegisterNodes_.end())
+    {
+      registerNode.Outputs_.Insert(&copy);
+      OutputRegisterNodes_[&copy] = &registerNode;
+      return;
+    }
+
+    if (copyRegisterNode->second == &registerNode)
+      return;
+  }
+
+  // The address of a copied allocation points to the memory of the copy instead of the original
+  auto targets = registerNode.Targets_;
+  if (copyMemoryNode)
+  {
+    targets.Remove(originalMemoryNode->GetIndex());
+    targets.Insert(copyMemoryNode->GetIndex());
+  }
+
+  // The copy was already mapped, and it keeps its previous targets
+  if (copyRegisterNode != OutputRegisterNodes_.end())
+    targets.UnionWith(copyRegisterNode->second->Targets_);
+
+  auto & registerNodeCopy = RegisterNode::Create(*this, copy);
+  for (auto target : targets.Items())
+    registerNodeCopy.AddEdge(*static_cast<PointsToGraph::MemoryNode *>(Nodes_[target]));
+}
+
+void
+PointsToGraph::MirrorMemoryNode(
+    const PointsToGraph::MemoryNode & original,
+    PointsToGraph::MemoryNode & copy)
+{
+  for (auto & target : original.Targets())
+    copy.AddEdge(const_cast<PointsToGraph::MemoryNode &>(target));
+
+  std::vector<PointsToGraph::Node *> sources;
+  for (auto & source : original.Sources())
+    sources.push_back(const_cast<PointsToGraph::Node *>(&source));
+
+  for (auto source : sources)
+  {
+    source->AddEdge(copy);
+    if (source == &original)
+      copy.AddEdge(copy);
+  }
+
+  if (EscapedMemoryNodes_.Contains(&original))
+    copy.MarkAsModuleEscaping();
+
+  std::vector<const PointsToGraph::FieldNode *> fieldNodes;
+  for (auto & fieldNode : GetFieldNodes(original))
+    fieldNodes.push_back(&fieldNode);
+
+  for (auto fieldNode : fieldNodes)
+  {
+    auto & fieldNodeCopy = FieldNode::Create(*this, copy, fieldNode->GetOffset());
+    MirrorMemoryNode(*fieldNode, fieldNodeCopy);
+  }
+}
+
+void
+PointsToGraph::RemoveNode(PointsToGraph::Node & node)
+{
+  std::vector<PointsToGraph::MemoryNode *> targets;
+  for (auto & target : node.Targets())
+    targets.push_back(&target);
+
+  for (auto target : targets)
+    node.RemoveEdge(*target);
+
+  if (auto memoryNode = dynamic_cast<PointsToGraph::MemoryNode *>(&node))
+  {
+    std::vector<PointsToGraph::Node *> sources;
+    for (auto & source : memoryNode->Sources())
+      sources.push_back(&source);
+
+    for (auto source : sources)
+      source->RemoveEdge(*memoryNode);
+
+    EscapedMemoryNodes_.Remove(memoryNode);
+  }
+
+  Nodes_[node.GetIndex()] = nullptr;
+}
+
+void
+PointsToGraph::RemoveMemoryNode(PointsToGraph::MemoryNode & memoryNode)
+{
+  // Field nodes have no fields themselves
+  auto index = memoryNode.GetIndex();
+  auto first = FieldNodes_.lower_bound({ index, 0 });
+  auto last = FieldNodes_.lower_bound({ index + 1, 0 });
+  for (auto it = first; it != last; it++)
+    RemoveNode(*it->second);
+  FieldNodes_.erase(first, last);
+
+  RemoveNode(memoryNode);
+}
+
+void
+PointsToGraph::RemoveOutput(const rvsdg::output & output)
+{
+  UnmapRegister(output);
+
+  if (auto argument = dynamic_cast<const rvsdg::argument *>(&output))
+  {
+    if (auto it = ImportNodes_.find(argument); it != ImportNodes_.end())
+    {
+      RemoveMemoryNode(*it->second);
+      ImportNodes_.erase(it);
+    }
+  }
+}
+
+void
+PointsToGraph::RemoveRvsdgNode(const rvsdg::node & node)
+{
+  auto removeMemoryNode = [&](auto & nodeMap, auto key)
+  {
+    auto it = nodeMap.find(key);
+    if (it == nodeMap.end())
+      return;
+
+    RemoveMemoryNode(*it->second);
+    nodeMap.erase(it);
+  };
+
+  // The node is reported from the destructor of rvsdg::structural_node, where a dynamic_cast no
+  // longer yields lambda or delta nodes. The nodes are therefore identified by their operation.
+  if (is<lambda::operation>(&node))
+    removeMemoryNode(LambdaNodes_, static_cast<const lambda::node *>(&node));
+  else if (is<delta::operation>(&node))
+    removeMemoryNode(DeltaNodes_, static_cast<const delta::node *>(&node));
+  else if (is<alloca_op>(&node))
+    removeMemoryNode(AllocaNodes_, &node);
+  else if (is<malloc_op>(&node))
+    removeMemoryNode(MallocNodes_, &node);
+}
+
 std::string
 PointsToGraph::ToDot(
     const PointsToGraph & pointsToGraph,
@@ -177,6 +432,7 @@ PointsToGraph::ToDot(
     static std::unordered_map<std::type_index, std::string> shapes(
         { { typeid(AllocaNode), "box" },
           { typeid(DeltaNode), "box" },
+          { typeid(FieldNode), "box" },
           { typeid(ImportNode), "box" },
           { typeid(LambdaNode), "box" },
           { typeid(MallocNode), "box" },
@@ -192,10 +448,19 @@ PointsToGraph::ToDot(
 
   auto nodeLabel = [&](const PointsToGraph::Node & node)
   {
-    // If the node is a RegisterNode, and has a name mapped to its rvsdg::output, include that name
+    // If the node is a RegisterNode, and has names mapped to its rvsdg::outputs, include them
     if (const auto registerNode = dynamic_cast<const RegisterNode *>(&node))
-      if (const auto it = outputMap.find(&registerNode->GetOutput()); it != outputMap.end())
-        return util::strfmt(node.DebugString(), " (", it->second, ")");
+    {
+      std::string names;
+      for (auto output : registerNode->GetOutputs().Items())
+      {
+        if (const auto it = outputMap.find(output); it != outputMap.end())
+          names += names.empty() ? it->second : util::strfmt(", ", it->second);
+      }
+
+      if (!names.empty())
+        return util::strfmt(node.DebugString(), " (", names, ")");
+    }
 
     // Otherwise the label is just the DebugString.
     return node.DebugString();
@@ -242,6 +507,9 @@ PointsToGraph::ToDot(
   for (auto & deltaNode : pointsToGraph.DeltaNodes())
     dot += printNodeAndEdges(deltaNode);
 
+  for (auto & fieldNode : pointsToGraph.FieldNodes())
+    dot += printNodeAndEdges(fieldNode);
+
   for (auto & importNode : pointsToGraph.ImportNodes())
     dot += printNodeAndEdges(importNode);
 
@@ -267,25 +535,29 @@ PointsToGraph::Node::~Node() noexcept = default;
 PointsToGraph::Node::TargetRange
 PointsToGraph::Node::Targets()
 {
-  return { TargetIterator(Targets_.begin()), TargetIterator(Targets_.end()) };
+  return { TargetIterator(Graph(), Targets_.Items().begin()),
+           TargetIterator(Graph(), Targets_.Items().end()) };
 }
 
 PointsToGraph::Node::TargetConstRange
 PointsToGraph::Node::Targets() const
 {
-  return { TargetConstIterator(Targets_.begin()), TargetConstIterator(Targets_.end()) };
+  return { TargetConstIterator(Graph(), Targets_.Items().begin()),
+           TargetConstIterator(Graph(), Targets_.Items().end()) };
 }
 
 PointsToGraph::Node::SourceRange
 PointsToGraph::Node::Sources()
 {
-  return { SourceIterator(Sources_.begin()), SourceIterator(Sources_.end()) };
+  return { SourceIterator(Graph(), Sources_.Items().begin()),
+           SourceIterator(Graph(), Sources_.Items().end()) };
 }
 
 PointsToGraph::Node::SourceConstRange
 PointsToGraph::Node::Sources() const
 {
-  return { SourceConstIterator(Sources_.begin()), SourceConstIterator(Sources_.end()) };
+  return { SourceConstIterator(Graph(), Sources_.Items().begin()),
+           SourceConstIterator(Graph(), Sources_.Items().end()) };
 }
 
 void
@@ -294,8 +566,8 @@ PointsToGraph::Node::AddEdge(PointsToGraph::MemoryNode & target)
   if (&Graph() != &target.Graph())
     throw util::error("Points-to graph nodes are not in the same graph.");
 
-  Targets_.insert(&target);
-  target.Sources_.insert(this);
+  Targets_.Insert(target.GetIndex());
+  target.Sources_.Insert(GetIndex());
 }
 
 void
@@ -304,8 +576,8 @@ PointsToGraph::Node::RemoveEdge(PointsToGraph::MemoryNode & target)
   if (&Graph() != &target.Graph())
     throw util::error("Points-to graph nodes are not in the same graph.");
 
-  target.Sources_.erase(this);
-  Targets_.erase(&target);
+  target.Sources_.Remove(GetIndex());
+  Targets_.Remove(target.GetIndex());
 }
 
 PointsToGraph::RegisterNode::~RegisterNode() noexcept = default;
@@ -313,22 +585,31 @@ PointsToGraph::RegisterNode::~RegisterNode() noexcept = default;
 std::string
 PointsToGraph::RegisterNode::DebugString() const
 {
-  auto node = jlm::rvsdg::node_output::node(&GetOutput());
+  auto debugString = [](const jlm::rvsdg::output & output) -> std::string
+  {
+    auto node = jlm::rvsdg::node_output::node(&output);
 
-  if (node != nullptr)
-    return util::strfmt(node->operation().debug_string(), ":o", GetOutput().index());
+    if (node != nullptr)
+      return util::strfmt(node->operation().debug_string(), ":o", output.index());
 
-  node = GetOutput().region()->node();
-  if (node != nullptr)
-    return util::strfmt(node->operation().debug_string(), ":a", GetOutput().index());
+    node = output.region()->node();
+    if (node != nullptr)
+      return util::strfmt(node->operation().debug_string(), ":a", output.index());
 
-  if (is_import(&GetOutput()))
-  {
-    auto port = util::AssertedCast<const impport>(&GetOutput().port());
-    return util::strfmt("import:", port->name());
-  }
+    if (is_import(&output))
+    {
+      auto port = util::AssertedCast<const impport>(&output.port());
+      return util::strfmt("import:", port->name());
+    }
+
+    return "RegisterNode";
+  };
 
-  return "RegisterNode";
+  std::string debugStrings;
+  for (auto output : GetOutputs().Items())
+    debugStrings += debugStrings.empty() ? debugString(*output) : ", " + debugString(*output);
+
+  return debugStrings;
 }
 
 PointsToGraph::MemoryNode::~MemoryNode() noexcept = default;
@@ -349,6 +630,14 @@ PointsToGraph::DeltaNode::DebugString() const
   return GetDeltaNode().operation().debug_string();
 }
 
+PointsToGraph::FieldNode::~FieldNode() noexcept = default;
+
+std::string
+PointsToGraph::FieldNode::DebugString() const
+{
+  return util::strfmt(GetObject().DebugString(), "+", GetOffset());
+}
+
 PointsToGraph::LambdaNode::~LambdaNode() noexcept = default;
 
 std::string
@@ -12,11 +12,13 @@
 #include <jlm/util/common.hpp>
 #include <jlm/util/HashSet.hpp>
 #include <jlm/util/iterator_range.hpp>
+#include <jlm/util/SparseBitVector.hpp>
 
+#include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
-#include <unordered_set>
+#include <vector>
 
 namespace jlm::llvm
 {
@@ -28,6 +30,11 @@ namespace aa
 
 /** /brief PointsTo Graph
  *
+ * The nodes of the graph are numbered densely in the order of their creation, and the targets and
+ * sources of a node are stored as sparse bit vectors over these indices. A register node
+ * represents all RVSDG outputs that point to the same memory nodes, such that the number of
+ * register nodes is bound by the number of distinct points-to sets rather than the number of
+ * pointer-typed outputs.
  */
 class PointsToGraph final
 {
@@ -40,6 +47,7 @@ class PointsToGraph final
 public:
   class AllocaNode;
   class DeltaNode;
+  class FieldNode;
   class ImportNode;
   class LambdaNode;
   class MallocNode;
@@ -53,14 +61,19 @@ public:
       std::unordered_map<const jlm::rvsdg::node *, std::unique_ptr<PointsToGraph::AllocaNode>>;
   using DeltaNodeMap =
       std::unordered_map<const delta::node *, std::unique_ptr<PointsToGraph::DeltaNode>>;
+  // Field nodes are keyed by the index of their object and their offset, such that they are
+  // iterated in a deterministic order and the fields of an object are adjacent.
+  using FieldNodeMap =
+      std::map<std::pair<size_t, size_t>, std::unique_ptr<PointsToGraph::FieldNode>>;
   using ImportNodeMap =
       std::unordered_map<const jlm::rvsdg::argument *, std::unique_ptr<PointsToGraph::ImportNode>>;
   using LambdaNodeMap =
       std::unordered_map<const lambda::node *, std::unique_ptr<PointsToGraph::LambdaNode>>;
   using MallocNodeMap =
       std::unordered_map<const jlm::rvsdg::node *, std::unique_ptr<PointsToGraph::MallocNode>>;
-  using RegisterNodeMap =
-      std::unordered_map<const jlm::rvsdg::output *, std::unique_ptr<PointsToGraph::RegisterNode>>;
+  using RegisterNodeMap = std::unordered_map<
+      const PointsToGraph::RegisterNode *,
+      std::unique_ptr<PointsToGraph::RegisterNode>>;
 
   using AllocaNodeIterator = NodeIterator<AllocaNode, AllocaNodeMap::iterator>;
   using AllocaNodeConstIterator = NodeConstIterator<AllocaNode, AllocaNodeMap::const_iterator>;
@@ -72,6 +85,11 @@ public:
   using DeltaNodeRange = jlm::util::iterator_range<DeltaNodeIterator>;
   using DeltaNodeConstRange = jlm::util::iterator_range<DeltaNodeConstIterator>;
 
+  using FieldNodeIterator = NodeIterator<FieldNode, FieldNodeMap::iterator>;
+  using FieldNodeConstIterator = NodeConstIterator<FieldNode, FieldNodeMap::const_iterator>;
+  using FieldNodeRange = jlm::util::iterator_range<FieldNodeIterator>;
+  using FieldNodeConstRange = jlm::util::iterator_range<FieldNodeConstIterator>;
+
   using ImportNodeIterator = NodeIterator<ImportNode, ImportNodeMap::iterator>;
   using ImportNodeConstIterator = NodeConstIterator<ImportNode, ImportNodeMap::const_iterator>;
   using ImportNodeRange = jlm::util::iterator_range<ImportNodeIterator>;
@@ -119,6 +137,21 @@ public:
   DeltaNodeConstRange
   DeltaNodes() const;
 
+  FieldNodeRange
+  FieldNodes();
+
+  FieldNodeConstRange
+  FieldNodes() const;
+
+  /**
+   * @return The field nodes of \p object ordered by their offset.
+   */
+  FieldNodeRange
+  GetFieldNodes(const PointsToGraph::MemoryNode & object);
+
+  FieldNodeConstRange
+  GetFieldNodes(const PointsToGraph::MemoryNode & object) const;
+
   ImportNodeRange
   ImportNodes();
 
@@ -155,6 +188,12 @@ public:
     return DeltaNodes_.size();
   }
 
+  size_t
+  NumFieldNodes() const noexcept
+  {
+    return FieldNodes_.size();
+  }
+
   size_t
   NumImportNodes() const noexcept
   {
@@ -173,8 +212,26 @@ public:
     return MallocNodes_.size();
   }
 
+  /**
+   * @return The number of RVSDG outputs that are mapped to a register node. A register node that
+   * is shared by several outputs is counted once per output.
+   *
+   * @see NumUniqueRegisterNodes()
+   */
   size_t
   NumRegisterNodes() const noexcept
+  {
+    return OutputRegisterNodes_.size();
+  }
+
+  /**
+   * @return The number of distinct register nodes, i.e., the number of nodes returned by
+   * RegisterNodes().
+   *
+   * @see NumRegisterNodes()
+   */
+  size_t
+  NumUniqueRegisterNodes() const noexcept
   {
     return RegisterNodes_.size();
   }
@@ -182,8 +239,8 @@ public:
   size_t
   NumMemoryNodes() const noexcept
   {
-    return NumAllocaNodes() + NumDeltaNodes() + NumImportNodes() + NumLambdaNodes()
-         + NumMallocNodes() + 1; // External memory node
+    return NumAllocaNodes() + NumDeltaNodes() + NumFieldNodes() + NumImportNodes()
+         + NumLambdaNodes() + NumMallocNodes() + 1; // External memory node
   }
 
   size_t
@@ -224,6 +281,9 @@ public:
     return *it->second;
   }
 
+  const PointsToGraph::FieldNode &
+  GetFieldNode(const PointsToGraph::MemoryNode & object, size_t offset) const;
+
   const PointsToGraph::ImportNode &
   GetImportNode(const jlm::rvsdg::argument & argument) const
   {
@@ -254,16 +314,32 @@ public:
     return *it->second;
   }
 
+  /**
+   * Returns the register node of \p output. Outputs with the same targets can share a single
+   * register node.
+   *
+   * @param output An RVSDG output of pointer type.
+   * @return The register node of \p output.
+   */
   const PointsToGraph::RegisterNode &
   GetRegisterNode(const jlm::rvsdg::output & output) const
   {
-    auto it = RegisterNodes_.find(&output);
-    if (it == RegisterNodes_.end())
+    auto it = OutputRegisterNodes_.find(&output);
+    if (it == OutputRegisterNodes_.end())
       throw jlm::util::error("Cannot find register node in points-to graph.");
 
     return *it->second;
   }
 
+  /**
+   * Returns the memory node with index \p index.
+   *
+   * @param index The index of a memory node as returned by PointsToGraph::Node::GetIndex().
+   * @return The memory node with index \p index.
+   */
+  const PointsToGraph::MemoryNode &
+  GetMemoryNode(size_t index) const;
+
   /**
    * Returns all memory nodes that are marked as escaped from the module.
    *
@@ -283,6 +359,9 @@ public:
   PointsToGraph::DeltaNode &
   AddDeltaNode(std::unique_ptr<PointsToGraph::DeltaNode> node);
 
+  PointsToGraph::FieldNode &
+  AddFieldNode(std::unique_ptr<PointsToGraph::FieldNode> node);
+
   PointsToGraph::LambdaNode &
   AddLambdaNode(std::unique_ptr<PointsToGraph::LambdaNode> node);
 
@@ -295,6 +374,41 @@ public:
   PointsToGraph::ImportNode &
   AddImportNode(std::unique_ptr<PointsToGraph::ImportNode> node);
 
+  /**
+   * Updates the points-to graph for an RVSDG output \p copy that was created as a copy of the
+   * output \p original. The register node of \p copy receives all targets of the register node of
+   * \p original. If \p original is the result of an alloca or malloc node, then the memory node of
+   * the copied node mirrors the memory node of the original node, i.e., it has the same targets,
+   * sources, and field nodes, and it escapes the module if the original escapes.
+   *
+   * Outputs of \p original that are not represented in the points-to graph are ignored.
+   *
+   * @param original The RVSDG output that was copied.
+   * @param copy The copy of \p original.
+   */
+  void
+  AddCopy(const rvsdg::output & original, const rvsdg::output & copy);
+
+  /**
+   * Removes \p output from the points-to graph before it is destroyed, i.e., removes \p output
+   * from its register node and the import node of \p output along with its field nodes. Register
+   * nodes that represent no other outputs are removed as well.
+   *
+   * @param output The RVSDG output that is about to be destroyed.
+   */
+  void
+  RemoveOutput(const rvsdg::output & output);
+
+  /**
+   * Removes the memory node of the alloca, malloc, lambda, or delta node \p node along with its
+   * field nodes. Nothing is removed for all other nodes. The node is identified by its operation,
+   * such that this method can be invoked from the on_node_destroy notifier.
+   *
+   * @param node The RVSDG node that is destroyed.
+   */
+  void
+  RemoveRvsdgNode(const rvsdg::node & node);
+
   /**
    * Creates a GraphViz description of the given \p pointsToGraph,
    * including the names given to rvsdg::outputs by the \p outputMap,
@@ -330,6 +444,32 @@ private:
   void
   AddEscapedMemoryNode(PointsToGraph::MemoryNode & memoryNode);
 
+  void
+  MirrorMemoryNode(const PointsToGraph::MemoryNode & original, PointsToGraph::MemoryNode & copy);
+
+  void
+  RemoveNode(PointsToGraph::Node & node);
+
+  /**
+   * Removes \p memoryNode and all its field nodes. The caller is responsible for erasing
+   * \p memoryNode from its node map.
+   */
+  void
+  RemoveMemoryNode(PointsToGraph::MemoryNode & memoryNode);
+
+  /**
+   * Removes \p output from its register node, and removes the register node if it represents no
+   * other outputs.
+   */
+  void
+  UnmapRegister(const jlm::rvsdg::output & output);
+
+  /**
+   * All nodes of the graph, indexed by PointsToGraph::Node::GetIndex(). The entries of removed
+   * nodes are null.
+   */
+  std::vector<PointsToGraph::Node *> Nodes_;
+
   /**
    * All memory nodes that escape from the module.
    */
@@ -337,10 +477,13 @@ private:
 
   AllocaNodeMap AllocaNodes_;
   DeltaNodeMap DeltaNodes_;
+  FieldNodeMap FieldNodes_;
   ImportNodeMap ImportNodes_;
   LambdaNodeMap LambdaNodes_;
   MallocNodeMap MallocNodes_;
   RegisterNodeMap RegisterNodes_;
+  std::unordered_map<const jlm::rvsdg::output *, PointsToGraph::RegisterNode *>
+      OutputRegisterNodes_;
   std::unique_ptr<PointsToGraph::UnknownMemoryNode> UnknownMemoryNode_;
   std::unique_ptr<ExternalMemoryNode> ExternalMemoryNode_;
 };
@@ -371,8 +514,11 @@ public:
   virtual ~Node() noexcept;
 
   explicit Node(PointsToGraph & pointsToGraph)
-      : PointsToGraph_(&pointsToGraph)
-  {}
+      : PointsToGraph_(&pointsToGraph),
+        Index_(pointsToGraph.Nodes_.size())
+  {
+    pointsToGraph.Nodes_.push_back(this);
+  }
 
   Node(const Node &) = delete;
 
@@ -402,16 +548,34 @@ public:
     return *PointsToGraph_;
   }
 
+  /**
+   * @return The dense index of the node within its points-to graph.
+   */
+  [[nodiscard]] size_t
+  GetIndex() const noexcept
+  {
+    return Index_;
+  }
+
+  /**
+   * @return The indices of the targets of the node.
+   */
+  [[nodiscard]] const jlm::util::SparseBitVector &
+  GetTargetIndices() const noexcept
+  {
+    return Targets_;
+  }
+
   size_t
   NumTargets() const noexcept
   {
-    return Targets_.size();
+    return Targets_.Size();
   }
 
   size_t
   NumSources() const noexcept
   {
-    return Sources_.size();
+    return Sources_.Size();
   }
 
   virtual std::string
@@ -436,12 +600,21 @@ public:
 
 private:
   PointsToGraph * PointsToGraph_;
-  std::unordered_set<PointsToGraph::MemoryNode *> Targets_;
-  std::unordered_set<PointsToGraph::Node *> Sources_;
+  size_t Index_;
+  jlm::util::SparseBitVector Targets_;
+  jlm::util::SparseBitVector Sources_;
+  friend PointsToGraph;
 };
 
 /** \brief PointsTo graph register node
  *
+ * A register node represents a set of RVSDG outputs that all point to the targets of the node.
+ * Adding or removing an edge of a register node therefore changes the targets of all its outputs.
+ * An analysis must only share a register node among outputs whose targets are identical in the
+ * final graph, and must not modify the edges of a shared register node on behalf of one of its
+ * outputs.
+ *
+ * @see GetOutputs()
  */
 class PointsToGraph::RegisterNode final : public PointsToGraph::Node
 {
@@ -449,16 +622,20 @@ public:
   ~RegisterNode() noexcept override;
 
 private:
-  RegisterNode(PointsToGraph & pointsToGraph, const jlm::rvsdg::output & output)
+  RegisterNode(PointsToGraph & pointsToGraph, util::HashSet<const jlm::rvsdg::output *> outputs)
       : Node(pointsToGraph),
-        Output_(&output)
+        Outputs_(std::move(outputs))
   {}
 
 public:
-  const jlm::rvsdg::output &
-  GetOutput() const noexcept
+  /**
+   * @return The RVSDG outputs represented by the register node. All of them point to the targets
+   * of the node.
+   */
+  const util::HashSet<const jlm::rvsdg::output *> &
+  GetOutputs() const noexcept
   {
-    return *Output_;
+    return Outputs_;
   }
 
   std::string
@@ -467,13 +644,21 @@ public:
   static PointsToGraph::RegisterNode &
   Create(PointsToGraph & pointsToGraph, const jlm::rvsdg::output & output)
   {
-    auto node =
-        std::unique_ptr<PointsToGraph::RegisterNode>(new RegisterNode(pointsToGraph, output));
+    return Create(pointsToGraph, util::HashSet<const jlm::rvsdg::output *>({ &output }));
+  }
+
+  static PointsToGraph::RegisterNode &
+  Create(PointsToGraph & pointsToGraph, util::HashSet<const jlm::rvsdg::output *> outputs)
+  {
+    auto node = std::unique_ptr<PointsToGraph::RegisterNode>(
+        new RegisterNode(pointsToGraph, std::move(outputs)));
     return pointsToGraph.AddRegisterNode(std::move(node));
   }
 
 private:
-  const jlm::rvsdg::output * Output_;
+  util::HashSet<const jlm::rvsdg::output *> Outputs_;
+
+  friend PointsToGraph;
 };
 
 /** \brief PointsTo graph memory node
@@ -647,6 +832,56 @@ private:
   const lambda::node * LambdaNode_;
 };
 
+/** \brief PointsTo graph field node
+ *
+ * Represents the field at a constant byte offset of another memory node. Field nodes are only
+ * created by field-sensitive analyses, and the memory node of the object itself then represents
+ * the memory at offset zero.
+ */
+class PointsToGraph::FieldNode final : public PointsToGraph::MemoryNode
+{
+public:
+  ~FieldNode() noexcept override;
+
+private:
+  FieldNode(PointsToGraph & pointsToGraph, const PointsToGraph::MemoryNode & object, size_t offset)
+      : MemoryNode(pointsToGraph),
+        Object_(&object),
+        Offset_(offset)
+  {
+    JLM_ASSERT(!Is<FieldNode>(object));
+    JLM_ASSERT(offset != 0);
+  }
+
+public:
+  const PointsToGraph::MemoryNode &
+  GetObject() const noexcept
+  {
+    return *Object_;
+  }
+
+  size_t
+  GetOffset() const noexcept
+  {
+    return Offset_;
+  }
+
+  std::string
+  DebugString() const override;
+
+  static PointsToGraph::FieldNode &
+  Create(PointsToGraph & pointsToGraph, const PointsToGraph::MemoryNode & object, size_t offset)
+  {
+    auto n =
+        std::unique_ptr<PointsToGraph::FieldNode>(new FieldNode(pointsToGraph, object, offset));
+    return pointsToGraph.AddFieldNode(std::move(n));
+  }
+
+private:
+  const PointsToGraph::MemoryNode * Object_;
+  size_t Offset_;
+};
+
 /** \brief PointsTo graph import node
  *
  */
@@ -889,15 +1124,16 @@ public:
 private:
   friend PointsToGraph::Node;
 
-  explicit Iterator(const typename std::unordered_set<NODETYPE *>::iterator & it)
-      : It_(it)
+  Iterator(const PointsToGraph & pointsToGraph, const util::SparseBitVector::ItemConstIterator & it)
+      : PointsToGraph_(&pointsToGraph),
+        It_(it)
   {}
 
 public:
   [[nodiscard]] NODETYPE *
   GetNode() const noexcept
   {
-    return *It_;
+    return static_cast<NODETYPE *>(PointsToGraph_->Nodes_[*It_]);
   }
 
   NODETYPE &
@@ -941,7 +1177,8 @@ public:
   }
 
 private:
-  typename std::unordered_set<NODETYPE *>::iterator It_;
+  const PointsToGraph * PointsToGraph_;
+  util::SparseBitVector::ItemConstIterator It_;
 };
 
 /** \brief Points-to graph edge const iterator
@@ -957,17 +1194,20 @@ public:
   using reference = const NODETYPE *&;
 
 private:
-  friend PointsToGraph;
+  friend PointsToGraph::Node;
 
-  explicit ConstIterator(const typename std::unordered_set<NODETYPE *>::const_iterator & it)
-      : It_(it)
+  ConstIterator(
+      const PointsToGraph & pointsToGraph,
+      const util::SparseBitVector::ItemConstIterator & it)
+      : PointsToGraph_(&pointsToGraph),
+        It_(it)
   {}
 
 public:
   [[nodiscard]] const NODETYPE *
   GetNode() const noexcept
   {
-    return *It_;
+    return static_cast<const NODETYPE *>(PointsToGraph_->Nodes_[*It_]);
   }
 
   const NODETYPE &
@@ -1011,7 +1251,8 @@ public:
   }
 
 private:
-  typename std::unordered_set<NODETYPE *>::const_iterator It_;
+  const PointsToGraph * PointsToGraph_;
+  util::SparseBitVector::ItemConstIterator It_;
 };
 
 }
@@ -0,0 +1,184 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/llvm/ir/CallGraphIndex.hpp>
+#include <jlm/llvm/ir/operators/lambda.hpp>
+#include <jlm/llvm/opt/alias-analyses/AliasAnalysis.hpp>
+#include <jlm/llvm/opt/alias-analyses/PointsToGraph.hpp>
+#include <jlm/llvm/opt/alias-analyses/PointsToGraphCache.hpp>
+#include <jlm/rvsdg/notifiers.hpp>
+#include <jlm/rvsdg/structural-node.hpp>
+
+namespace jlm::llvm::aa
+{
+
+PointsToGraphCache::~PointsToGraphCache() noexcept = default;
+
+PointsToGraphCache::PointsToGraphCache() = default;
+
+/**
+ * @return The lambda node that contains \p region, or nullptr if \p region is not contained in a
+ * lambda node.
+ */
+static const lambda::node *
+GetLambdaNode(const jlm::rvsdg::region & region)
+{
+  for (auto r = &region; r->node() != nullptr; r = r->node()->region())
+  {
+    if (auto lambdaNode = dynamic_cast<const lambda::node *>(r->node()))
+      return lambdaNode;
+  }
+
+  return nullptr;
+}
+
+void
+PointsToGraphCache::OutputCopied(
+    const jlm::rvsdg::output & original,
+    const jlm::rvsdg::output & copy)
+{
+  std::lock_guard<std::mutex> guard(Mutex_);
+  if (!PointsToGraph_)
+    return;
+
+  PointsToGraph_->AddCopy(original, copy);
+
+  // The copy of an output of an invalidated lambda node can depend on outputs that are unknown to
+  // the points-to graph, and the lambda node of the copy is therefore invalidated as well.
+  auto originalLambdaNode = GetLambdaNode(*original.region());
+  if (originalLambdaNode && InvalidatedLambdas_.Contains(originalLambdaNode))
+  {
+    if (auto copyLambdaNode = GetLambdaNode(*copy.region()))
+      InvalidatedLambdas_.Insert(copyLambdaNode);
+  }
+}
+
+void
+PointsToGraphCache::LambdaInvalidated(const lambda::node & lambdaNode)
+{
+  std::lock_guard<std::mutex> guard(Mutex_);
+  if (PointsToGraph_)
+    InvalidatedLambdas_.Insert(&lambdaNode);
+}
+
+void
+PointsToGraphCache::ModuleInvalidated()
+{
+  std::lock_guard<std::mutex> guard(Mutex_);
+  Callbacks_.clear();
+  InvalidatedLambdas_.Clear();
+  PointsToGraph_.reset();
+}
+
+void
+PointsToGraphCache::Connect(jlm::rvsdg::region & region)
+{
+  auto & notifiers = region.GetNotifiers();
+  auto & callbacks = Callbacks_[&region];
+
+  // The notifiers of a region are invoked concurrently to the notifiers of other regions if
+  // functions are optimized in parallel, and all callbacks therefore synchronize on the mutex.
+  callbacks.push_back(notifiers.on_output_destroy.connect(
+      [this](jlm::rvsdg::output * output)
+      {
+        std::lock_guard<std::mutex> guard(Mutex_);
+        PointsToGraph_->RemoveOutput(*output);
+      }));
+  callbacks.push_back(notifiers.on_node_destroy.connect(
+      [this](jlm::rvsdg::node * node)
+      {
+        std::lock_guard<std::mutex> guard(Mutex_);
+        RemoveNode(*node);
+      }));
+
+  callbacks.push_back(notifiers.on_region_create.connect(
+      [this](jlm::rvsdg::region * subregion)
+      {
+        std::lock_guard<std::mutex> guard(Mutex_);
+        Connect(*subregion);
+      }));
+  callbacks.push_back(notifiers.on_region_destroy.connect(
+      [this](jlm::rvsdg::region * subregion)
+      {
+        std::lock_guard<std::mutex> guard(Mutex_);
+        Disconnect(*subregion);
+      }));
+
+  for (auto & node : region.nodes)
+  {
+    if (auto structuralNode = dynamic_cast<jlm::rvsdg::structural_node *>(&node))
+    {
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+        Connect(*structuralNode->subregion(n));
+    }
+  }
+}
+
+void
+PointsToGraphCache::Disconnect(const jlm::rvsdg::region & region)
+{
+  for (auto & node : region.nodes)
+  {
+    if (auto structuralNode = dynamic_cast<const jlm::rvsdg::structural_node *>(&node))
+    {
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+        Disconnect(*structuralNode->subregion(n));
+    }
+
+    RemoveNode(node);
+  }
+
+  for (size_t n = 0; n < region.narguments(); n++)
+    PointsToGraph_->RemoveOutput(*region.argument(n));
+
+  Callbacks_.erase(&region);
+}
+
+void
+PointsToGraphCache::RemoveNode(const jlm::rvsdg::node & node)
+{
+  // The outputs of the node are destroyed after the node is reported as destroyed
+  for (size_t n = 0; n < node.noutputs(); n++)
+    PointsToGraph_->RemoveOutput(*node.output(n));
+
+  PointsToGraph_->RemoveRvsdgNode(node);
+
+  // The node is reported from the destructor of jlm::rvsdg::structural_node, where a dynamic_cast
+  // no longer yields lambda nodes.
+  if (is<lambda::operation>(&node))
+    InvalidatedLambdas_.Remove(static_cast<const lambda::node *>(&node));
+}
+
+PointsToGraph &
+PointsToGraphCache::GetPointsToGraph(
+    RvsdgModule & rvsdgModule,
+    AliasAnalysis & aliasAnalysis,
+    const std::string & analysisName,
+    jlm::util::StatisticsCollector & statisticsCollector)
+{
+  auto cache = rvsdgModule.GetObserver<PointsToGraphCache>();
+  if (cache == nullptr)
+  {
+    cache = static_cast<PointsToGraphCache *>(
+        &rvsdgModule.AddObserver(std::make_unique<PointsToGraphCache>()));
+  }
+
+  std::lock_guard<std::mutex> guard(cache->Mutex_);
+  if (cache->IsValid() && cache->AnalysisName_ == analysisName)
+    return *cache->PointsToGraph_;
+
+  cache->Callbacks_.clear();
+  cache->InvalidatedLambdas_.Clear();
+
+  // The analyses query the call summaries of all lambda nodes
+  CallGraphIndex::GetOrCreate(rvsdgModule);
+  cache->PointsToGraph_ = aliasAnalysis.Analyze(rvsdgModule, statisticsCollector);
+  cache->AnalysisName_ = analysisName;
+  cache->Connect(*rvsdgModule.Rvsdg().root());
+
+  return *cache->PointsToGraph_;
+}
+
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_LLVM_OPT_ALIAS_ANALYSES_POINTSTOGRAPHCACHE_HPP
+#define JLM_LLVM_OPT_ALIAS_ANALYSES_POINTSTOGRAPHCACHE_HPP
+
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+
+#include <jlm/util/callbacks.hpp>
+#include <jlm/util/HashSet.hpp>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace jlm::util
+{
+class StatisticsCollector;
+}
+
+namespace jlm::llvm::aa
+{
+
+class AliasAnalysis;
+class PointsToGraph;
+
+/** \brief Keeps the points-to graph of an RVSDG module valid across optimizations
+ *
+ * The cache observes the modifications of an RVSDG module and updates its points-to graph for all
+ * outputs that optimizations report as copies. It is connected to the notifiers of all regions of
+ * the module, and removes the points-to graph nodes of RVSDG outputs and nodes as they are
+ * destroyed. The points-to graph nodes are therefore never keyed by stale addresses.
+ *
+ * As the alias analyses are whole-program analyses, the points-to graph cannot be recomputed for
+ * a single function. Invalidated functions are recorded instead, and the graph is recomputed on
+ * the next request only if one of them is still part of the module. A function that is removed
+ * after its invalidation, e.g., after it was inlined into all its callers, therefore requires no
+ * recomputation.
+ *
+ * Optimizations that are run outside of an OptimizationSequence and do not report their
+ * modifications are required to invoke RvsdgModule::InvalidateAnalyses().
+ *
+ * @see RvsdgModuleObserver
+ */
+class PointsToGraphCache final : public RvsdgModuleObserver
+{
+public:
+  ~PointsToGraphCache() noexcept override;
+
+  PointsToGraphCache();
+
+  PointsToGraphCache(const PointsToGraphCache &) = delete;
+
+  PointsToGraphCache(PointsToGraphCache &&) = delete;
+
+  PointsToGraphCache &
+  operator=(const PointsToGraphCache &) = delete;
+
+  PointsToGraphCache &
+  operator=(PointsToGraphCache &&) = delete;
+
+  void
+  OutputCopied(const jlm::rvsdg::output & original, const jlm::rvsdg::output & copy) override;
+
+  void
+  LambdaInvalidated(const lambda::node & lambdaNode) override;
+
+  void
+  ModuleInvalidated() override;
+
+  /**
+   * @return True if the cache holds a valid points-to graph, otherwise false.
+   */
+  [[nodiscard]] bool
+  IsValid() const noexcept
+  {
+    return PointsToGraph_ != nullptr && InvalidatedLambdas_.Size() == 0;
+  }
+
+  /**
+   * @return The number of invalidated lambda nodes that are still part of the module.
+   */
+  [[nodiscard]] size_t
+  NumInvalidatedLambdas() const noexcept
+  {
+    return InvalidatedLambdas_.Size();
+  }
+
+  /**
+   * Returns the points-to graph of \p rvsdgModule that was computed by the analysis with the name
+   * \p analysisName. The graph is computed with \p aliasAnalysis if the module has no valid
+   * points-to graph of the analysis. Otherwise, the cached graph is returned.
+   *
+   * @param rvsdgModule The RVSDG module.
+   * @param aliasAnalysis The alias analysis used to compute the points-to graph.
+   * @param analysisName A name that uniquely identifies \p aliasAnalysis and its configuration.
+   * @param statisticsCollector Statistics collector for collecting analysis statistics.
+   *
+   * @return The points-to graph of \p rvsdgModule.
+   */
+  static PointsToGraph &
+  GetPointsToGraph(
+      RvsdgModule & rvsdgModule,
+      AliasAnalysis & aliasAnalysis,
+      const std::string & analysisName,
+      jlm::util::StatisticsCollector & statisticsCollector);
+
+private:
+  /**
+   * Connects the cache to the notifiers of \p region and all its subregions.
+   */
+  void
+  Connect(jlm::rvsdg::region & region);
+
+  /**
+   * Disconnects the cache from the notifiers of \p region and all its subregions, and removes the
+   * points-to graph nodes of their arguments and nodes. The nodes of a region are destroyed
+   * without notifying the cache once the region is disconnected.
+   */
+  void
+  Disconnect(const jlm::rvsdg::region & region);
+
+  /**
+   * Removes the points-to graph nodes of \p node and its outputs, and discards the invalidation of
+   * \p node.
+   */
+  void
+  RemoveNode(const jlm::rvsdg::node & node);
+
+  std::mutex Mutex_;
+  std::string AnalysisName_;
+  std::unique_ptr<PointsToGraph> PointsToGraph_;
+  util::HashSet<const lambda::node *> InvalidatedLambdas_;
+  std::unordered_map<const jlm::rvsdg::region *, std::vector<util::callback>> Callbacks_;
+};
+
+}
+
+#endif
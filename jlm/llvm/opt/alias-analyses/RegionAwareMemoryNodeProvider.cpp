@@ -9,7 +9,10 @@
 #include <jlm/llvm/ir/RvsdgModule.hpp>
 #include <jlm/llvm/opt/alias-analyses/RegionAwareMemoryNodeProvider.hpp>
 #include <jlm/rvsdg/traverser.hpp>
+#include <jlm/util/Parallel.hpp>
 
+#include <algorithm>
+#include <mutex>
 #include <typeindex>
 
 namespace jlm::llvm::aa
@@ -32,6 +35,19 @@ public:
   RegionSummary &
   operator=(RegionSummary &&) = delete;
 
+  /**
+   * @return The indices of the memory nodes of the region.
+   */
+  [[nodiscard]] const util::SparseBitVector &
+  GetMemoryNodeIndices() const noexcept
+  {
+    return MemoryNodeIndices_;
+  }
+
+  /**
+   * @return The memory nodes of the region. The set is only valid after MaterializeMemoryNodes()
+   * was invoked.
+   */
   const util::HashSet<const PointsToGraph::MemoryNode *> &
   GetMemoryNodes() const
   {
@@ -63,9 +79,26 @@ public:
   }
 
   void
-  AddMemoryNodes(const util::HashSet<const PointsToGraph::MemoryNode *> & memoryNodes)
+  AddMemoryNodes(const util::SparseBitVector & memoryNodeIndices)
   {
-    MemoryNodes_.UnionWith(memoryNodes);
+    MemoryNodeIndices_.UnionWith(memoryNodeIndices);
+  }
+
+  void
+  AddMemoryNode(const PointsToGraph::MemoryNode & memoryNode)
+  {
+    MemoryNodeIndices_.Insert(memoryNode.GetIndex());
+  }
+
+  /**
+   * Converts the memory node indices of the region to the set returned by GetMemoryNodes().
+   */
+  void
+  MaterializeMemoryNodes(const PointsToGraph & pointsToGraph)
+  {
+    MemoryNodes_.Clear();
+    for (auto index : MemoryNodeIndices_.Items())
+      MemoryNodes_.Insert(&pointsToGraph.GetMemoryNode(index));
   }
 
   void
@@ -107,7 +140,7 @@ public:
   static void
   Propagate(RegionSummary & dstSummary, const RegionSummary & srcSummary)
   {
-    dstSummary.AddMemoryNodes(srcSummary.GetMemoryNodes());
+    dstSummary.AddMemoryNodes(srcSummary.GetMemoryNodeIndices());
     dstSummary.AddUnknownMemoryNodeReferences(srcSummary.GetUnknownMemoryNodeReferences());
   }
 
@@ -119,6 +152,7 @@ public:
 
 private:
   const jlm::rvsdg::region * Region_;
+  util::SparseBitVector MemoryNodeIndices_;
   util::HashSet<const PointsToGraph::MemoryNode *> MemoryNodes_;
   util::HashSet<const jlm::rvsdg::simple_node *> UnknownMemoryNodeReferences_;
 
@@ -308,6 +342,13 @@ public:
     return memoryNodes;
   }
 
+  [[nodiscard]] const util::SparseBitVector &
+  GetOutputNodeIndices(const jlm::rvsdg::output & output) const
+  {
+    JLM_ASSERT(is<PointerType>(output.type()));
+    return PointsToGraph_.GetRegisterNode(output).GetTargetIndices();
+  }
+
   RegionSummaryConstRange
   GetRegionSummaries() const
   {
@@ -353,13 +394,39 @@ public:
     return *regionSummaryPointer;
   }
 
+  /**
+   * Associates \p memoryNodes with \p import if no memory nodes were associated with it yet. The
+   * method can be invoked concurrently.
+   */
   void
   AddExternalFunctionNodes(
       const jlm::rvsdg::argument & import,
       util::HashSet<const PointsToGraph::MemoryNode *> memoryNodes)
   {
-    JLM_ASSERT(!ContainsExternalFunctionNodes(import));
-    ExternalFunctionNodes_[&import] = std::move(memoryNodes);
+    std::lock_guard<std::mutex> guard(ExternalFunctionNodesMutex_);
+    if (!ContainsExternalFunctionNodes(import))
+      ExternalFunctionNodes_[&import] = std::move(memoryNodes);
+  }
+
+  /**
+   * Converts the memory node indices of all region summaries to memory node sets.
+   *
+   * @param numThreads The number of threads used for the conversion.
+   */
+  void
+  MaterializeMemoryNodes(size_t numThreads)
+  {
+    std::vector<RegionSummary *> regionSummaries;
+    for (auto & [region, regionSummary] : RegionSummaries_)
+      regionSummaries.push_back(regionSummary.get());
+
+    util::ParallelForEach(
+        regionSummaries,
+        numThreads,
+        [&](RegionSummary * regionSummary)
+        {
+          regionSummary->MaterializeMemoryNodes(PointsToGraph_);
+        });
   }
 
   static std::unique_ptr<RegionAwareMemoryNodeProvisioning>
@@ -393,13 +460,13 @@ public:
     auto CheckInvariantsCall = [&](auto & callNode)
     {
       auto & regionSummary = provisioning.GetRegionSummary(*callNode.region());
-      auto & regionMemoryNodes = regionSummary.GetMemoryNodes();
+      auto & regionMemoryNodes = regionSummary.GetMemoryNodeIndices();
       auto & regionUnknownMemoryNodeReferences = regionSummary.GetUnknownMemoryNodeReferences();
 
       auto callTypeClassifier = CallNode::ClassifyCall(callNode);
       auto & lambdaRegion = *callTypeClassifier->GetLambdaOutput().node()->subregion();
       auto & lambdaRegionSummary = provisioning.GetRegionSummary(lambdaRegion);
-      auto & lambdaRegionMemoryNodes = lambdaRegionSummary.GetMemoryNodes();
+      auto & lambdaRegionMemoryNodes = lambdaRegionSummary.GetMemoryNodeIndices();
       auto & lambdaRegionUnknownMemoryNodeReferences =
           lambdaRegionSummary.GetUnknownMemoryNodeReferences();
 
@@ -410,14 +477,14 @@ public:
     auto CheckInvariantsStructuralNode = [&](auto & structuralNode)
     {
       auto & regionSummary = provisioning.GetRegionSummary(*structuralNode.region());
-      auto & regionMemoryNodes = regionSummary.GetMemoryNodes();
+      auto & regionMemoryNodes = regionSummary.GetMemoryNodeIndices();
       auto & regionUnknownMemoryNodeReferences = regionSummary.GetUnknownMemoryNodeReferences();
 
       for (size_t n = 0; n < structuralNode.nsubregions(); n++)
       {
         auto & subregion = *structuralNode.subregion(n);
         auto & subregionSummary = provisioning.GetRegionSummary(subregion);
-        auto & subregionMemoryNodes = subregionSummary.GetMemoryNodes();
+        auto & subregionMemoryNodes = subregionSummary.GetMemoryNodeIndices();
         auto & subregionUnknownMemoryNodeReferences =
             subregionSummary.GetUnknownMemoryNodeReferences();
 
@@ -480,11 +547,18 @@ private:
   const PointsToGraph & PointsToGraph_;
   std::unordered_map<const jlm::rvsdg::argument *, util::HashSet<const PointsToGraph::MemoryNode *>>
       ExternalFunctionNodes_;
+  std::mutex ExternalFunctionNodesMutex_;
 };
 
 RegionAwareMemoryNodeProvider::~RegionAwareMemoryNodeProvider() noexcept = default;
 
-RegionAwareMemoryNodeProvider::RegionAwareMemoryNodeProvider() = default;
+RegionAwareMemoryNodeProvider::RegionAwareMemoryNodeProvider()
+    : RegionAwareMemoryNodeProvider(1)
+{}
+
+RegionAwareMemoryNodeProvider::RegionAwareMemoryNodeProvider(size_t numThreads)
+    : NumThreads_(std::max<size_t>(1, numThreads))
+{}
 
 std::unique_ptr<MemoryNodeProvisioning>
 RegionAwareMemoryNodeProvider::ProvisionMemoryNodes(
@@ -494,10 +568,11 @@ RegionAwareMemoryNodeProvider::ProvisionMemoryNodes(
 {
   Provisioning_ = RegionAwareMemoryNodeProvisioning::Create(pointsToGraph);
 
-  auto statistics = Statistics::Create(statisticsCollector, rvsdgModule, pointsToGraph);
+  auto statistics =
+      Statistics::Create(statisticsCollector, rvsdgModule, pointsToGraph, NumThreads_);
 
   statistics->StartAnnotationStatistics();
-  AnnotateRegion(*rvsdgModule.Rvsdg().root());
+  Annotate(rvsdgModule);
   statistics->StopAnnotationStatistics();
 
   statistics->StartPropagationPass1Statistics();
@@ -512,6 +587,10 @@ RegionAwareMemoryNodeProvider::ProvisionMemoryNodes(
   Propagate(rvsdgModule);
   statistics->StopPropagationPass2Statistics();
 
+  statistics->StartMaterializationStatistics();
+  Provisioning_->MaterializeMemoryNodes(NumThreads_);
+  statistics->StopMaterializationStatistics();
+
   statisticsCollector.CollectDemandedStatistics(std::move(statistics));
 
   return std::unique_ptr<MemoryNodeProvisioning>(Provisioning_.release());
@@ -521,9 +600,10 @@ std::unique_ptr<MemoryNodeProvisioning>
 RegionAwareMemoryNodeProvider::Create(
     const RvsdgModule & rvsdgModule,
     const PointsToGraph & pointsToGraph,
-    util::StatisticsCollector & statisticsCollector)
+    util::StatisticsCollector & statisticsCollector,
+    size_t numThreads)
 {
-  RegionAwareMemoryNodeProvider provider;
+  RegionAwareMemoryNodeProvider provider(numThreads);
   return provider.ProvisionMemoryNodes(rvsdgModule, pointsToGraph, statisticsCollector);
 }
 
@@ -537,7 +617,23 @@ RegionAwareMemoryNodeProvider::Create(
 }
 
 void
-RegionAwareMemoryNodeProvider::AnnotateRegion(jlm::rvsdg::region & region)
+RegionAwareMemoryNodeProvider::Annotate(const RvsdgModule & rvsdgModule)
+{
+  CreateRegionSummaries(*rvsdgModule.Rvsdg().root());
+
+  auto lambdaNodes = lambda::CollectLambdaNodes(*rvsdgModule.Rvsdg().root());
+
+  util::ParallelForEach(
+      lambdaNodes,
+      NumThreads_,
+      [&](const lambda::node * lambdaNode)
+      {
+        AnnotateRegion(*lambdaNode->subregion());
+      });
+}
+
+void
+RegionAwareMemoryNodeProvider::CreateRegionSummaries(const jlm::rvsdg::region & region)
 {
   auto shouldCreateRegionSummary = [](auto & region)
   {
@@ -553,13 +649,35 @@ RegionAwareMemoryNodeProvider::AnnotateRegion(jlm::rvsdg::region & region)
 
   for (auto & node : region.nodes)
   {
-    if (auto structuralNode = dynamic_cast<const jlm::rvsdg::structural_node *>(&node))
+    auto structuralNode = dynamic_cast<const jlm::rvsdg::structural_node *>(&node);
+    if (structuralNode == nullptr)
+      continue;
+
+    if (regionSummary)
     {
-      if (regionSummary)
-      {
-        regionSummary->AddStructuralNode(*structuralNode);
-      }
+      regionSummary->AddStructuralNode(*structuralNode);
+    }
 
+    /*
+     * Nothing needs to be done for delta nodes.
+     */
+    if (jlm::rvsdg::is<delta::operation>(structuralNode))
+      continue;
+
+    for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+    {
+      CreateRegionSummaries(*structuralNode->subregion(n));
+    }
+  }
+}
+
+void
+RegionAwareMemoryNodeProvider::AnnotateRegion(const jlm::rvsdg::region & region)
+{
+  for (auto & node : region.nodes)
+  {
+    if (auto structuralNode = dynamic_cast<const jlm::rvsdg::structural_node *>(&node))
+    {
       AnnotateStructuralNode(*structuralNode);
     }
     else if (auto simpleNode = dynamic_cast<const jlm::rvsdg::simple_node *>(&node))
@@ -620,13 +738,13 @@ RegionAwareMemoryNodeProvider::AnnotateSimpleNode(const jlm::rvsdg::simple_node
   if (nodes.find(typeid(operation)) == nodes.end())
     return;
 
-  nodes[typeid(operation)](*this, simpleNode);
+  nodes.at(typeid(operation))(*this, simpleNode);
 }
 
 void
 RegionAwareMemoryNodeProvider::AnnotateLoad(const LoadNode & loadNode)
 {
-  auto memoryNodes = Provisioning_->GetOutputNodes(*loadNode.GetAddressInput()->origin());
+  auto & memoryNodes = Provisioning_->GetOutputNodeIndices(*loadNode.GetAddressInput()->origin());
   auto & regionSummary = Provisioning_->GetRegionSummary(*loadNode.region());
   regionSummary.AddMemoryNodes(memoryNodes);
 }
@@ -634,7 +752,7 @@ RegionAwareMemoryNodeProvider::AnnotateLoad(const LoadNode & loadNode)
 void
 RegionAwareMemoryNodeProvider::AnnotateStore(const StoreNode & storeNode)
 {
-  auto memoryNodes = Provisioning_->GetOutputNodes(*storeNode.GetAddressInput()->origin());
+  auto & memoryNodes = Provisioning_->GetOutputNodeIndices(*storeNode.GetAddressInput()->origin());
   auto & regionSummary = Provisioning_->GetRegionSummary(*storeNode.region());
   regionSummary.AddMemoryNodes(memoryNodes);
 }
@@ -644,9 +762,14 @@ RegionAwareMemoryNodeProvider::AnnotateAlloca(const jlm::rvsdg::simple_node & al
 {
   JLM_ASSERT(jlm::rvsdg::is<alloca_op>(allocaNode.operation()));
 
-  auto & memoryNode = Provisioning_->GetPointsToGraph().GetAllocaNode(allocaNode);
+  auto & pointsToGraph = Provisioning_->GetPointsToGraph();
+  auto & memoryNode = pointsToGraph.GetAllocaNode(allocaNode);
   auto & regionSummary = Provisioning_->GetRegionSummary(*allocaNode.region());
-  regionSummary.AddMemoryNodes({ &memoryNode });
+  regionSummary.AddMemoryNode(memoryNode);
+
+  // The fields of the memory are allocated along with it
+  for (auto & fieldNode : pointsToGraph.GetFieldNodes(memoryNode))
+    regionSummary.AddMemoryNode(fieldNode);
 }
 
 void
@@ -654,9 +777,14 @@ RegionAwareMemoryNodeProvider::AnnotateMalloc(const jlm::rvsdg::simple_node & ma
 {
   JLM_ASSERT(jlm::rvsdg::is<malloc_op>(mallocNode.operation()));
 
-  auto & memoryNode = Provisioning_->GetPointsToGraph().GetMallocNode(mallocNode);
+  auto & pointsToGraph = Provisioning_->GetPointsToGraph();
+  auto & memoryNode = pointsToGraph.GetMallocNode(mallocNode);
   auto & regionSummary = Provisioning_->GetRegionSummary(*mallocNode.region());
-  regionSummary.AddMemoryNodes({ &memoryNode });
+  regionSummary.AddMemoryNode(memoryNode);
+
+  // The fields of the memory are allocated along with it
+  for (auto & fieldNode : pointsToGraph.GetFieldNodes(memoryNode))
+    regionSummary.AddMemoryNode(fieldNode);
 }
 
 void
@@ -664,7 +792,7 @@ RegionAwareMemoryNodeProvider::AnnotateFree(const jlm::rvsdg::simple_node & free
 {
   JLM_ASSERT(jlm::rvsdg::is<free_op>(freeNode.operation()));
 
-  auto memoryNodes = Provisioning_->GetOutputNodes(*freeNode.input(0)->origin());
+  auto & memoryNodes = Provisioning_->GetOutputNodeIndices(*freeNode.input(0)->origin());
   auto & regionSummary = Provisioning_->GetRegionSummary(*freeNode.region());
   regionSummary.AddMemoryNodes(memoryNodes);
 }
@@ -701,19 +829,16 @@ RegionAwareMemoryNodeProvider::AnnotateCall(const CallNode & callNode)
 
     auto & import = callTypeClassifier.GetImport();
     auto & regionSummary = provider.Provisioning_->GetRegionSummary(*callNode.region());
-    regionSummary.AddMemoryNodes(memoryNodes);
-    if (!provider.Provisioning_->ContainsExternalFunctionNodes(import))
-    {
-      provider.Provisioning_->AddExternalFunctionNodes(import, memoryNodes);
-    }
+    for (auto & memoryNode : memoryNodes.Items())
+      regionSummary.AddMemoryNode(*memoryNode);
+    provider.Provisioning_->AddExternalFunctionNodes(import, std::move(memoryNodes));
   };
   auto annotateIndirectCall = [](auto & provider, auto & callNode, auto & callTypeClassifier)
   {
     JLM_ASSERT(callTypeClassifier.GetCallType() == CallTypeClassifier::CallType::IndirectCall);
 
     auto & regionSummary = provider.Provisioning_->GetRegionSummary(*callNode.region());
-    regionSummary.AddMemoryNodes(
-        { &provider.Provisioning_->GetPointsToGraph().GetExternalMemoryNode() });
+    regionSummary.AddMemoryNode(provider.Provisioning_->GetPointsToGraph().GetExternalMemoryNode());
     regionSummary.AddUnknownMemoryNodeReferences({ &callNode });
   };
 
@@ -730,7 +855,7 @@ RegionAwareMemoryNodeProvider::AnnotateCall(const CallNode & callNode)
 
   auto callTypeClassifier = CallNode::ClassifyCall(callNode);
   JLM_ASSERT(callTypes.find(callTypeClassifier->GetCallType()) != callTypes.end());
-  callTypes[callTypeClassifier->GetCallType()](*this, callNode, *callTypeClassifier);
+  callTypes.at(callTypeClassifier->GetCallType())(*this, callNode, *callTypeClassifier);
 }
 
 void
@@ -740,10 +865,10 @@ RegionAwareMemoryNodeProvider::AnnotateMemcpy(const jlm::rvsdg::simple_node & me
 
   auto & regionSummary = Provisioning_->GetRegionSummary(*memcpyNode.region());
 
-  auto dstNodes = Provisioning_->GetOutputNodes(*memcpyNode.input(0)->origin());
+  auto & dstNodes = Provisioning_->GetOutputNodeIndices(*memcpyNode.input(0)->origin());
   regionSummary.AddMemoryNodes(dstNodes);
 
-  auto srcNodes = Provisioning_->GetOutputNodes(*memcpyNode.input(1)->origin());
+  auto & srcNodes = Provisioning_->GetOutputNodeIndices(*memcpyNode.input(1)->origin());
   regionSummary.AddMemoryNodes(srcNodes);
 }
 
@@ -768,8 +893,7 @@ RegionAwareMemoryNodeProvider::AnnotateStructuralNode(
 void
 RegionAwareMemoryNodeProvider::Propagate(const RvsdgModule & rvsdgModule)
 {
-  jlm::rvsdg::topdown_traverser traverser(rvsdgModule.Rvsdg().root());
-  for (auto & node : traverser)
+  auto propagateNode = [&](const jlm::rvsdg::node * node)
   {
     if (auto lambdaNode = dynamic_cast<const lambda::node *>(node))
     {
@@ -784,14 +908,30 @@ RegionAwareMemoryNodeProvider::Propagate(const RvsdgModule & rvsdgModule)
       /*
        * Nothing needs to be done for delta nodes.
        */
-      continue;
     }
     else
     {
       JLM_UNREACHABLE("Unhandled node type!");
     }
+  };
+
+  /*
+   * A lambda or phi node in the root region depends on all the lambda nodes it directly calls, and
+   * therefore has a greater depth than these. All nodes with the same depth are independent of
+   * each other and can be propagated concurrently.
+   */
+  std::vector<std::vector<const jlm::rvsdg::node *>> levels;
+  for (auto & node : rvsdgModule.Rvsdg().root()->nodes)
+  {
+    if (levels.size() <= node.depth())
+      levels.resize(node.depth() + 1);
+
+    levels[node.depth()].push_back(&node);
   }
 
+  for (auto & level : levels)
+    util::ParallelForEach(level, NumThreads_, propagateNode);
+
   JLM_ASSERT(RegionAwareMemoryNodeProvisioning::CheckInvariants(*Provisioning_));
 }
 
@@ -800,11 +940,11 @@ RegionAwareMemoryNodeProvider::PropagatePhi(const phi::node & phiNode)
 {
   std::function<void(
       const jlm::rvsdg::region &,
-      const util::HashSet<const PointsToGraph::MemoryNode *> &,
+      const util::SparseBitVector &,
       const util::HashSet<const jlm::rvsdg::simple_node *> &)>
       assignAndPropagateMemoryNodes =
           [&](const jlm::rvsdg::region & region,
-              const util::HashSet<const PointsToGraph::MemoryNode *> & memoryNodes,
+              const util::SparseBitVector & memoryNodes,
               const util::HashSet<const jlm::rvsdg::simple_node *> & unknownMemoryNodeReferences)
   {
     auto & regionSummary = Provisioning_->GetRegionSummary(region);
@@ -831,12 +971,12 @@ RegionAwareMemoryNodeProvider::PropagatePhi(const phi::node & phiNode)
 
   auto lambdaNodes = phi::node::ExtractLambdaNodes(phiNode);
 
-  util::HashSet<const PointsToGraph::MemoryNode *> memoryNodes;
+  util::SparseBitVector memoryNodes;
   util::HashSet<const jlm::rvsdg::simple_node *> unknownMemoryNodeReferences;
   for (auto & lambdaNode : lambdaNodes)
   {
     auto & regionSummary = Provisioning_->GetRegionSummary(*lambdaNode->subregion());
-    memoryNodes.UnionWith(regionSummary.GetMemoryNodes());
+    memoryNodes.UnionWith(regionSummary.GetMemoryNodeIndices());
     unknownMemoryNodeReferences.UnionWith(regionSummary.GetUnknownMemoryNodeReferences());
   }
 
@@ -880,7 +1020,7 @@ RegionAwareMemoryNodeProvider::ResolveUnknownMemoryNodeReferences(const RvsdgMod
     {
       auto & nodeRegion = *node->region();
       auto & nodeRegionSummary = Provisioning_->GetRegionSummary(nodeRegion);
-      nodeRegionSummary.AddMemoryNodes(lambdaRegionSummary.GetMemoryNodes());
+      nodeRegionSummary.AddMemoryNodes(lambdaRegionSummary.GetMemoryNodeIndices());
     }
   };
 
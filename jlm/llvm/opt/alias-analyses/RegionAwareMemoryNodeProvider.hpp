@@ -38,6 +38,11 @@ class RegionAwareMemoryNodeProvisioning;
  * 4. Propagation: The memory locations are propagated through the graph again. After this phase, a
  * fix-point is reached and all regions are annotated with the required memory locations.
  *
+ * The annotation of the individual lambda nodes is performed concurrently, as well as the
+ * propagation through all lambda and phi nodes that do not directly call each other. The memory
+ * locations of a region are stored as indices of PointsToGraph nodes throughout all phases, and are
+ * only converted to sets of memory nodes at the end.
+ *
  * @see MemoryNodeProvider
  * @see MemoryStateEncoder
  */
@@ -48,8 +53,16 @@ public:
 
   ~RegionAwareMemoryNodeProvider() noexcept override;
 
+  /**
+   * Creates a provider that uses a single thread.
+   */
   RegionAwareMemoryNodeProvider();
 
+  /**
+   * @param numThreads The maximal number of threads used for the annotation and propagation.
+   */
+  explicit RegionAwareMemoryNodeProvider(size_t numThreads);
+
   RegionAwareMemoryNodeProvider(const RegionAwareMemoryNodeProvider &) = delete;
 
   RegionAwareMemoryNodeProvider(RegionAwareMemoryNodeProvider &&) = delete;
@@ -72,6 +85,7 @@ public:
    * @param rvsdgModule The RVSDG module on which the provision should be performed.
    * @param pointsToGraph The PointsToGraph corresponding to the RVSDG module.
    * @param statisticsCollector The statistics collector for collecting pass statistics.
+   * @param numThreads The maximal number of threads used for the annotation and propagation.
    *
    * @return A new instance of MemoryNodeProvisioning.
    */
@@ -79,7 +93,8 @@ public:
   Create(
       const RvsdgModule & rvsdgModule,
       const PointsToGraph & pointsToGraph,
-      jlm::util::StatisticsCollector & statisticsCollector);
+      jlm::util::StatisticsCollector & statisticsCollector,
+      size_t numThreads = 1);
 
   /**
    * Creates a RegionAwareMemoryNodeProvider and calls the ProvisionMemoryNodes() method.
@@ -92,21 +107,47 @@ public:
   static std::unique_ptr<MemoryNodeProvisioning>
   Create(const RvsdgModule & rvsdgModule, const PointsToGraph & pointsToGraph);
 
+  [[nodiscard]] size_t
+  NumThreads() const noexcept
+  {
+    return NumThreads_;
+  }
+
 private:
+  /**
+   * Creates the region summaries of all regions in the RVSDG module, and annotates the lambda
+   * nodes concurrently.
+   *
+   * @param rvsdgModule The RVSDG module on which the annotation should be performed.
+   *
+   * @see AnnotateRegion()
+   */
+  void
+  Annotate(const RvsdgModule & rvsdgModule);
+
+  /**
+   * Creates the summaries of \p region and all its subregions, and annotates each summary with
+   * the structural nodes of its region.
+   *
+   * @param region The region for which the summaries should be created.
+   */
+  void
+  CreateRegionSummaries(const jlm::rvsdg::region & region);
+
   /**
    * Annotates a region with the memory locations utilized by the contained simple RVSDG nodes,
    * e.g., load, store, etc. nodes, the contained function calls, and the simple RVSDG nodes that
    * reference unknown memory locations.
    *
-   * The annotation phase starts at the RVSDG root region and simply iterates through all the nodes
+   * The annotation phase starts at a lambda region and simply iterates through all the nodes
    * within a region and performs the appropriate action for a node. It recursively traverses the
-   * subregions of structural nodes until all nodes within all regions of the graph have been
-   * visited.
+   * subregions of structural nodes until all nodes within all regions of the lambda have been
+   * visited. The summaries of all regions need to exist already.
    *
    * @param region The to be annotated region.
    */
   void
-  AnnotateRegion(jlm::rvsdg::region & region);
+  AnnotateRegion(const jlm::rvsdg::region & region);
 
   void
   AnnotateSimpleNode(const jlm::rvsdg::simple_node & provider);
@@ -184,6 +225,7 @@ private:
   void
   ResolveUnknownMemoryNodeReferences(const RvsdgModule & rvsdgModule);
 
+  size_t NumThreads_;
   std::unique_ptr<RegionAwareMemoryNodeProvisioning> Provisioning_;
 };
 
@@ -201,11 +243,13 @@ public:
   explicit Statistics(
       const util::StatisticsCollector & statisticsCollector,
       const RvsdgModule & rvsdgModule,
-      const PointsToGraph & pointsToGraph)
+      const PointsToGraph & pointsToGraph,
+      size_t numThreads)
       : jlm::util::Statistics(Statistics::Id::MemoryNodeProvisioning),
         NumRvsdgNodes_(0),
         NumRvsdgRegions_(0),
         NumPointsToGraphMemoryNodes_(0),
+        NumThreads_(numThreads),
         StatisticsCollector_(statisticsCollector)
   {
     if (!IsDemanded())
@@ -234,6 +278,12 @@ public:
     return NumPointsToGraphMemoryNodes_;
   }
 
+  [[nodiscard]] size_t
+  NumThreads() const noexcept
+  {
+    return NumThreads_;
+  }
+
   [[nodiscard]] size_t
   GetAnnotationStatisticsTime() const noexcept
   {
@@ -258,6 +308,12 @@ public:
     return ResolveUnknownMemoryReferencesTimer_.ns();
   }
 
+  [[nodiscard]] size_t
+  GetMaterializationTime() const noexcept
+  {
+    return MaterializationTimer_.ns();
+  }
+
   void
   StartAnnotationStatistics() noexcept
   {
@@ -330,6 +386,24 @@ public:
     PropagationPass2Timer_.stop();
   }
 
+  void
+  StartMaterializationStatistics() noexcept
+  {
+    if (!IsDemanded())
+      return;
+
+    MaterializationTimer_.start();
+  }
+
+  void
+  StopMaterializationStatistics() noexcept
+  {
+    if (!IsDemanded())
+      return;
+
+    MaterializationTimer_.stop();
+  }
+
   [[nodiscard]] std::string
   ToString() const override
   {
@@ -344,6 +418,9 @@ public:
         "#PointsToGraphMemoryNodes:",
         NumPointsToGraphMemoryNodes_,
         " ",
+        "#Threads:",
+        NumThreads_,
+        " ",
         "AnnotationTime[ns]:",
         AnnotationTimer_.ns(),
         " ",
@@ -355,6 +432,9 @@ public:
         " ",
         "PropagationPass2Time[ns]:",
         PropagationPass2Timer_.ns(),
+        " ",
+        "MaterializationTime[ns]:",
+        MaterializationTimer_.ns(),
         " ");
   }
 
@@ -362,9 +442,14 @@ public:
   Create(
       const util::StatisticsCollector & statisticsCollector,
       const RvsdgModule & rvsdgModule,
-      const PointsToGraph & pointsToGraph)
+      const PointsToGraph & pointsToGraph,
+      size_t numThreads)
   {
-    return std::make_unique<Statistics>(statisticsCollector, rvsdgModule, pointsToGraph);
+    return std::make_unique<Statistics>(
+        statisticsCollector,
+        rvsdgModule,
+        pointsToGraph,
+        numThreads);
   }
 
 private:
@@ -382,11 +467,13 @@ private:
   size_t NumRvsdgNodes_;
   size_t NumRvsdgRegions_;
   size_t NumPointsToGraphMemoryNodes_;
+  size_t NumThreads_;
 
   util::timer AnnotationTimer_;
   util::timer PropagationPass1Timer_;
   util::timer ResolveUnknownMemoryReferencesTimer_;
   util::timer PropagationPass2Timer_;
+  util::timer MaterializationTimer_;
 
   const util::StatisticsCollector & StatisticsCollector_;
 };
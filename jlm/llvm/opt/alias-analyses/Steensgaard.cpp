@@ -3,6 +3,7 @@
  * See COPYING for terms of redistribution.
  */
 
+#include <jlm/llvm/ir/CallGraphIndex.hpp>
 #include <jlm/llvm/ir/operators.hpp>
 #include <jlm/llvm/ir/RvsdgModule.hpp>
 #include <jlm/llvm/opt/alias-analyses/PointsToGraph.hpp>
@@ -12,6 +13,9 @@
 #include <jlm/util/Statistics.hpp>
 #include <jlm/util/time.hpp>
 
+#include <map>
+#include <optional>
+
 /*
   FIXME: to be removed again
 */
@@ -53,9 +57,13 @@ class Location
 public:
   virtual ~Location() = default;
 
-  constexpr explicit Location(PointsToFlags pointsToFlags)
+  explicit Location(PointsToFlags pointsToFlags)
       : PointsToFlags_(pointsToFlags),
-        PointsTo_(nullptr)
+        PointsTo_(nullptr),
+        Parent_(nullptr),
+        Offset_(0),
+        AccessSize_(0),
+        IsCollapsed_(false)
   {}
 
   Location(const Location &) = delete;
@@ -116,15 +124,85 @@ public:
     PointsToFlags_ = pointsToFlags;
   }
 
+  /**
+   * The fields of the location indexed by their byte offset. Fields are only tracked by the
+   * field-sensitive analysis and only for the root location of a set.
+   */
+  [[nodiscard]] std::map<size_t, Location *> &
+  GetFields() noexcept
+  {
+    return Fields_;
+  }
+
+  /**
+   * @return The location of the object this field belongs to, or nullptr if the location is not a
+   * field.
+   */
+  [[nodiscard]] Location *
+  GetParent() const noexcept
+  {
+    return Parent_;
+  }
+
+  [[nodiscard]] size_t
+  GetOffset() const noexcept
+  {
+    return Offset_;
+  }
+
+  void
+  SetParent(Location * parent, size_t offset) noexcept
+  {
+    Parent_ = parent;
+    Offset_ = offset;
+  }
+
+  /**
+   * Determines whether all fields of the location were merged into the location itself.
+   */
+  [[nodiscard]] bool
+  IsCollapsed() const noexcept
+  {
+    return IsCollapsed_;
+  }
+
+  void
+  SetIsCollapsed(bool isCollapsed) noexcept
+  {
+    IsCollapsed_ = isCollapsed;
+  }
+
+  /**
+   * The largest number of bytes that is loaded or stored at the location. The access size is only
+   * tracked by the field-sensitive analysis.
+   */
+  [[nodiscard]] size_t
+  GetAccessSize() const noexcept
+  {
+    return AccessSize_;
+  }
+
+  void
+  SetAccessSize(size_t accessSize) noexcept
+  {
+    AccessSize_ = accessSize;
+  }
+
 private:
   PointsToFlags PointsToFlags_;
   Location * PointsTo_;
+
+  std::map<size_t, Location *> Fields_;
+  Location * Parent_;
+  size_t Offset_;
+  size_t AccessSize_;
+  bool IsCollapsed_;
 };
 
 class RegisterLocation final : public Location
 {
 public:
-  constexpr explicit RegisterLocation(
+  explicit RegisterLocation(
       const jlm::rvsdg::output & output,
       PointsToFlags pointsToFlags)
       : Location(pointsToFlags),
@@ -258,7 +336,7 @@ private:
 class MemoryLocation : public Location
 {
 public:
-  constexpr MemoryLocation()
+  MemoryLocation()
       : Location(PointsToFlags::PointsToNone)
   {}
 };
@@ -272,7 +350,7 @@ class AllocaLocation final : public MemoryLocation
 
   ~AllocaLocation() override = default;
 
-  constexpr explicit AllocaLocation(const jlm::rvsdg::node & node)
+  explicit AllocaLocation(const jlm::rvsdg::node & node)
       : MemoryLocation(),
         Node_(node)
   {
@@ -311,7 +389,7 @@ class MallocLocation final : public MemoryLocation
 
   ~MallocLocation() override = default;
 
-  constexpr explicit MallocLocation(const jlm::rvsdg::node & node)
+  explicit MallocLocation(const jlm::rvsdg::node & node)
       : MemoryLocation(),
         Node_(node)
   {
@@ -350,7 +428,7 @@ class LambdaLocation final : public MemoryLocation
 
   ~LambdaLocation() override = default;
 
-  constexpr explicit LambdaLocation(const lambda::node & lambda)
+  explicit LambdaLocation(const lambda::node & lambda)
       : MemoryLocation(),
         Lambda_(lambda)
   {}
@@ -388,7 +466,7 @@ class DeltaLocation final : public MemoryLocation
 
   ~DeltaLocation() override = default;
 
-  constexpr explicit DeltaLocation(const delta::node & delta)
+  explicit DeltaLocation(const delta::node & delta)
       : MemoryLocation(),
         Delta_(delta)
   {}
@@ -463,6 +541,37 @@ private:
   const jlm::rvsdg::argument & Argument_;
 };
 
+/** \brief FieldLocation class
+ *
+ * This class represents the field at a constant byte offset of an abstract memory location. It is
+ * only created by the field-sensitive analysis.
+ */
+class FieldLocation final : public Location
+{
+public:
+  ~FieldLocation() override = default;
+
+  FieldLocation(size_t offset, PointsToFlags pointsToFlags)
+      : Location(pointsToFlags),
+        FieldOffset_(offset)
+  {}
+
+  [[nodiscard]] std::string
+  DebugString() const noexcept override
+  {
+    return jlm::util::strfmt("FIELD[", FieldOffset_, "]");
+  }
+
+  static std::unique_ptr<Location>
+  Create(size_t offset, PointsToFlags pointsToFlags)
+  {
+    return std::make_unique<FieldLocation>(offset, pointsToFlags);
+  }
+
+private:
+  size_t FieldOffset_;
+};
+
 /** \brief FIXME: write documentation
  */
 class DummyLocation final : public Location
@@ -572,6 +681,110 @@ public:
     return *location;
   }
 
+  /**
+   * Returns the location that represents the field at byte \p offset of the memory represented by
+   * \p location. If \p location is itself a field, the offset is interpreted relative to it. The
+   * memory itself is returned for offset zero and for collapsed memory.
+   */
+  Location &
+  FindOrInsertFieldLocation(Location & location, size_t offset)
+  {
+    auto object = &GetRootLocation(location);
+    if (auto parent = object->GetParent())
+    {
+      offset += object->GetOffset();
+      object = &GetRootLocation(*parent);
+    }
+
+    if (offset == 0 || object->IsCollapsed())
+      return *object;
+
+    auto & fields = object->GetFields();
+    if (auto it = fields.find(offset); it != fields.end())
+      return GetRootLocation(*it->second);
+
+    Locations_.push_back(FieldLocation::Create(offset, object->GetPointsToFlags()));
+    auto field = Locations_.back().get();
+    DisjointLocationSet_.insert(field);
+
+    field->SetParent(object, offset);
+    fields[offset] = field;
+
+    return *field;
+  }
+
+  /**
+   * Merges all fields of the memory represented by \p location into the memory itself. If
+   * \p location is a field, then the object it belongs to is collapsed.
+   */
+  void
+  Collapse(Location & location)
+  {
+    auto object = &GetRootLocation(location);
+    if (auto parent = object->GetParent())
+      object = &GetRootLocation(*parent);
+
+    if (object->IsCollapsed())
+      return;
+
+    object->SetIsCollapsed(true);
+    auto fields = std::move(object->GetFields());
+    object->GetFields().clear();
+
+    for (auto & [offset, field] : fields)
+    {
+      auto & fieldRoot = GetRootLocation(*field);
+      fieldRoot.SetParent(nullptr, 0);
+      Join(*object, fieldRoot);
+    }
+  }
+
+  /**
+   * Records that \p size bytes are loaded or stored at the memory represented by \p location.
+   */
+  void
+  RecordAccess(Location & location, size_t size)
+  {
+    auto & root = GetRootLocation(location);
+    root.SetAccessSize(std::max(root.GetAccessSize(), size));
+  }
+
+  /**
+   * Collapses all memory whose accesses at one field extend into the next field. The fields of a
+   * memory location are created independently of the accesses to them, and this is therefore only
+   * checked after all accesses and fields are known.
+   */
+  void
+  CollapseOverlappingFields()
+  {
+    bool collapsed = false;
+    do
+    {
+      collapsed = false;
+      for (auto & location : Locations_)
+      {
+        auto & object = GetRootLocation(*location);
+        if (&object != location.get() || object.GetParent() != nullptr || object.IsCollapsed()
+            || object.GetFields().empty())
+          continue;
+
+        auto end = object.GetAccessSize();
+        bool isOverlapping = false;
+        for (auto & [offset, field] : object.GetFields())
+        {
+          isOverlapping |= end > offset;
+          end = offset + GetRootLocation(*field).GetAccessSize();
+        }
+
+        if (isOverlapping)
+        {
+          Collapse(object);
+          collapsed = true;
+        }
+      }
+    } while (collapsed);
+  }
+
   Location &
   InsertDummyLocation()
   {
@@ -713,15 +926,58 @@ public:
 
       auto & rootx = GetRootLocation(*x);
       auto & rooty = GetRootLocation(*y);
+      if (&rootx == &rooty)
+        return &rootx;
+
+      // A field can only be unified with locations that have no fields themselves. Otherwise, the
+      // unified location would reside at several offsets, and we give up on the fields of the
+      // object the field belongs to.
+      auto hasFields = [](Location & location)
+      {
+        return location.GetParent() != nullptr || location.IsCollapsed()
+            || !location.GetFields().empty();
+      };
+      if (rootx.GetParent() != nullptr && hasFields(rooty))
+      {
+        Collapse(rootx);
+        return join(x, y);
+      }
+      if (rooty.GetParent() != nullptr && hasFields(rootx))
+      {
+        Collapse(rooty);
+        return join(x, y);
+      }
+
       auto flags = rootx.GetPointsToFlags() | rooty.GetPointsToFlags();
       rootx.SetPointsToFlags(flags);
       rooty.SetPointsToFlags(flags);
+
+      auto parent = rootx.GetParent() != nullptr ? &rootx : &rooty;
+      auto isCollapsed = rootx.IsCollapsed() || rooty.IsCollapsed();
+      auto accessSize = std::max(rootx.GetAccessSize(), rooty.GetAccessSize());
+      auto fieldsx = std::move(rootx.GetFields());
+      auto fieldsy = std::move(rooty.GetFields());
+      rootx.GetFields().clear();
+      rooty.GetFields().clear();
+
       auto & tmp = Merge(rootx, rooty);
+      tmp.SetParent(parent->GetParent(), parent->GetOffset());
+      tmp.SetIsCollapsed(isCollapsed);
+      tmp.SetAccessSize(accessSize);
 
       if (auto root = join(rootx.GetPointsTo(), rooty.GetPointsTo()))
-        tmp.SetPointsTo(*root);
+      {
+        // Joining the pointees might have collapsed the object tmp is a field of
+        auto & tmpRoot = GetRootLocation(tmp);
+        tmpRoot.SetPointsTo(*join(tmpRoot.GetPointsTo(), root));
+      }
 
-      return &tmp;
+      for (auto & [offset, field] : fieldsx)
+        AttachField(tmp, offset, *field);
+      for (auto & [offset, field] : fieldsy)
+        AttachField(tmp, offset, *field);
+
+      return &GetRootLocation(tmp);
     };
 
     join(&x, &y);
@@ -734,6 +990,42 @@ public:
   }
 
 private:
+  /**
+   * Makes \p field the field at byte \p offset of \p object. The field is unified with an
+   * already existing field at the same offset.
+   */
+  void
+  AttachField(Location & object, size_t offset, Location & field)
+  {
+    auto & objectRoot = GetRootLocation(object);
+    auto & fieldRoot = GetRootLocation(field);
+    fieldRoot.SetParent(nullptr, 0);
+    fieldRoot.SetPointsToFlags(fieldRoot.GetPointsToFlags() | objectRoot.GetPointsToFlags());
+
+    if (objectRoot.IsCollapsed())
+    {
+      Join(objectRoot, fieldRoot);
+      return;
+    }
+
+    auto & fields = objectRoot.GetFields();
+    auto it = fields.find(offset);
+    if (it == fields.end() || &GetRootLocation(*it->second) == &fieldRoot)
+    {
+      fieldRoot.SetParent(&objectRoot, offset);
+      fields[offset] = &fieldRoot;
+      return;
+    }
+
+    // Both objects were unified, and so are their fields at the same offset. The unification might
+    // have changed the object, so the result is attached again.
+    auto & existingField = GetRootLocation(*it->second);
+    existingField.SetParent(nullptr, 0);
+    fields.erase(it);
+    Join(existingField, fieldRoot);
+    AttachField(objectRoot, offset, fieldRoot);
+  }
+
   Location &
   Merge(Location & location1, Location & location2)
   {
@@ -777,11 +1069,13 @@ public:
         NumPointsToGraphNodes_(0),
         NumAllocaNodes_(0),
         NumDeltaNodes_(0),
+        NumFieldNodes_(0),
         NumImportNodes_(0),
         NumLambdaNodes_(0),
         NumMallocNodes_(0),
         NumMemoryNodes_(0),
         NumRegisterNodes_(0),
+        NumUniqueRegisterNodes_(0),
         NumUnknownMemorySources_(0)
   {}
 
@@ -813,11 +1107,13 @@ public:
     NumPointsToGraphNodes_ = pointsToGraph.NumNodes();
     NumAllocaNodes_ = pointsToGraph.NumAllocaNodes();
     NumDeltaNodes_ = pointsToGraph.NumDeltaNodes();
+    NumFieldNodes_ = pointsToGraph.NumFieldNodes();
     NumImportNodes_ = pointsToGraph.NumImportNodes();
     NumLambdaNodes_ = pointsToGraph.NumLambdaNodes();
     NumMallocNodes_ = pointsToGraph.NumMallocNodes();
     NumMemoryNodes_ = pointsToGraph.NumMemoryNodes();
     NumRegisterNodes_ = pointsToGraph.NumRegisterNodes();
+    NumUniqueRegisterNodes_ = pointsToGraph.NumUniqueRegisterNodes();
     NumUnknownMemorySources_ = pointsToGraph.GetUnknownMemoryNode().NumSources();
   }
 
@@ -861,6 +1157,9 @@ public:
         "#DeltaNodes:",
         NumDeltaNodes_,
         " ",
+        "#FieldNodes:",
+        NumFieldNodes_,
+        " ",
         "#ImportNodes:",
         NumImportNodes_,
         " ",
@@ -876,6 +1175,9 @@ public:
         "#RegisterNodes:",
         NumRegisterNodes_,
         " ",
+        "#UniqueRegisterNodes:",
+        NumUniqueRegisterNodes_,
+        " ",
         "#UnknownMemorySources:",
         NumUnknownMemorySources_,
         " ",
@@ -902,11 +1204,13 @@ private:
   size_t NumPointsToGraphNodes_;
   size_t NumAllocaNodes_;
   size_t NumDeltaNodes_;
+  size_t NumFieldNodes_;
   size_t NumImportNodes_;
   size_t NumLambdaNodes_;
   size_t NumMallocNodes_;
   size_t NumMemoryNodes_;
   size_t NumRegisterNodes_;
+  size_t NumUniqueRegisterNodes_;
   size_t NumUnknownMemorySources_;
 
   util::timer AnalysisTimer_;
@@ -916,7 +1220,178 @@ private:
 
 Steensgaard::~Steensgaard() = default;
 
-Steensgaard::Steensgaard() = default;
+Steensgaard::Steensgaard()
+    : Steensgaard(false)
+{}
+
+Steensgaard::Steensgaard(bool isFieldSensitive)
+    : IsFieldSensitive_(isFieldSensitive),
+      CallGraphIndex_(nullptr)
+{}
+
+/**
+ * Computes the allocation size and alignment of \p type in bytes. The computation follows the
+ * default data layout of x86-64, as the RVSDG does not carry a data layout.
+ *
+ * @return The size and alignment of \p type, or std::nullopt if \p type has no fixed size.
+ */
+static std::optional<std::pair<size_t, size_t>>
+GetSizeAndAlignment(const jlm::rvsdg::valuetype & type)
+{
+  auto alignTo = [](size_t size, size_t alignment)
+  {
+    return (size + alignment - 1) / alignment * alignment;
+  };
+
+  if (auto bitType = dynamic_cast<const jlm::rvsdg::bittype *>(&type))
+  {
+    size_t alignment = 1;
+    while (alignment * 8 < bitType->nbits() && alignment < 8)
+      alignment *= 2;
+
+    return std::make_pair(alignTo((bitType->nbits() + 7) / 8, alignment), alignment);
+  }
+
+  if (is<PointerType>(type))
+    return std::make_pair(8, 8);
+
+  if (auto fpType = dynamic_cast<const fptype *>(&type))
+  {
+    switch (fpType->size())
+    {
+    case fpsize::half:
+      return std::make_pair(2, 2);
+    case fpsize::flt:
+      return std::make_pair(4, 4);
+    case fpsize::dbl:
+      return std::make_pair(8, 8);
+    case fpsize::x86fp80:
+      return std::make_pair(16, 16);
+    default:
+      JLM_UNREACHABLE("Unhandled floating point size.");
+    }
+  }
+
+  if (auto arrayType = dynamic_cast<const arraytype *>(&type))
+  {
+    auto element = GetSizeAndAlignment(arrayType->element_type());
+    if (!element)
+      return std::nullopt;
+
+    return std::make_pair(element->first * arrayType->nelements(), element->second);
+  }
+
+  if (auto vectorType = dynamic_cast<const fixedvectortype *>(&type))
+  {
+    auto element = GetSizeAndAlignment(vectorType->type());
+    if (!element)
+      return std::nullopt;
+
+    size_t alignment = 1;
+    while (alignment < element->first * vectorType->size())
+      alignment *= 2;
+
+    return std::make_pair(alignTo(element->first * vectorType->size(), alignment), alignment);
+  }
+
+  if (auto structType = dynamic_cast<const StructType *>(&type))
+  {
+    auto & declaration = structType->GetDeclaration();
+
+    size_t size = 0;
+    size_t alignment = 1;
+    for (size_t n = 0; n < declaration.nelements(); n++)
+    {
+      auto element = GetSizeAndAlignment(declaration.element(n));
+      if (!element)
+        return std::nullopt;
+
+      auto elementAlignment = structType->IsPacked() ? 1 : element->second;
+      size = alignTo(size, elementAlignment) + element->first;
+      alignment = std::max(alignment, elementAlignment);
+    }
+
+    return std::make_pair(alignTo(size, alignment), alignment);
+  }
+
+  return std::nullopt;
+}
+
+/**
+ * @return The value of \p output if it is a constant, otherwise std::nullopt.
+ */
+static std::optional<int64_t>
+GetConstantIndex(const jlm::rvsdg::output & output)
+{
+  auto node = jlm::rvsdg::node_output::node(&output);
+  if (node == nullptr)
+    return std::nullopt;
+
+  auto constant = dynamic_cast<const jlm::rvsdg::bitconstant_op *>(&node->operation());
+  if (constant == nullptr || !constant->value().is_known())
+    return std::nullopt;
+
+  return constant->value().to_int();
+}
+
+/**
+ * Computes the constant byte offset a GetElementPtr node adds to its base address. The elements of
+ * an array are all represented by its first element.
+ *
+ * @return The offset, or std::nullopt if the offset cannot be determined or the address leaves the
+ * pointed-to element.
+ */
+static std::optional<size_t>
+GetConstantFieldOffset(const jlm::rvsdg::simple_node & node)
+{
+  auto & operation = *util::AssertedCast<const GetElementPtrOperation>(&node.operation());
+
+  // The first index performs pointer arithmetic on the base address
+  if (node.ninputs() > 1 && GetConstantIndex(*node.input(1)->origin()) != 0)
+    return std::nullopt;
+
+  size_t offset = 0;
+  const jlm::rvsdg::valuetype * type = &operation.GetPointeeType();
+  for (size_t n = 2; n < node.ninputs(); n++)
+  {
+    if (auto arrayType = dynamic_cast<const arraytype *>(type))
+    {
+      type = &arrayType->element_type();
+      continue;
+    }
+
+    if (auto vectorType = dynamic_cast<const fixedvectortype *>(type))
+    {
+      type = &vectorType->type();
+      continue;
+    }
+
+    auto structType = dynamic_cast<const StructType *>(type);
+    auto index = GetConstantIndex(*node.input(n)->origin());
+    if (structType == nullptr || !index || *index < 0
+        || static_cast<size_t>(*index) >= structType->GetDeclaration().nelements())
+      return std::nullopt;
+
+    auto & declaration = structType->GetDeclaration();
+    size_t fieldOffset = 0;
+    for (size_t i = 0; i <= static_cast<size_t>(*index); i++)
+    {
+      auto element = GetSizeAndAlignment(declaration.element(i));
+      if (!element)
+        return std::nullopt;
+
+      auto alignment = structType->IsPacked() ? 1 : element->second;
+      fieldOffset = (fieldOffset + alignment - 1) / alignment * alignment;
+      if (i < static_cast<size_t>(*index))
+        fieldOffset += element->first;
+    }
+
+    offset += fieldOffset;
+    type = &declaration.element(*index);
+  }
+
+  return offset;
+}
 
 void
 Steensgaard::AnalyzeSimpleNode(const jlm::rvsdg::simple_node & node)
@@ -1081,7 +1556,12 @@ Steensgaard::AnalyzeMalloc(const jlm::rvsdg::simple_node & node)
 void
 Steensgaard::AnalyzeLoad(const LoadNode & loadNode)
 {
-  if (!is<PointerType>(loadNode.GetValueOutput()->type()))
+  auto & loadedType = loadNode.GetValueOutput()->type();
+  if (IsFieldSensitive_)
+    AnalyzeFieldAccess(*loadNode.GetAddressInput()->origin(), loadedType);
+
+  // Aggregates holding pointers are only tracked by the field-sensitive analysis
+  if (!is<PointerType>(loadedType) && !(IsFieldSensitive_ && IsOrContains<PointerType>(loadedType)))
     return;
 
   auto & address = LocationSet_->Find(*loadNode.GetAddressInput()->origin());
@@ -1104,9 +1584,22 @@ Steensgaard::AnalyzeStore(const StoreNode & storeNode)
   auto & address = *storeNode.GetAddressInput()->origin();
   auto & value = *storeNode.GetValueInput()->origin();
 
-  if (!is<PointerType>(value.type()))
+  auto & storedType = value.type();
+  if (IsFieldSensitive_)
+    AnalyzeFieldAccess(address, storedType);
+
+  // Aggregates holding pointers are only tracked by the field-sensitive analysis
+  if (!is<PointerType>(storedType) && !(IsFieldSensitive_ && IsOrContains<PointerType>(storedType)))
     return;
 
+  // The operations producing aggregates do not necessarily track the pointers they hold
+  if (!LocationSet_->Contains(value))
+  {
+    LocationSet_->FindOrInsertRegisterLocation(
+        value,
+        PointsToFlags::PointsToUnknownMemory | PointsToFlags::PointsToExternalMemory);
+  }
+
   auto & addressLocation = LocationSet_->Find(address);
   auto & valueLocation = LocationSet_->Find(value);
 
@@ -1240,10 +1733,59 @@ Steensgaard::AnalyzeGep(const jlm::rvsdg::simple_node & node)
   JLM_ASSERT(is<GetElementPtrOperation>(&node));
 
   auto & base = LocationSet_->Find(*node.input(0)->origin());
+  if (!IsFieldSensitive_)
+  {
+    auto & value =
+        LocationSet_->FindOrInsertRegisterLocation(*node.output(0), PointsToFlags::PointsToNone);
+    LocationSet_->Join(base, value);
+    return;
+  }
+
+  if (base.GetPointsTo() == nullptr)
+  {
+    auto & dummyLocation = LocationSet_->InsertDummyLocation();
+    base.SetPointsTo(dummyLocation);
+  }
+
+  // Give up on the fields of the memory if we cannot determine which field the address refers to
+  auto offset = GetConstantFieldOffset(node);
+  if (!offset)
+  {
+    LocationSet_->Collapse(*base.GetPointsTo());
+    auto & value =
+        LocationSet_->FindOrInsertRegisterLocation(*node.output(0), PointsToFlags::PointsToNone);
+    LocationSet_->Join(base, value);
+    return;
+  }
+
+  auto & field = LocationSet_->FindOrInsertFieldLocation(*base.GetPointsTo(), *offset);
   auto & value =
-      LocationSet_->FindOrInsertRegisterLocation(*node.output(0), PointsToFlags::PointsToNone);
+      LocationSet_->FindOrInsertRegisterLocation(*node.output(0), base.GetPointsToFlags());
+  value.SetPointsTo(field);
+}
 
-  LocationSet_->Join(base, value);
+void
+Steensgaard::AnalyzeFieldAccess(const jlm::rvsdg::output & address, const jlm::rvsdg::type & type)
+{
+  JLM_ASSERT(IsFieldSensitive_);
+
+  auto & addressLocation = LocationSet_->Find(address);
+  if (addressLocation.GetPointsTo() == nullptr)
+  {
+    auto & dummyLocation = LocationSet_->InsertDummyLocation();
+    addressLocation.SetPointsTo(dummyLocation);
+  }
+
+  // Aggregates are accessed as a whole, and we therefore give up on the fields of the memory
+  auto valueType = dynamic_cast<const jlm::rvsdg::valuetype *>(&type);
+  auto sizeAndAlignment = valueType ? GetSizeAndAlignment(*valueType) : std::nullopt;
+  if (!sizeAndAlignment || is<StructType>(type) || is<arraytype>(type) || is<fixedvectortype>(type))
+  {
+    LocationSet_->Collapse(*addressLocation.GetPointsTo());
+    return;
+  }
+
+  LocationSet_->RecordAccess(*addressLocation.GetPointsTo(), sizeAndAlignment->first);
 }
 
 void
@@ -1411,6 +1953,13 @@ Steensgaard::AnalyzeMemcpy(const jlm::rvsdg::simple_node & node)
     dstAddress.SetPointsTo(dummyLocation);
   }
 
+  // Memcpy copies the content of all fields, so we only track the content of the memory as a whole
+  if (IsFieldSensitive_)
+  {
+    LocationSet_->Collapse(*srcAddress.GetPointsTo());
+    LocationSet_->Collapse(*dstAddress.GetPointsTo());
+  }
+
   auto & srcMemory = LocationSet_->GetRootLocation(*srcAddress.GetPointsTo());
   auto & dstMemory = LocationSet_->GetRootLocation(*dstAddress.GetPointsTo());
 
@@ -1449,8 +1998,10 @@ Steensgaard::AnalyzeLambda(const lambda::node & lambda)
   /*
    * Handle function arguments
    */
-  auto callSummary = lambda.ComputeCallSummary();
-  if (callSummary->HasOnlyDirectCalls())
+  auto hasOnlyDirectCalls = CallGraphIndex_
+                              ? CallGraphIndex_->GetCallSummary(lambda).HasOnlyDirectCalls()
+                              : lambda.ComputeCallSummary()->HasOnlyDirectCalls();
+  if (hasOnlyDirectCalls)
   {
     for (auto & argument : lambda.fctarguments())
     {
@@ -1735,6 +2286,9 @@ Steensgaard::AnalyzeRvsdg(const jlm::rvsdg::graph & graph)
   add_imports(graph, *LocationSet_);
   AnalyzeRegion(*graph.root());
   MarkExportsAsEscaping(graph, *LocationSet_);
+
+  if (IsFieldSensitive_)
+    LocationSet_->CollapseOverlappingFields();
 }
 
 std::unique_ptr<PointsToGraph>
@@ -1750,6 +2304,7 @@ Steensgaard::Analyze(
     jlm::util::StatisticsCollector & statisticsCollector)
 {
   LocationSet_ = LocationSet::Create();
+  CallGraphIndex_ = module.GetObserver<CallGraphIndex>();
   auto statistics = Statistics::Create(module.SourceFileName());
 
   // Perform Steensgaard analysis
@@ -1773,6 +2328,7 @@ Steensgaard::Analyze(
 
   // Discard internal state to free up memory after we are done with the analysis
   LocationSet_.reset();
+  CallGraphIndex_ = nullptr;
 
   return pointsToGraph;
 }
@@ -1785,9 +2341,6 @@ Steensgaard::ConstructPointsToGraph(const LocationSet & locationSets)
   auto CreatePointsToGraphNode = [](const Location & location,
                                     PointsToGraph & pointsToGraph) -> PointsToGraph::Node &
   {
-    if (auto registerLocation = dynamic_cast<const RegisterLocation *>(&location))
-      return PointsToGraph::RegisterNode::Create(pointsToGraph, registerLocation->GetOutput());
-
     if (auto allocaLocation = dynamic_cast<const AllocaLocation *>(&location))
       return PointsToGraph::AllocaNode::Create(pointsToGraph, allocaLocation->GetNode());
 
@@ -1863,6 +2416,15 @@ Steensgaard::ConstructPointsToGraph(const LocationSet & locationSets)
       auto pointsToLocation = set.value()->GetPointsTo();
       if (pointsToLocation)
         toVisit.insert(pointsToLocation);
+
+      /*
+       * An escaped field makes the entire object escape, including all of its other fields.
+       */
+      if (auto parent = set.value()->GetParent())
+        toVisit.insert(parent);
+
+      for (auto & [offset, field] : set.value()->GetFields())
+        toVisit.insert(field);
     }
 
     return escapedMemoryNodes;
@@ -1881,23 +2443,70 @@ Steensgaard::ConstructPointsToGraph(const LocationSet & locationSets)
   for (auto & locationSet : locationSets)
   {
     memoryNodeMap[&locationSet] = {};
+    std::vector<const RegisterLocation *> registerLocations;
     for (auto & location : locationSet)
     {
       /*
        * We can ignore dummy nodes. They only exist for structural purposes and have no equivalent
-       * in the RVSDG.
+       * in the RVSDG. Field nodes are created below for each memory node of their object.
        */
-      if (dynamic_cast<const DummyLocation *>(location))
+      if (dynamic_cast<const DummyLocation *>(location)
+          || dynamic_cast<const FieldLocation *>(location))
         continue;
 
+      if (RegisterLocation::IsEscapingModule(*location))
+        moduleEscapingRegisterLocations.insert(jlm::util::AssertedCast<RegisterLocation>(location));
+
+      if (auto registerLocation = dynamic_cast<const RegisterLocation *>(location))
+      {
+        registerLocations.push_back(registerLocation);
+        continue;
+      }
+
       auto pointsToGraphNode = &CreatePointsToGraphNode(*location, *pointsToGraph);
       locationMap[location] = pointsToGraphNode;
 
       if (auto memoryNode = dynamic_cast<PointsToGraph::MemoryNode *>(pointsToGraphNode))
         memoryNodeMap[&locationSet].push_back(memoryNode);
+    }
 
-      if (RegisterLocation::IsEscapingModule(*location))
-        moduleEscapingRegisterLocations.insert(jlm::util::AssertedCast<RegisterLocation>(location));
+    /*
+     * All registers of a set point to the same memory nodes, and share a single register node.
+     */
+    if (!registerLocations.empty())
+    {
+      jlm::util::HashSet<const jlm::rvsdg::output *> outputs;
+      for (auto registerLocation : registerLocations)
+        outputs.Insert(&registerLocation->GetOutput());
+
+      auto & registerNode = PointsToGraph::RegisterNode::Create(*pointsToGraph, std::move(outputs));
+      for (auto registerLocation : registerLocations)
+        locationMap[registerLocation] = &registerNode;
+    }
+  }
+
+  /*
+   * Create the field nodes. The memory nodes of an object only represent the memory at offset
+   * zero, as accesses through a pointer to the object that reach into other fields collapsed the
+   * object throughout the analysis.
+   */
+  std::unordered_map<
+      const jlm::util::disjointset<Location *>::set *,
+      std::vector<PointsToGraph::FieldNode *>>
+      fieldNodeMap;
+  for (auto & set : locationSets)
+  {
+    auto parent = set.value()->GetParent();
+    if (parent == nullptr)
+      continue;
+
+    auto & objectSet = locationSets.GetSet(*parent);
+    for (auto & objectNode : memoryNodeMap[&objectSet])
+    {
+      auto & fieldNode =
+          PointsToGraph::FieldNode::Create(*pointsToGraph, *objectNode, set.value()->GetOffset());
+      memoryNodeMap[&set].push_back(&fieldNode);
+      fieldNodeMap[&set].push_back(&fieldNode);
     }
   }
 
@@ -1915,13 +2524,8 @@ Steensgaard::ConstructPointsToGraph(const LocationSet & locationSets)
     bool pointsToEscapedMemory =
         locationSets.GetSet(**set.begin()).value()->PointsToEscapedMemory();
 
-    for (auto & location : set)
+    auto addEdges = [&](PointsToGraph::Node & pointsToGraphNode)
     {
-      if (dynamic_cast<DummyLocation *>(location))
-        continue;
-
-      auto & pointsToGraphNode = *locationMap[location];
-
       if (pointsToUnknown)
         pointsToGraphNode.AddEdge(pointsToGraph->GetUnknownMemoryNode());
 
@@ -1936,14 +2540,29 @@ Steensgaard::ConstructPointsToGraph(const LocationSet & locationSets)
 
       auto pointsToLocation = set.value()->GetPointsTo();
       if (pointsToLocation == nullptr)
-        continue;
+        return;
 
       auto & pointsToSet = locationSets.GetSet(*pointsToLocation);
       auto & memoryNodes = memoryNodeMap[&pointsToSet];
 
       for (auto & memoryNode : memoryNodes)
         pointsToGraphNode.AddEdge(*memoryNode);
+    };
+
+    for (auto & fieldNode : fieldNodeMap[&set])
+      addEdges(*fieldNode);
+
+    std::unordered_set<PointsToGraph::Node *> pointsToGraphNodes;
+    for (auto & location : set)
+    {
+      if (dynamic_cast<DummyLocation *>(location) || dynamic_cast<FieldLocation *>(location))
+        continue;
+
+      pointsToGraphNodes.insert(locationMap[location]);
     }
+
+    for (auto pointsToGraphNode : pointsToGraphNodes)
+      addEdges(*pointsToGraphNode);
   }
 
   return pointsToGraph;
@@ -1961,6 +2580,9 @@ Steensgaard::RedirectUnknownMemoryNodeSources(PointsToGraph & pointsToGraph)
     for (auto & deltaNode : pointsToGraph.DeltaNodes())
       memoryNodes.push_back(&deltaNode);
 
+    for (auto & fieldNode : pointsToGraph.FieldNodes())
+      memoryNodes.push_back(&fieldNode);
+
     for (auto & lambdaNode : pointsToGraph.LambdaNodes())
       memoryNodes.push_back(&lambdaNode);
 
@@ -8,6 +8,11 @@
 
 #include <jlm/llvm/opt/alias-analyses/AliasAnalysis.hpp>
 
+namespace jlm::llvm
+{
+class CallGraphIndex;
+}
+
 namespace jlm::llvm::aa
 {
 
@@ -16,9 +21,17 @@ class LocationSet;
 /** \brief Steensgaard alias analysis
  *
  * This class implements a Steensgaard alias analysis. The analysis is inter-procedural,
- * field-insensitive, context-insensitive, flow-insensitive, and uses a static heap model. It is an
- * implementation corresponding to the algorithm presented in Bjarne Steensgaard - Points-to
- * Analysis in Almost Linear Time.
+ * context-insensitive, flow-insensitive, and uses a static heap model. It is an implementation
+ * corresponding to the algorithm presented in Bjarne Steensgaard - Points-to Analysis in Almost
+ * Linear Time.
+ *
+ * The analysis is field-insensitive by default. In field-sensitive mode, addresses computed by
+ * GetElementPtr operations with constant offsets refer to a separate location for each field of a
+ * memory location, and the resulting PointsToGraph contains a FieldNode for each of them. The
+ * memory location itself represents the field at offset zero. Memory locations are collapsed into
+ * a single location if they are accessed with non-constant offsets, by memcpy, by loads or stores
+ * of aggregates, or by loads or stores that reach from one field into the next. The offsets and
+ * access sizes are computed with the x86-64 data layout.
  */
 class Steensgaard final : public AliasAnalysis
 {
@@ -29,6 +42,12 @@ public:
 
   Steensgaard();
 
+  /**
+   * @param isFieldSensitive Determines whether the analysis distinguishes the fields of memory
+   * locations.
+   */
+  explicit Steensgaard(bool isFieldSensitive);
+
   Steensgaard(const Steensgaard &) = delete;
 
   Steensgaard(Steensgaard &&) = delete;
@@ -99,6 +118,13 @@ private:
   void
   AnalyzeGep(const jlm::rvsdg::simple_node & node);
 
+  /**
+   * Records the load or store of a value of type \p type from \p address in the field-sensitive
+   * analysis. Accesses of aggregates collapse the accessed memory.
+   */
+  void
+  AnalyzeFieldAccess(const jlm::rvsdg::output & address, const jlm::rvsdg::type & type);
+
   void
   AnalyzeBitcast(const jlm::rvsdg::simple_node & node);
 
@@ -152,7 +178,11 @@ private:
   static void
   RedirectUnknownMemoryNodeSources(PointsToGraph & pointsToGraph);
 
+  bool IsFieldSensitive_;
   std::unique_ptr<LocationSet> LocationSet_;
+
+  // The call graph index of the analyzed module, or nullptr if the module has none
+  CallGraphIndex * CallGraphIndex_;
 };
 
 }
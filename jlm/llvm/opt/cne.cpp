@@ -7,9 +7,13 @@
 #include <jlm/llvm/ir/RvsdgModule.hpp>
 #include <jlm/llvm/opt/cne.hpp>
 #include <jlm/rvsdg/traverser.hpp>
+#include <jlm/util/disjointset.hpp>
 #include <jlm/util/Statistics.hpp>
 #include <jlm/util/time.hpp>
 
+#include <map>
+#include <vector>
+
 namespace jlm::llvm
 {
 
@@ -85,31 +89,33 @@ private:
   util::timer marktimer_, diverttimer_;
 };
 
-typedef std::unordered_set<jlm::rvsdg::output *> congruence_set;
+typedef util::disjointset<jlm::rvsdg::output *>::set congruence_class;
 
+static inline size_t
+CombineHashes(size_t seed, size_t value) noexcept
+{
+  return seed ^ (value + 0x9e3779b97f4a7c15 + (seed << 6) + (seed >> 2));
+}
+
+/**
+ * The congruence context partitions outputs into classes of congruent outputs. A class is
+ * identified by the representative of its disjoint set, and the mark phase only ever merges a
+ * fresh singleton class into an existing class. The representative of an existing class therefore
+ * never changes, and representatives can be used as class identifiers for hashing throughout the
+ * mark phase.
+ */
 class cnectx
 {
 public:
+  /**
+   * Marks \p o1 and \p o2 as congruent. The class of \p o1 is merged into the class of \p o2.
+   */
   inline void
   mark(jlm::rvsdg::output * o1, jlm::rvsdg::output * o2)
   {
-    auto s1 = set(o1);
-    auto s2 = set(o2);
-
-    if (s1 == s2)
-      return;
-
-    if (s2->size() < s1->size())
-    {
-      s1 = outputs_[o2];
-      s2 = outputs_[o1];
-    }
-
-    for (auto & o : *s1)
-    {
-      s2->insert(o);
-      outputs_[o] = s2;
-    }
+    classes_.find_or_insert(o1);
+    classes_.find_or_insert(o2);
+    classes_.merge(o2, o1);
   }
 
   inline void
@@ -121,205 +127,189 @@ public:
       mark(n1->output(n), n2->output(n));
   }
 
-  inline bool
-  congruent(jlm::rvsdg::output * o1, jlm::rvsdg::output * o2) const noexcept
-  {
-    if (o1 == o2)
-      return true;
-
-    auto it = outputs_.find(o1);
-    if (it == outputs_.end())
-      return false;
-
-    return it->second->find(o2) != it->second->end();
-  }
-
-  inline bool
-  congruent(const jlm::rvsdg::input * i1, const jlm::rvsdg::input * i2) const noexcept
+  const congruence_class *
+  set(jlm::rvsdg::output * output)
   {
-    return congruent(i1->origin(), i2->origin());
-  }
-
-  congruence_set *
-  set(jlm::rvsdg::output * output) noexcept
-  {
-    if (outputs_.find(output) == outputs_.end())
-    {
-      std::unique_ptr<congruence_set> set(new congruence_set({ output }));
-      outputs_[output] = set.get();
-      sets_.insert(std::move(set));
-    }
-
-    return outputs_[output];
-  }
-
-private:
-  std::unordered_set<std::unique_ptr<congruence_set>> sets_;
-  std::unordered_map<const jlm::rvsdg::output *, congruence_set *> outputs_;
-};
-
-class vset
-{
-public:
-  void
-  insert(const jlm::rvsdg::output * o1, const jlm::rvsdg::output * o2)
-  {
-    auto it = sets_.find(o1);
-    if (it != sets_.end())
-      sets_[o1].insert(o2);
-    else
-      sets_[o1] = { o2 };
-
-    it = sets_.find(o2);
-    if (it != sets_.end())
-      sets_[o2].insert(o1);
-    else
-      sets_[o2] = { o1 };
+    return classes_.find_or_insert(output);
   }
 
+  /**
+   * Marks the class of \p output as diverted.
+   *
+   * @return True if the class of \p output contains outputs other than \p output and was not
+   * diverted before, otherwise false.
+   */
   bool
-  visited(const jlm::rvsdg::output * o1, const jlm::rvsdg::output * o2) const
+  MarkDiverted(jlm::rvsdg::output * output)
   {
-    auto it = sets_.find(o1);
-    if (it == sets_.end())
+    if (!classes_.contains(output))
       return false;
 
-    return it->second.find(o2) != it->second.end();
-  }
-
-private:
-  std::unordered_map<const jlm::rvsdg::output *, std::unordered_set<const jlm::rvsdg::output *>>
-      sets_;
-};
-
-/* mark phase */
-
-static bool
-congruent(jlm::rvsdg::output * o1, jlm::rvsdg::output * o2, vset & vs, cnectx & ctx)
-{
-  if (ctx.congruent(o1, o2) || vs.visited(o1, o2))
-    return true;
-
-  if (o1->type() != o2->type())
-    return false;
-
-  if (is_theta_argument(o1) && is_theta_argument(o2))
-  {
-    JLM_ASSERT(o1->region()->node() == o2->region()->node());
-    auto a1 = static_cast<jlm::rvsdg::argument *>(o1);
-    auto a2 = static_cast<jlm::rvsdg::argument *>(o2);
-    vs.insert(a1, a2);
-    auto i1 = a1->input(), i2 = a2->input();
-    if (!congruent(a1->input()->origin(), a2->input()->origin(), vs, ctx))
+    auto set = classes_.find(output);
+    if (set->nmembers() == 1)
       return false;
 
-    auto output1 = o1->region()->node()->output(i1->index());
-    auto output2 = o2->region()->node()->output(i2->index());
-    return congruent(output1, output2, vs, ctx);
-  }
-
-  auto n1 = jlm::rvsdg::node_output::node(o1);
-  auto n2 = jlm::rvsdg::node_output::node(o2);
-  if (jlm::rvsdg::is<jlm::rvsdg::theta_op>(n1) && jlm::rvsdg::is<jlm::rvsdg::theta_op>(n2)
-      && n1 == n2)
-  {
-    auto so1 = static_cast<jlm::rvsdg::structural_output *>(o1);
-    auto so2 = static_cast<jlm::rvsdg::structural_output *>(o2);
-    vs.insert(o1, o2);
-    auto r1 = so1->results.first();
-    auto r2 = so2->results.first();
-    return congruent(r1->origin(), r2->origin(), vs, ctx);
+    return diverted_.insert(set).second;
   }
 
-  if (jlm::rvsdg::is<jlm::rvsdg::gamma_op>(n1) && n1 == n2)
+  /**
+   * Looks up a previously inserted simple node that is congruent to \p node, i.e., a node in the
+   * same region with an equal operation and congruent inputs. If no such node exists, then \p node
+   * is inserted.
+   *
+   * @param node The simple node for which a congruent node is looked up.
+   * @return A congruent simple node, or nullptr if \p node was inserted.
+   */
+  const jlm::rvsdg::simple_node *
+  LookupOrInsert(const jlm::rvsdg::simple_node * node)
   {
-    auto so1 = static_cast<jlm::rvsdg::structural_output *>(o1);
-    auto so2 = static_cast<jlm::rvsdg::structural_output *>(o2);
-    auto r1 = so1->results.begin();
-    auto r2 = so2->results.begin();
-    for (; r1 != so1->results.end(); r1++, r2++)
+    auto hash = CombineHashes(
+        std::hash<const jlm::rvsdg::region *>()(node->region()),
+        node->operation().hash());
+    for (size_t n = 0; n < node->ninputs(); n++)
     {
-      JLM_ASSERT(r1->region() == r2->region());
-      if (!congruent(r1->origin(), r2->origin(), vs, ctx))
-        return false;
+      auto set = this->set(node->input(n)->origin());
+      hash = CombineHashes(hash, std::hash<const congruence_class *>()(set));
     }
-    return true;
-  }
-
-  if (is_gamma_argument(o1) && is_gamma_argument(o2))
-  {
-    JLM_ASSERT(o1->region()->node() == o2->region()->node());
-    auto a1 = static_cast<jlm::rvsdg::argument *>(o1);
-    auto a2 = static_cast<jlm::rvsdg::argument *>(o2);
-    return congruent(a1->input()->origin(), a2->input()->origin(), vs, ctx);
-  }
 
-  if (jlm::rvsdg::is<jlm::rvsdg::simple_op>(n1) && jlm::rvsdg::is<jlm::rvsdg::simple_op>(n2)
-      && n1->operation() == n2->operation() && n1->ninputs() == n2->ninputs()
-      && o1->index() == o2->index())
-  {
-    for (size_t n = 0; n < n1->ninputs(); n++)
+    auto range = nodes_.equal_range(hash);
+    for (auto it = range.first; it != range.second; it++)
     {
-      auto origin1 = n1->input(n)->origin();
-      auto origin2 = n2->input(n)->origin();
-      if (!congruent(origin1, origin2, vs, ctx))
-        return false;
+      auto other = it->second;
+      if (other->region() != node->region() || other->ninputs() != node->ninputs()
+          || other->operation() != node->operation())
+        continue;
+
+      size_t n;
+      for (n = 0; n < node->ninputs(); n++)
+      {
+        if (set(node->input(n)->origin()) != set(other->input(n)->origin()))
+          break;
+      }
+      if (n == node->ninputs())
+        return other;
     }
-    return true;
+
+    nodes_.emplace(hash, node);
+    return nullptr;
   }
 
-  return false;
-}
+private:
+  util::disjointset<jlm::rvsdg::output *> classes_;
+  std::unordered_set<const congruence_class *> diverted_;
+  std::unordered_multimap<size_t, const jlm::rvsdg::simple_node *> nodes_;
+};
 
-static bool
-congruent(jlm::rvsdg::output * o1, jlm::rvsdg::output * o2, cnectx & ctx)
-{
-  vset vs;
-  return congruent(o1, o2, vs, ctx);
-}
+/* mark phase */
 
 static void
-mark_arguments(jlm::rvsdg::structural_input * i1, jlm::rvsdg::structural_input * i2, cnectx & ctx)
-{
-  JLM_ASSERT(i1->node() && i1->node() == i2->node());
-  JLM_ASSERT(i1->arguments.size() == i2->arguments.size());
+mark(jlm::rvsdg::region *, cnectx &);
 
-  auto a1 = i1->arguments.begin();
-  auto a2 = i2->arguments.begin();
-  for (; a1 != i1->arguments.end(); a1++, a2++)
+/**
+ * Marks the first argument of all inputs of \p node that have congruent origins.
+ */
+static void
+mark_dependencies(const jlm::rvsdg::structural_node * node, cnectx & ctx)
+{
+  std::unordered_map<const congruence_class *, jlm::rvsdg::structural_input *> leaders;
+  for (size_t n = 0; n < node->ninputs(); n++)
   {
-    JLM_ASSERT(a1->region() == a2->region());
-    if (congruent(a1.ptr(), a2.ptr(), ctx))
-      ctx.mark(a1.ptr(), a2.ptr());
+    auto input = node->input(n);
+    auto leader = leaders.emplace(ctx.set(input->origin()), input).first->second;
+    if (leader != input)
+      ctx.mark(input->arguments.first(), leader->arguments.first());
   }
 }
 
-static void
-mark(jlm::rvsdg::region *, cnectx &);
-
 static void
 mark_gamma(const jlm::rvsdg::structural_node * node, cnectx & ctx)
 {
   JLM_ASSERT(jlm::rvsdg::is<jlm::rvsdg::gamma_op>(node->operation()));
 
   /* mark entry variables */
-  for (size_t i1 = 1; i1 < node->ninputs(); i1++)
+  std::unordered_map<const congruence_class *, jlm::rvsdg::structural_input *> leaders;
+  for (size_t i = 1; i < node->ninputs(); i++)
   {
-    for (size_t i2 = i1 + 1; i2 < node->ninputs(); i2++)
-      mark_arguments(node->input(i1), node->input(i2), ctx);
+    auto input = node->input(i);
+    auto leader = leaders.emplace(ctx.set(input->origin()), input).first->second;
+    if (leader == input)
+      continue;
+
+    JLM_ASSERT(input->arguments.size() == leader->arguments.size());
+    auto a1 = input->arguments.begin();
+    auto a2 = leader->arguments.begin();
+    for (; a1 != input->arguments.end(); a1++, a2++)
+    {
+      JLM_ASSERT(a1->region() == a2->region());
+      ctx.mark(a1.ptr(), a2.ptr());
+    }
   }
 
   for (size_t n = 0; n < node->nsubregions(); n++)
     mark(node->subregion(n), ctx);
 
   /* mark exit variables */
-  for (size_t o1 = 0; o1 < node->noutputs(); o1++)
+  std::map<std::vector<const congruence_class *>, jlm::rvsdg::output *> exitLeaders;
+  for (size_t o = 0; o < node->noutputs(); o++)
+  {
+    auto output = node->output(o);
+
+    std::vector<const congruence_class *> classes;
+    for (auto & result : output->results)
+      classes.push_back(ctx.set(result.origin()));
+
+    auto leader = exitLeaders.emplace(std::move(classes), output).first->second;
+    if (leader != output)
+      ctx.mark(output, leader);
+  }
+}
+
+/**
+ * Partitions the loop variables of \p theta into blocks of potentially congruent loop variables.
+ *
+ * The partition starts optimistically with loop variables that have congruent inputs in the same
+ * block. The subregion is then marked in a scratch context under the assumption that all loop
+ * variables of a block are congruent, and blocks are split by the congruence classes of their
+ * results. This is repeated until no block is split anymore.
+ *
+ * @return The block index of each loop variable.
+ */
+static std::vector<size_t>
+PartitionLoopVariables(const jlm::rvsdg::theta_node * theta, cnectx & ctx)
+{
+  std::vector<size_t> blocks(theta->ninputs());
+  std::unordered_map<const congruence_class *, size_t> initialBlocks;
+  for (size_t n = 0; n < theta->ninputs(); n++)
+    blocks[n] = initialBlocks.emplace(ctx.set(theta->input(n)->origin()), n).first->second;
+
+  auto numBlocks = initialBlocks.size();
+  if (numBlocks == theta->ninputs())
+    return blocks;
+
+  while (true)
   {
-    for (size_t o2 = o1 + 1; o2 < node->noutputs(); o2++)
+    cnectx scratch;
+    for (size_t n = 0; n < theta->ninputs(); n++)
+    {
+      if (blocks[n] != n)
+        scratch.mark(theta->input(n)->argument(), theta->input(blocks[n])->argument());
+    }
+    mark(theta->subregion(), scratch);
+
+    std::map<std::pair<size_t, const congruence_class *>, size_t> refinedBlocks;
+    std::vector<size_t> refined(theta->ninputs());
+    for (size_t n = 0; n < theta->ninputs(); n++)
     {
-      if (congruent(node->output(o1), node->output(o2), ctx))
-        ctx.mark(node->output(o1), node->output(o2));
+      auto result = theta->input(n)->result();
+      auto key = std::make_pair(blocks[n], scratch.set(result->origin()));
+      refined[n] = refinedBlocks.emplace(key, n).first->second;
     }
+
+    blocks = std::move(refined);
+    if (refinedBlocks.size() == numBlocks)
+      return blocks;
+
+    numBlocks = refinedBlocks.size();
   }
 }
 
@@ -330,18 +320,16 @@ mark_theta(const jlm::rvsdg::structural_node * node, cnectx & ctx)
   auto theta = static_cast<const jlm::rvsdg::theta_node *>(node);
 
   /* mark loop variables */
-  for (size_t i1 = 0; i1 < theta->ninputs(); i1++)
+  auto blocks = PartitionLoopVariables(theta, ctx);
+  for (size_t n = 0; n < theta->ninputs(); n++)
   {
-    for (size_t i2 = i1 + 1; i2 < theta->ninputs(); i2++)
-    {
-      auto input1 = theta->input(i1);
-      auto input2 = theta->input(i2);
-      if (congruent(input1->argument(), input2->argument(), ctx))
-      {
-        ctx.mark(input1->argument(), input2->argument());
-        ctx.mark(input1->output(), input2->output());
-      }
-    }
+    if (blocks[n] == n)
+      continue;
+
+    auto input = theta->input(n);
+    auto leader = theta->input(blocks[n]);
+    ctx.mark(input->argument(), leader->argument());
+    ctx.mark(input->output(), leader->output());
   }
 
   mark(node->subregion(0), ctx);
@@ -352,18 +340,7 @@ mark_lambda(const jlm::rvsdg::structural_node * node, cnectx & ctx)
 {
   JLM_ASSERT(jlm::rvsdg::is<lambda::operation>(node));
 
-  /* mark dependencies */
-  for (size_t i1 = 0; i1 < node->ninputs(); i1++)
-  {
-    for (size_t i2 = i1 + 1; i2 < node->ninputs(); i2++)
-    {
-      auto input1 = node->input(i1);
-      auto input2 = node->input(i2);
-      if (ctx.congruent(input1, input2))
-        ctx.mark(input1->arguments.first(), input2->arguments.first());
-    }
-  }
-
+  mark_dependencies(node, ctx);
   mark(node->subregion(0), ctx);
 }
 
@@ -372,18 +349,7 @@ mark_phi(const jlm::rvsdg::structural_node * node, cnectx & ctx)
 {
   JLM_ASSERT(is<phi::operation>(node));
 
-  /* mark dependencies */
-  for (size_t i1 = 0; i1 < node->ninputs(); i1++)
-  {
-    for (size_t i2 = i1 + 1; i2 < node->ninputs(); i2++)
-    {
-      auto input1 = node->input(i1);
-      auto input2 = node->input(i2);
-      if (ctx.congruent(input1, input2))
-        ctx.mark(input1->arguments.first(), input2->arguments.first());
-    }
-  }
-
+  mark_dependencies(node, ctx);
   mark(node->subregion(0), ctx);
 }
 
@@ -406,46 +372,14 @@ mark(const jlm::rvsdg::structural_node * node, cnectx & ctx)
 
   auto & op = node->operation();
   JLM_ASSERT(map.find(typeid(op)) != map.end());
-  map[typeid(op)](node, ctx);
+  map.at(typeid(op))(node, ctx);
 }
 
 static void
 mark(const jlm::rvsdg::simple_node * node, cnectx & ctx)
 {
-  if (node->ninputs() == 0)
-  {
-    for (const auto & other : node->region()->top_nodes)
-    {
-      if (&other != node && node->operation() == other.operation())
-      {
-        ctx.mark(node, &other);
-        break;
-      }
-    }
-    return;
-  }
-
-  auto set = ctx.set(node->input(0)->origin());
-  for (const auto & origin : *set)
-  {
-    for (const auto & user : *origin)
-    {
-      auto ni = dynamic_cast<const jlm::rvsdg::node_input *>(user);
-      auto other = ni ? ni->node() : nullptr;
-      if (!other || other == node || other->operation() != node->operation()
-          || other->ninputs() != node->ninputs())
-        continue;
-
-      size_t n;
-      for (n = 0; n < node->ninputs(); n++)
-      {
-        if (!ctx.congruent(node->input(n), other->input(n)))
-          break;
-      }
-      if (n == node->ninputs())
-        ctx.mark(node, other);
-    }
-  }
+  if (auto other = ctx.LookupOrInsert(node))
+    ctx.mark(node, other);
 }
 
 static void
@@ -465,10 +399,11 @@ mark(jlm::rvsdg::region * region, cnectx & ctx)
 static void
 divert_users(jlm::rvsdg::output * output, cnectx & ctx)
 {
-  auto set = ctx.set(output);
-  for (auto & other : *set)
+  if (!ctx.MarkDiverted(output))
+    return;
+
+  for (auto & other : *ctx.set(output))
     other->divert_users(output);
-  set->clear();
 }
 
 static void
@@ -515,7 +450,7 @@ divert_theta(jlm::rvsdg::structural_node * node, cnectx & ctx)
 
   for (const auto & lv : *theta)
   {
-    JLM_ASSERT(ctx.set(lv->argument())->size() == ctx.set(lv)->size());
+    JLM_ASSERT(ctx.set(lv->argument())->nmembers() == ctx.set(lv)->nmembers());
     divert_users(lv->argument(), ctx);
     divert_users(lv, ctx);
   }
@@ -559,7 +494,7 @@ divert(jlm::rvsdg::structural_node * node, cnectx & ctx)
 
   auto & op = node->operation();
   JLM_ASSERT(map.find(typeid(op)) != map.end());
-  map[typeid(op)](node, ctx);
+  map.at(typeid(op))(node, ctx);
 }
 
 static void
@@ -604,4 +539,11 @@ cne::run(RvsdgModule & module, util::StatisticsCollector & statisticsCollector)
   llvm::cne(module, statisticsCollector);
 }
 
+bool
+cne::ReportsModifications() const noexcept
+{
+  // Congruent outputs are only redirected, and no outputs are created
+  return true;
+}
+
 }
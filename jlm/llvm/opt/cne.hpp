@@ -15,6 +15,9 @@ class RvsdgModule;
 
 /**
  * \brief Common Node Elimination
+ *
+ * The optimization is not function-local, as the congruence of the context variables of a lambda
+ * node depends on the congruence of their origins in the enclosing regions.
  */
 class cne final : public optimization
 {
@@ -23,6 +26,9 @@ public:
 
   virtual void
   run(RvsdgModule & module, jlm::util::StatisticsCollector & statisticsCollector) override;
+
+  [[nodiscard]] bool
+  ReportsModifications() const noexcept override;
 };
 
 }
@@ -3,13 +3,19 @@
  * See COPYING for terms of redistribution.
  */
 
+#include <jlm/llvm/ir/CallGraphIndex.hpp>
 #include <jlm/llvm/ir/operators.hpp>
 #include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/DeadNodeElimination.hpp>
 #include <jlm/llvm/opt/inlining.hpp>
 #include <jlm/rvsdg/traverser.hpp>
+#include <jlm/util/HashSet.hpp>
 #include <jlm/util/Statistics.hpp>
 #include <jlm/util/time.hpp>
 
+#include <unordered_map>
+#include <vector>
+
 namespace jlm::llvm
 {
 
@@ -22,7 +28,8 @@ public:
   ilnstat()
       : Statistics(Statistics::Id::FunctionInlining),
         nnodes_before_(0),
-        nnodes_after_(0)
+        nnodes_after_(0),
+        NumInlinedCalls_(0)
   {}
 
   void
@@ -33,16 +40,25 @@ public:
   }
 
   void
-  stop(const jlm::rvsdg::graph & graph)
+  stop(const jlm::rvsdg::graph & graph, size_t numInlinedCalls)
   {
     nnodes_after_ = jlm::rvsdg::nnodes(graph.root());
+    NumInlinedCalls_ = numInlinedCalls;
     timer_.stop();
   }
 
   virtual std::string
   ToString() const override
   {
-    return util::strfmt("ILN ", nnodes_before_, " ", nnodes_after_, " ", timer_.ns());
+    return util::strfmt(
+        "ILN ",
+        nnodes_before_,
+        " ",
+        nnodes_after_,
+        " ",
+        timer_.ns(),
+        " #InlinedCalls:",
+        NumInlinedCalls_);
   }
 
   static std::unique_ptr<ilnstat>
@@ -53,6 +69,7 @@ public:
 
 private:
   size_t nnodes_before_, nnodes_after_;
+  size_t NumInlinedCalls_;
   util::timer timer_;
 };
 
@@ -124,15 +141,23 @@ route_dependencies(const lambda::node * lambda, const jlm::rvsdg::simple_node *
   return deps;
 }
 
-void
-inlineCall(jlm::rvsdg::simple_node * call, const lambda::node * lambda)
+/**
+ * Copies the subregion of \p lambda into the region of \p call and diverts the users of the call
+ * outputs to the copies, but leaves the call node in place. Afterwards, \p smap maps the
+ * context variable arguments of \p lambda to their routed dependencies, and the outputs of the
+ * nodes in the subregion to their copies.
+ */
+static void
+copyCalleeBody(
+    jlm::rvsdg::simple_node * call,
+    const lambda::node * lambda,
+    jlm::rvsdg::substitution_map & smap)
 {
   JLM_ASSERT(is<CallOperation>(call));
 
   auto deps = route_dependencies(lambda, call);
   JLM_ASSERT(lambda->ncvarguments() == deps.size());
 
-  jlm::rvsdg::substitution_map smap;
   for (size_t n = 1; n < call->ninputs(); n++)
   {
     auto argument = lambda->fctargument(n - 1);
@@ -149,35 +174,267 @@ inlineCall(jlm::rvsdg::simple_node * call, const lambda::node * lambda)
     JLM_ASSERT(smap.lookup(output));
     call->output(n)->divert_users(smap.lookup(output));
   }
+}
+
+void
+inlineCall(jlm::rvsdg::simple_node * call, const lambda::node * lambda)
+{
+  jlm::rvsdg::substitution_map smap;
+  copyCalleeBody(call, lambda, smap);
   remove(call);
 }
 
+/**
+ * @return The node that produces \p output. For the argument of a subregion, this is the
+ * structural node of the subregion, and for the arguments of the root region, this is nullptr.
+ */
+static jlm::rvsdg::node *
+GetProducer(const jlm::rvsdg::output & output)
+{
+  if (auto node = jlm::rvsdg::node_output::node(&output))
+    return node;
+
+  return output.region()->node();
+}
+
+/**
+ * Inlines \p call and reports the created outputs to the observers of \p rvsdgModule. The call
+ * node is removed afterwards, and the producers of its operands, which might have become dead, are
+ * added to \p dirtyNodes. The substitution map \p smap is cleared before it is used, such that
+ * its tables can be reused across calls.
+ */
+static void
+inlineCall(
+    RvsdgModule & rvsdgModule,
+    CallNode & call,
+    const lambda::node & lambda,
+    jlm::rvsdg::substitution_map & smap,
+    util::HashSet<jlm::rvsdg::node *> & dirtyNodes)
+{
+  smap.clear();
+  copyCalleeBody(&call, &lambda, smap);
+
+  // Routing a dependency to the call creates entry variables, loop variables, and context
+  // variables along the way, all of which carry the value of the dependency.
+  for (size_t n = 0; n < lambda.ncvarguments(); n++)
+  {
+    auto producer = find_producer(lambda.input(n));
+    for (auto output = smap.lookup(lambda.cvargument(n)); output != producer;)
+    {
+      auto input = static_cast<jlm::rvsdg::argument *>(output)->input();
+      for (auto & argument : input->arguments)
+        rvsdgModule.NotifyOutputCopied(*producer, argument);
+      if (auto thetaInput = dynamic_cast<const jlm::rvsdg::theta_input *>(input))
+        rvsdgModule.NotifyOutputCopied(*producer, *thetaInput->output());
+
+      output = input->origin();
+    }
+  }
+  rvsdgModule.NotifyRegionCopied(*lambda.subregion(), smap);
+
+  for (size_t n = 0; n < call.ninputs(); n++)
+  {
+    if (auto producer = GetProducer(*call.input(n)->origin()))
+      dirtyNodes.Insert(producer);
+  }
+  dirtyNodes.Remove(&call);
+  remove(&call);
+}
+
+/**
+ * A call node together with the number of theta nodes that enclose it within its function.
+ */
+struct CallSite
+{
+  CallNode * Call;
+  size_t LoopDepth;
+};
+
 static void
-inlining(jlm::rvsdg::graph & rvsdg)
+CollectCallSites(jlm::rvsdg::region & region, size_t loopDepth, std::vector<CallSite> & callSites)
+{
+  for (auto & node : region.nodes)
+  {
+    if (auto callNode = dynamic_cast<CallNode *>(&node))
+    {
+      callSites.push_back({ callNode, loopDepth });
+    }
+    else if (auto structuralNode = dynamic_cast<jlm::rvsdg::structural_node *>(&node))
+    {
+      auto depth = is<jlm::rvsdg::theta_op>(structuralNode) ? loopDepth + 1 : loopDepth;
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+        CollectCallSites(*structuralNode->subregion(n), depth, callSites);
+    }
+  }
+}
+
+/**
+ * @return The number of arguments of \p call that are produced by nullary simple nodes, e.g.,
+ * constants.
+ */
+static size_t
+NumConstantArguments(const CallNode & call)
+{
+  size_t numConstantArguments = 0;
+  for (size_t n = 1; n < call.ninputs(); n++)
+  {
+    auto node = jlm::rvsdg::node_output::node(call.input(n)->origin());
+    if (dynamic_cast<const jlm::rvsdg::simple_node *>(node) && node->ninputs() == 0)
+      numConstantArguments++;
+  }
+
+  return numConstantArguments;
+}
+
+/** \brief Function inlining context
+ *
+ * Applies the inlining cost model to the call sites of the lambda nodes, and caches the sizes of
+ * the callees. The callees are only modified before they are considered for inlining, as the
+ * lambda nodes are processed bottom-up in the call graph.
+ */
+class InliningContext final
 {
-  for (auto node : rvsdg::topdown_traverser(rvsdg.root()))
+public:
+  InliningContext(RvsdgModule & rvsdgModule, const InliningSettings & settings)
+      : RvsdgModule_(rvsdgModule),
+        CallGraphIndex_(CallGraphIndex::GetOrCreate(rvsdgModule)),
+        Settings_(settings),
+        NumInlinedCalls_(0)
+  {}
+
+  /**
+   * Inlines the calls of \p caller that are selected by the cost model. The producers of all
+   * operands of the inlined calls are added to \p dirtyNodes.
+   */
+  void
+  InlineCalls(lambda::node & caller, util::HashSet<jlm::rvsdg::node *> & dirtyNodes)
   {
-    if (auto lambda = dynamic_cast<const lambda::node *>(node))
+    std::vector<CallSite> callSites;
+    CollectCallSites(*caller.subregion(), 0, callSites);
+
+    // Take all decisions before any call is inlined, such that the inlined calls do not affect the
+    // cost model of the other calls of the caller.
+    std::vector<std::pair<CallNode *, const lambda::node *>> inlinedCalls;
+    for (auto & callSite : callSites)
     {
-      auto callSummary = lambda->ComputeCallSummary();
+      auto classifier = CallNode::ClassifyCall(*callSite.Call);
+      if (!classifier->IsNonRecursiveDirectCall())
+        continue;
+
+      // Only lambda nodes of the root region can be inlined, as the dependencies of lambda nodes
+      // in phi nodes cannot be routed to the call.
+      auto & callee = *classifier->GetLambdaOutput().node();
+      if (callee.region() != RvsdgModule_.Rvsdg().root() || &callee == &caller)
+        continue;
+
+      if (ShouldInline(callSite, callee))
+        inlinedCalls.emplace_back(callSite.Call, &callee);
+    }
+
+    for (auto & [call, callee] : inlinedCalls)
+      inlineCall(RvsdgModule_, *call, *callee, SubstitutionMap_, dirtyNodes);
+
+    NumInlinedCalls_ += inlinedCalls.size();
+  }
+
+  [[nodiscard]] size_t
+  NumInlinedCalls() const noexcept
+  {
+    return NumInlinedCalls_;
+  }
+
+private:
+  bool
+  ShouldInline(const CallSite & callSite, const lambda::node & callee)
+  {
+    auto threshold = Settings_.GetThreshold() + callSite.LoopDepth * Settings_.GetLoopBonus()
+                   + NumConstantArguments(*callSite.Call) * Settings_.GetConstantArgumentBonus();
+    if (GetSize(callee) <= threshold)
+      return true;
+
+    // The callee is removed after inlining its only call, and inlining therefore does not
+    // increase the size of the module.
+    auto & callSummary = CallGraphIndex_.GetCallSummary(callee);
+    return callSummary.HasOnlyDirectCalls() && callSummary.NumDirectCalls() == 1;
+  }
+
+  size_t
+  GetSize(const lambda::node & lambda)
+  {
+    auto it = Sizes_.find(&lambda);
+    if (it != Sizes_.end())
+      return it->second;
+
+    auto size = jlm::rvsdg::nnodes(lambda.subregion());
+    Sizes_[&lambda] = size;
+    return size;
+  }
+
+  RvsdgModule & RvsdgModule_;
+  CallGraphIndex & CallGraphIndex_;
+  const InliningSettings & Settings_;
+  size_t NumInlinedCalls_;
+  std::unordered_map<const lambda::node *, size_t> Sizes_;
+  jlm::rvsdg::substitution_map SubstitutionMap_;
+};
+
+static void
+RemoveDeadNodes(const util::HashSet<jlm::rvsdg::node *> & dirtyNodes)
+{
+  std::vector<jlm::rvsdg::node *> nodes(dirtyNodes.Items().begin(), dirtyNodes.Items().end());
+  DeadNodeElimination::RemoveDeadNodes(nodes);
+}
+
+/**
+ * @return The number of inlined calls.
+ */
+static size_t
+inlining(RvsdgModule & rvsdgModule, const InliningSettings & settings)
+{
+  InliningContext context(rvsdgModule, settings);
 
-      if (callSummary->HasOnlyDirectCalls() && callSummary->NumDirectCalls() == 1)
+  for (auto node : rvsdg::topdown_traverser(rvsdgModule.Rvsdg().root()))
+  {
+    util::HashSet<jlm::rvsdg::node *> dirtyNodes;
+
+    if (auto lambdaNode = dynamic_cast<lambda::node *>(node))
+    {
+      context.InlineCalls(*lambdaNode, dirtyNodes);
+    }
+    else if (auto phiNode = dynamic_cast<phi::node *>(node))
+    {
+      // The lambda nodes of a phi node form a strongly connected component of the call graph
+      std::vector<lambda::node *> lambdaNodes;
+      for (auto & subregionNode : phiNode->subregion()->nodes)
       {
-        inlineCall(*callSummary->DirectCalls().begin(), lambda);
+        if (auto lambdaNode = dynamic_cast<lambda::node *>(&subregionNode))
+          lambdaNodes.push_back(lambdaNode);
       }
+
+      for (auto lambdaNode : lambdaNodes)
+        context.InlineCalls(*lambdaNode, dirtyNodes);
     }
+
+    // Remove the inlined callees, as well as the variables that routed them to the calls, if the
+    // calls were their only users.
+    RemoveDeadNodes(dirtyNodes);
   }
+
+  return context.NumInlinedCalls();
 }
 
 static void
-inlining(RvsdgModule & rm, util::StatisticsCollector & statisticsCollector)
+inlining(
+    RvsdgModule & rm,
+    const InliningSettings & settings,
+    util::StatisticsCollector & statisticsCollector)
 {
   auto & graph = rm.Rvsdg();
   auto statistics = ilnstat::Create();
 
   statistics->start(graph);
-  inlining(graph);
-  statistics->stop(graph);
+  auto numInlinedCalls = inlining(rm, settings);
+  statistics->stop(graph, numInlinedCalls);
 
   statisticsCollector.CollectDemandedStatistics(std::move(statistics));
 }
@@ -190,7 +447,13 @@ fctinline::~fctinline()
 void
 fctinline::run(RvsdgModule & module, util::StatisticsCollector & statisticsCollector)
 {
-  inlining(module, statisticsCollector);
+  inlining(module, Settings_, statisticsCollector);
+}
+
+bool
+fctinline::ReportsModifications() const noexcept
+{
+  return true;
 }
 
 }
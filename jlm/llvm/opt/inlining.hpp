@@ -14,16 +14,114 @@ namespace jlm::llvm
 
 class RvsdgModule;
 
+/**
+ * \brief Parameters of the function inlining cost model
+ *
+ * A direct call of a function is inlined if the call is the only use of the function, as the
+ * function is removed afterwards. Otherwise, the call is inlined if the number of nodes of the
+ * function does not exceed the threshold of the call site. The threshold of a call site is the
+ * base threshold, raised by the loop bonus for every theta node that encloses the call, and by the
+ * constant argument bonus for every argument that is produced by a nullary node.
+ *
+ * \see fctinline
+ */
+class InliningSettings final
+{
+public:
+  static constexpr size_t DefaultThreshold = 16;
+  static constexpr size_t DefaultLoopBonus = 32;
+  static constexpr size_t DefaultConstantArgumentBonus = 4;
+
+  InliningSettings()
+      : InliningSettings(DefaultThreshold, DefaultLoopBonus, DefaultConstantArgumentBonus)
+  {}
+
+  InliningSettings(size_t threshold, size_t loopBonus, size_t constantArgumentBonus)
+      : Threshold_(threshold),
+        LoopBonus_(loopBonus),
+        ConstantArgumentBonus_(constantArgumentBonus)
+  {}
+
+  [[nodiscard]] size_t
+  GetThreshold() const noexcept
+  {
+    return Threshold_;
+  }
+
+  [[nodiscard]] size_t
+  GetLoopBonus() const noexcept
+  {
+    return LoopBonus_;
+  }
+
+  [[nodiscard]] size_t
+  GetConstantArgumentBonus() const noexcept
+  {
+    return ConstantArgumentBonus_;
+  }
+
+  bool
+  operator==(const InliningSettings & other) const noexcept
+  {
+    return Threshold_ == other.Threshold_ && LoopBonus_ == other.LoopBonus_
+        && ConstantArgumentBonus_ == other.ConstantArgumentBonus_;
+  }
+
+  bool
+  operator!=(const InliningSettings & other) const noexcept
+  {
+    return !operator==(other);
+  }
+
+private:
+  size_t Threshold_;
+  size_t LoopBonus_;
+  size_t ConstantArgumentBonus_;
+};
+
 /**
  * \brief Function Inlining
+ *
+ * Function inlining processes the call graph bottom-up, i.e., the calls within a function are
+ * only considered once all functions it calls were processed. The lambda nodes of the root region
+ * are visited in topological order, which visits callees before their callers, and phi nodes form
+ * the strongly connected components of mutually recursive functions. The lambda nodes of a phi
+ * node are processed together, and their recursive calls are never inlined.
+ *
+ * The decision whether a direct call of a lambda node in the root region is inlined is taken by
+ * the cost model described in InliningSettings.
  */
 class fctinline final : public optimization
 {
 public:
   virtual ~fctinline();
 
+  fctinline() = default;
+
+  explicit fctinline(const InliningSettings & settings)
+      : Settings_(settings)
+  {}
+
+  [[nodiscard]] const InliningSettings &
+  GetSettings() const noexcept
+  {
+    return Settings_;
+  }
+
+  void
+  SetSettings(const InliningSettings & settings) noexcept
+  {
+    Settings_ = settings;
+  }
+
   virtual void
   run(RvsdgModule & module, jlm::util::StatisticsCollector & statisticsCollector) override;
+
+  [[nodiscard]] bool
+  ReportsModifications() const noexcept override;
+
+private:
+  InliningSettings Settings_;
 };
 
 jlm::rvsdg::output *
@@ -350,4 +350,16 @@ tginversion::run(RvsdgModule & module, jlm::util::StatisticsCollector & statisti
   invert(module, statisticsCollector);
 }
 
+bool
+tginversion::IsFunctionLocal() const noexcept
+{
+  return true;
+}
+
+void
+tginversion::RunOnFunction(lambda::node & lambdaNode)
+{
+  invert(lambdaNode.subregion());
+}
+
 }
@@ -23,6 +23,12 @@ public:
 
   virtual void
   run(RvsdgModule & module, jlm::util::StatisticsCollector & statisticsCollector) override;
+
+  [[nodiscard]] bool
+  IsFunctionLocal() const noexcept override;
+
+  void
+  RunOnFunction(lambda::node & lambdaNode) override;
 };
 
 }
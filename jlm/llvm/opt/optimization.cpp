@@ -4,6 +4,7 @@
  */
 
 #include <jlm/llvm/opt/optimization.hpp>
+#include <jlm/util/common.hpp>
 
 namespace jlm::llvm
 {
@@ -11,4 +12,22 @@ namespace jlm::llvm
 optimization::~optimization()
 {}
 
+bool
+optimization::IsFunctionLocal() const noexcept
+{
+  return false;
+}
+
+void
+optimization::RunOnFunction(lambda::node &)
+{
+  throw util::error("Optimization is not function-local.");
+}
+
+bool
+optimization::ReportsModifications() const noexcept
+{
+  return false;
+}
+
 }
@@ -18,6 +18,11 @@ namespace jlm::llvm
 
 class RvsdgModule;
 
+namespace lambda
+{
+class node;
+}
+
 /**
  * \brief Optimization pass interface
  */
@@ -38,6 +43,44 @@ public:
    */
   virtual void
   run(RvsdgModule & module, jlm::util::StatisticsCollector & statisticsCollector) = 0;
+
+  /**
+   * Determines whether the optimization is function-local, i.e., whether it only inspects and
+   * modifies the subregion of a single lambda node at a time. Function-local optimizations can be
+   * applied to different lambda nodes concurrently.
+   *
+   * \see RunOnFunction()
+   */
+  [[nodiscard]] virtual bool
+  IsFunctionLocal() const noexcept;
+
+  /**
+   * \brief Perform optimization on a single function
+   *
+   * Only supported by function-local optimizations. An implementation must not access any state
+   * outside the subregion of \p lambdaNode other than the origins of its inputs, and it must not
+   * mutate the optimization object itself, as the method might be invoked concurrently for
+   * different lambda nodes.
+   *
+   * \param lambdaNode The lambda node whose subregion the optimization is performed on.
+   *
+   * \see IsFunctionLocal()
+   */
+  virtual void
+  RunOnFunction(lambda::node & lambdaNode);
+
+  /**
+   * Determines whether the optimization reports its modifications to the observers of the module.
+   * Such an optimization reports every output it creates through
+   * RvsdgModule::NotifyOutputCopied(), or invalidates the affected lambda nodes. Apart from that,
+   * it only removes nodes and outputs, or replaces outputs with outputs of the same value.
+   * OptimizationSequence invalidates the analyses of the module after every optimization that
+   * does not report its modifications.
+   *
+   * \see RvsdgModuleObserver
+   */
+  [[nodiscard]] virtual bool
+  ReportsModifications() const noexcept;
 };
 
 }
@@ -333,4 +333,16 @@ pullin::run(RvsdgModule & module, util::StatisticsCollector & statisticsCollecto
   pull(module, statisticsCollector);
 }
 
+bool
+pullin::IsFunctionLocal() const noexcept
+{
+  return true;
+}
+
+void
+pullin::RunOnFunction(lambda::node & lambdaNode)
+{
+  pull(lambdaNode.subregion());
+}
+
 }
@@ -455,4 +455,16 @@ pushout::run(RvsdgModule & module, util::StatisticsCollector & statisticsCollect
   push(module, statisticsCollector);
 }
 
+bool
+pushout::IsFunctionLocal() const noexcept
+{
+  return true;
+}
+
+void
+pushout::RunOnFunction(lambda::node & lambdaNode)
+{
+  push(lambdaNode.subregion());
+}
+
 }
@@ -29,6 +29,12 @@ public:
 
   virtual void
   run(RvsdgModule & module, util::StatisticsCollector & statisticsCollector) override;
+
+  [[nodiscard]] bool
+  IsFunctionLocal() const noexcept override;
+
+  void
+  RunOnFunction(lambda::node & lambdaNode) override;
 };
 
 void
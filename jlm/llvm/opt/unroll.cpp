@@ -10,6 +10,11 @@
 #include <jlm/util/Statistics.hpp>
 #include <jlm/util/time.hpp>
 
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
 namespace jlm::llvm
 {
 
@@ -185,22 +190,45 @@ unrollinfo::create(jlm::rvsdg::theta_node * theta)
 
 /* loop unrolling */
 
+/*
+  The unrolling reports the outputs it creates to the observers of the RVSDG module, if there is a
+  module. All created outputs that can carry pointers are copies of outputs of the original theta
+  node or its subregion.
+*/
+static void
+notify_copied(
+    RvsdgModule * rvsdgModule,
+    const jlm::rvsdg::output * original,
+    const jlm::rvsdg::output * copy)
+{
+  if (rvsdgModule)
+    rvsdgModule->NotifyOutputCopied(*original, *copy);
+}
+
 static void
 unroll_body(
+    RvsdgModule * rvsdgModule,
     const jlm::rvsdg::theta_node * theta,
     jlm::rvsdg::region * target,
     jlm::rvsdg::substitution_map & smap,
     size_t factor)
 {
+  // The maps of consecutive copies are swapped and cleared, such that their tables are reused
+  jlm::rvsdg::substitution_map tmap;
   for (size_t n = 0; n < factor - 1; n++)
   {
     theta->subregion()->copy(target, smap, false, false);
-    jlm::rvsdg::substitution_map tmap;
+    if (rvsdgModule)
+      rvsdgModule->NotifyRegionCopied(*theta->subregion(), smap);
+
+    tmap.clear();
     for (const auto & olv : *theta)
       tmap.insert(olv->argument(), smap.lookup(olv->result()->origin()));
-    smap = tmap;
+    std::swap(smap, tmap);
   }
   theta->subregion()->copy(target, smap, false, false);
+  if (rvsdgModule)
+    rvsdgModule->NotifyRegionCopied(*theta->subregion(), smap);
 }
 
 /*
@@ -209,13 +237,13 @@ unroll_body(
   The theta itself is not deleted.
 */
 static void
-copy_body_and_unroll(const jlm::rvsdg::theta_node * theta, size_t factor)
+copy_body_and_unroll(RvsdgModule * rvsdgModule, const jlm::rvsdg::theta_node * theta, size_t factor)
 {
   jlm::rvsdg::substitution_map smap;
   for (const auto & olv : *theta)
     smap.insert(olv->argument(), olv->input()->origin());
 
-  unroll_body(theta, theta->region(), smap, factor);
+  unroll_body(rvsdgModule, theta, theta->region(), smap, factor);
 
   for (const auto & olv : *theta)
     olv->divert_users(smap.lookup(olv->result()->origin()));
@@ -225,7 +253,11 @@ copy_body_and_unroll(const jlm::rvsdg::theta_node * theta, size_t factor)
   Unroll theta node by given factor.
 */
 static void
-unroll_theta(const unrollinfo & ui, jlm::rvsdg::substitution_map & smap, size_t factor)
+unroll_theta(
+    RvsdgModule * rvsdgModule,
+    const unrollinfo & ui,
+    jlm::rvsdg::substitution_map & smap,
+    size_t factor)
 {
   auto theta = ui.theta();
   auto remainder = ui.remainder(factor);
@@ -235,9 +267,11 @@ unroll_theta(const unrollinfo & ui, jlm::rvsdg::substitution_map & smap, size_t
   {
     auto nlv = unrolled_theta->add_loopvar(olv->input()->origin());
     smap.insert(olv->argument(), nlv->argument());
+    notify_copied(rvsdgModule, olv->argument(), nlv->argument());
+    notify_copied(rvsdgModule, olv, nlv);
   }
 
-  unroll_body(theta, unrolled_theta->subregion(), smap, factor);
+  unroll_body(rvsdgModule, theta, unrolled_theta->subregion(), smap, factor);
   unrolled_theta->set_predicate(smap.lookup(theta->predicate()->origin()));
 
   for (auto olv = theta->begin(), nlv = unrolled_theta->begin(); olv != theta->end(); olv++, nlv++)
@@ -271,7 +305,11 @@ unroll_theta(const unrollinfo & ui, jlm::rvsdg::substitution_map & smap, size_t
   Adde the reminder for the lopp if any
 */
 static void
-add_remainder(const unrollinfo & ui, jlm::rvsdg::substitution_map & smap, size_t factor)
+add_remainder(
+    RvsdgModule * rvsdgModule,
+    const unrollinfo & ui,
+    jlm::rvsdg::substitution_map & smap,
+    size_t factor)
 {
   auto theta = ui.theta();
   auto remainder = ui.remainder(factor);
@@ -301,13 +339,13 @@ add_remainder(const unrollinfo & ui, jlm::rvsdg::substitution_map & smap, size_t
       There is only one loop iteration remaining.
       Simply copy the body of the theta to replace it.
     */
-    copy_body_and_unroll(theta, 1);
+    copy_body_and_unroll(rvsdgModule, theta, 1);
     remove(theta);
   }
 }
 
 static void
-unroll_known_theta(const unrollinfo & ui, size_t factor)
+unroll_known_theta(RvsdgModule * rvsdgModule, const unrollinfo & ui, size_t factor)
 {
   JLM_ASSERT(ui.is_known() && ui.niterations());
   auto niterations = ui.niterations();
@@ -321,7 +359,7 @@ unroll_known_theta(const unrollinfo & ui, size_t factor)
       Completely unroll the loop body and then remove the theta node,
       as the number of iterations is smaller than the unroll factor.
     */
-    copy_body_and_unroll(original_theta, niterations->to_uint());
+    copy_body_and_unroll(rvsdgModule, original_theta, niterations->to_uint());
     return remove(original_theta);
   }
 
@@ -331,12 +369,12 @@ unroll_known_theta(const unrollinfo & ui, size_t factor)
     Unroll the theta
   */
   jlm::rvsdg::substitution_map smap;
-  unroll_theta(ui, smap, factor);
+  unroll_theta(rvsdgModule, ui, smap, factor);
 
   /*
     Add code for any potential iterations that remains
   */
-  add_remainder(ui, smap, factor);
+  add_remainder(rvsdgModule, ui, smap, factor);
 }
 
 static jlm::rvsdg::output *
@@ -403,7 +441,7 @@ create_residual_gamma_predicate(const jlm::rvsdg::substitution_map & smap, const
 }
 
 static void
-unroll_unknown_theta(const unrollinfo & ui, size_t factor)
+unroll_unknown_theta(RvsdgModule * rvsdgModule, const unrollinfo & ui, size_t factor)
 {
   auto otheta = ui.theta();
 
@@ -421,9 +459,13 @@ unroll_unknown_theta(const unrollinfo & ui, size_t factor)
       auto nlv = ntheta->add_loopvar(ev->argument(1));
       rmap[0].insert(olv, ev->argument(0));
       rmap[1].insert(olv->argument(), nlv->argument());
+      notify_copied(rvsdgModule, olv->input()->origin(), ev->argument(0));
+      notify_copied(rvsdgModule, olv->input()->origin(), ev->argument(1));
+      notify_copied(rvsdgModule, olv->argument(), nlv->argument());
+      notify_copied(rvsdgModule, olv, nlv);
     }
 
-    unroll_body(otheta, ntheta->subregion(), rmap[1], factor);
+    unroll_body(rvsdgModule, otheta, ntheta->subregion(), rmap[1], factor);
     pred = create_unrolled_theta_predicate(ntheta->subregion(), rmap[1], ui, factor);
     ntheta->set_predicate(pred);
 
@@ -438,6 +480,8 @@ unroll_unknown_theta(const unrollinfo & ui, size_t factor)
     {
       auto xv = ngamma->add_exitvar({ rmap[0].lookup(olv), rmap[1].lookup(olv) });
       smap.insert(olv, xv);
+      notify_copied(rvsdgModule, olv->input()->origin(), xv);
+      notify_copied(rvsdgModule, olv, xv);
     }
   }
 
@@ -454,9 +498,18 @@ unroll_unknown_theta(const unrollinfo & ui, size_t factor)
       auto nlv = ntheta->add_loopvar(ev->argument(1));
       rmap[0].insert(olv, ev->argument(0));
       rmap[1].insert(olv->argument(), nlv->argument());
+      for (size_t n = 0; n < 2; n++)
+      {
+        notify_copied(rvsdgModule, olv->input()->origin(), ev->argument(n));
+        notify_copied(rvsdgModule, olv, ev->argument(n));
+      }
+      notify_copied(rvsdgModule, olv->argument(), nlv->argument());
+      notify_copied(rvsdgModule, olv, nlv);
     }
 
     otheta->subregion()->copy(ntheta->subregion(), rmap[1], false, false);
+    if (rvsdgModule)
+      rvsdgModule->NotifyRegionCopied(*otheta->subregion(), rmap[1]);
     ntheta->set_predicate(rmap[1].lookup(otheta->predicate()->origin()));
 
     for (auto olv = otheta->begin(), nlv = ntheta->begin(); olv != otheta->end(); olv++, nlv++)
@@ -465,6 +518,8 @@ unroll_unknown_theta(const unrollinfo & ui, size_t factor)
       (*nlv)->result()->divert_to(origin);
       auto xv = ngamma->add_exitvar({ rmap[0].lookup(*olv), *nlv });
       smap.insert(*olv, xv);
+      notify_copied(rvsdgModule, (*olv)->input()->origin(), xv);
+      notify_copied(rvsdgModule, *olv, xv);
     }
   }
   for (const auto & olv : *otheta)
@@ -472,6 +527,20 @@ unroll_unknown_theta(const unrollinfo & ui, size_t factor)
   remove(otheta);
 }
 
+static void
+unroll(RvsdgModule * rvsdgModule, const unrollinfo & ui, size_t factor)
+{
+  auto nf = ui.theta()->graph()->node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  if (ui.is_known() && ui.niterations())
+    unroll_known_theta(rvsdgModule, ui, factor);
+  else
+    unroll_unknown_theta(rvsdgModule, ui, factor);
+
+  nf->set_mutable(true);
+}
+
 void
 unroll(jlm::rvsdg::theta_node * otheta, size_t factor)
 {
@@ -482,40 +551,216 @@ unroll(jlm::rvsdg::theta_node * otheta, size_t factor)
   if (!ui)
     return;
 
-  auto nf = otheta->graph()->node_normal_form(typeid(jlm::rvsdg::operation));
-  nf->set_mutable(false);
+  unroll(nullptr, *ui, factor);
+}
 
-  if (ui->is_known() && ui->niterations())
-    unroll_known_theta(*ui, factor);
-  else
-    unroll_unknown_theta(*ui, factor);
+/*
+  An innermost loop and its iteration count in the profile, if the profile contains the loop.
+*/
+struct LoopCandidate
+{
+  jlm::rvsdg::theta_node * Theta;
+  bool HasProfile;
+  size_t NumProfiledIterations;
+};
 
-  nf->set_mutable(true);
+/*
+  Collects the innermost loops of a region and its subregions in pre-order. The loops of a lambda
+  node are numbered in the same order, and looked up in the profile with the name of the lambda.
+  Returns true if the region contains a loop.
+*/
+static bool
+collect_innermost_loops(
+    jlm::rvsdg::region * region,
+    const UnrollProfile & profile,
+    const std::string * functionName,
+    size_t & loopIndex,
+    std::vector<LoopCandidate> & loops)
+{
+  // Order the structural nodes top-down, and nodes of the same depth in the order of creation
+  std::vector<jlm::rvsdg::structural_node *> structnodes;
+  for (auto & node : region->nodes)
+  {
+    if (auto structnode = dynamic_cast<jlm::rvsdg::structural_node *>(&node))
+      structnodes.push_back(structnode);
+  }
+  std::stable_sort(
+      structnodes.begin(),
+      structnodes.end(),
+      [](const jlm::rvsdg::node * node1, const jlm::rvsdg::node * node2)
+      {
+        return node1->depth() < node2->depth();
+      });
+
+  bool containsLoop = false;
+  for (auto structnode : structnodes)
+  {
+    if (auto lambdaNode = dynamic_cast<const lambda::node *>(structnode))
+    {
+      size_t lambdaLoopIndex = 0;
+      containsLoop |= collect_innermost_loops(
+          lambdaNode->subregion(),
+          profile,
+          &lambdaNode->name(),
+          lambdaLoopIndex,
+          loops);
+      continue;
+    }
+
+    LoopCandidate candidate = { dynamic_cast<jlm::rvsdg::theta_node *>(structnode), false, 0 };
+    if (candidate.Theta && functionName)
+    {
+      candidate.HasProfile =
+          profile.GetIterationCount(*functionName, loopIndex, candidate.NumProfiledIterations);
+    }
+    if (candidate.Theta)
+      loopIndex++;
+
+    bool containsInnerLoop = false;
+    for (size_t n = 0; n < structnode->nsubregions(); n++)
+    {
+      containsInnerLoop |= collect_innermost_loops(
+          structnode->subregion(n),
+          profile,
+          functionName,
+          loopIndex,
+          loops);
+    }
+
+    if (candidate.Theta && !containsInnerLoop)
+      loops.push_back(candidate);
+
+    containsLoop |= candidate.Theta || containsInnerLoop;
+  }
+
+  return containsLoop;
+}
+
+/*
+  Returns the factor by which a loop is unrolled, or zero if the loop is not unrolled. A factor
+  that equals the number of iterations of a loop unrolls the loop completely.
+*/
+static size_t
+compute_unroll_factor(
+    const unrollinfo & ui,
+    const LoopCandidate & loop,
+    const UnrollSettings & settings)
+{
+  auto bodySize = std::max<size_t>(1, jlm::rvsdg::nnodes(ui.theta()->subregion()));
+  auto maxFactor = settings.GetMaxUnrolledSize() / bodySize;
+
+  if (ui.is_known() && ui.niterations())
+  {
+    auto niterations = ui.niterations()->to_uint();
+    if (niterations == 0)
+      return 0;
+
+    if (niterations <= settings.GetFullUnrollThreshold() && niterations <= maxFactor)
+      return niterations;
+  }
+  else if (loop.HasProfile)
+  {
+    maxFactor = std::min(maxFactor, loop.NumProfiledIterations);
+  }
+
+  auto factor = std::min(settings.GetFactor(), maxFactor);
+  return factor < 2 ? 0 : factor;
+}
+
+/* UnrollProfile class */
+
+bool
+UnrollProfile::GetIterationCount(
+    const std::string & functionName,
+    size_t loopIndex,
+    size_t & numIterations) const
+{
+  auto function = IterationCounts_.find(functionName);
+  if (function == IterationCounts_.end())
+    return false;
+
+  auto loop = function->second.find(loopIndex);
+  if (loop == function->second.end())
+    return false;
+
+  numIterations = loop->second;
+  return true;
+}
+
+void
+UnrollProfile::SetIterationCount(
+    const std::string & functionName,
+    size_t loopIndex,
+    size_t numIterations)
+{
+  IterationCounts_[functionName][loopIndex] = numIterations;
+}
+
+size_t
+UnrollProfile::NumLoops() const noexcept
+{
+  size_t numLoops = 0;
+  for (auto & function : IterationCounts_)
+    numLoops += function.second.size();
+
+  return numLoops;
 }
 
 static bool
-unroll(jlm::rvsdg::region * region, size_t factor)
+parse_count(const std::string & token, size_t & count)
 {
-  bool unrolled = false;
-  for (auto & node : jlm::rvsdg::topdown_traverser(region))
+  if (token.empty() || token.find_first_not_of("0123456789") != std::string::npos)
+    return false;
+
+  // Accumulate the digits manually, such that counts that do not fit size_t are rejected as
+  // malformed instead of throwing std::out_of_range.
+  count = 0;
+  for (auto digit : token)
   {
-    if (auto structnode = dynamic_cast<jlm::rvsdg::structural_node *>(node))
-    {
-      for (size_t n = 0; n < structnode->nsubregions(); n++)
-        unrolled = unroll(structnode->subregion(n), factor);
+    size_t value = digit - '0';
+    if (count > (std::numeric_limits<size_t>::max() - value) / 10)
+      return false;
 
-      /* Try to unroll if an inner loop hasn't already been found */
-      if (!unrolled)
-      {
-        if (auto theta = dynamic_cast<jlm::rvsdg::theta_node *>(node))
-        {
-          unroll(theta, factor);
-          unrolled = true;
-        }
-      }
+    count = count * 10 + value;
+  }
+
+  return true;
+}
+
+UnrollProfile
+UnrollProfile::Parse(std::istream & stream)
+{
+  UnrollProfile profile;
+
+  std::string line;
+  for (size_t lineNumber = 1; std::getline(stream, line); lineNumber++)
+  {
+    std::istringstream lineStream(line);
+    std::string functionName, loopIndex, numIterations, trailing;
+    if (!(lineStream >> functionName) || functionName[0] == '#')
+      continue;
+
+    size_t index, count;
+    if (!(lineStream >> loopIndex >> numIterations) || (lineStream >> trailing)
+        || !parse_count(loopIndex, index) || !parse_count(numIterations, count))
+    {
+      throw util::error(util::strfmt("Malformed unroll profile in line ", lineNumber, ": ", line));
     }
+
+    profile.SetIterationCount(functionName, index, count);
   }
-  return unrolled;
+
+  return profile;
+}
+
+UnrollProfile
+UnrollProfile::Read(const util::filepath & file)
+{
+  std::ifstream stream(file.to_str());
+  if (!stream)
+    throw util::error("Cannot open unroll profile " + file.to_str());
+
+  return Parse(stream);
 }
 
 /* loopunroll class */
@@ -526,17 +771,52 @@ loopunroll::~loopunroll()
 void
 loopunroll::run(RvsdgModule & module, util::StatisticsCollector & statisticsCollector)
 {
-  if (factor_ < 2)
-    return;
+  auto & profileFile = Settings_.GetProfileFile();
+  if (profileFile == "")
+    run(module, UnrollProfile(), statisticsCollector);
+  else
+    run(module, UnrollProfile::Read(profileFile), statisticsCollector);
+}
 
+void
+loopunroll::run(
+    RvsdgModule & module,
+    const UnrollProfile & profile,
+    util::StatisticsCollector & statisticsCollector)
+{
   auto & graph = module.Rvsdg();
   auto statistics = unrollstat::Create();
 
   statistics->start(module.Rvsdg());
-  unroll(graph.root(), factor_);
+
+  /*
+    All loops are collected before any of them is unrolled, as unrolling a loop creates new loops
+    that would affect the numbering of the loops of the profile. Unrolling an innermost loop only
+    modifies the region of the loop, and leaves all other collected loops intact.
+  */
+  size_t loopIndex = 0;
+  std::vector<LoopCandidate> loops;
+  collect_innermost_loops(graph.root(), profile, nullptr, loopIndex, loops);
+
+  for (auto & loop : loops)
+  {
+    auto ui = unrollinfo::create(loop.Theta);
+    if (!ui)
+      continue;
+
+    if (auto factor = compute_unroll_factor(*ui, loop, Settings_))
+      unroll(&module, *ui, factor);
+  }
+
   statistics->end(module.Rvsdg());
 
   statisticsCollector.CollectDemandedStatistics(std::move(statistics));
 }
 
+bool
+loopunroll::ReportsModifications() const noexcept
+{
+  return true;
+}
+
 }
@@ -10,24 +10,187 @@
 #include <jlm/rvsdg/bitstring.hpp>
 #include <jlm/rvsdg/theta.hpp>
 #include <jlm/util/common.hpp>
+#include <jlm/util/file.hpp>
+
+#include <istream>
+#include <limits>
+#include <string>
+#include <unordered_map>
 
 namespace jlm::llvm
 {
 
 class RvsdgModule;
 
+/**
+ * \brief Parameters of the per-loop unroll decisions
+ *
+ * A loop with a known number of iterations is completely unrolled if the number of iterations
+ * does not exceed the full unroll threshold, and the unrolled body does not exceed the maximal
+ * unrolled size. All other loops are unrolled by the unroll factor, which is reduced such that the
+ * unrolled body does not exceed the maximal unrolled size. The factor of a loop with an unknown
+ * number of iterations is further bounded by the iteration count of the loop in the profile, if
+ * the profile file provides one.
+ *
+ * The defaults reproduce the unrolling without settings: loops with at most as many iterations as
+ * the unroll factor are unrolled completely, and the size of the unrolled body is not limited.
+ *
+ * \see loopunroll, UnrollProfile
+ */
+class UnrollSettings final
+{
+public:
+  static constexpr size_t DefaultFactor = 4;
+  static constexpr size_t DefaultFullUnrollThreshold = DefaultFactor;
+  static constexpr size_t DefaultMaxUnrolledSize = std::numeric_limits<size_t>::max();
+
+  UnrollSettings()
+      : UnrollSettings(DefaultFactor, DefaultFullUnrollThreshold, DefaultMaxUnrolledSize)
+  {}
+
+  UnrollSettings(
+      size_t factor,
+      size_t fullUnrollThreshold,
+      size_t maxUnrolledSize,
+      util::filepath profileFile = util::filepath(""))
+      : Factor_(factor),
+        FullUnrollThreshold_(fullUnrollThreshold),
+        MaxUnrolledSize_(maxUnrolledSize),
+        ProfileFile_(std::move(profileFile))
+  {}
+
+  [[nodiscard]] size_t
+  GetFactor() const noexcept
+  {
+    return Factor_;
+  }
+
+  [[nodiscard]] size_t
+  GetFullUnrollThreshold() const noexcept
+  {
+    return FullUnrollThreshold_;
+  }
+
+  [[nodiscard]] size_t
+  GetMaxUnrolledSize() const noexcept
+  {
+    return MaxUnrolledSize_;
+  }
+
+  /**
+   * @return The path of the profile file. The path is empty if no profile is used.
+   */
+  [[nodiscard]] const util::filepath &
+  GetProfileFile() const noexcept
+  {
+    return ProfileFile_;
+  }
+
+  bool
+  operator==(const UnrollSettings & other) const noexcept
+  {
+    return Factor_ == other.Factor_ && FullUnrollThreshold_ == other.FullUnrollThreshold_
+        && MaxUnrolledSize_ == other.MaxUnrolledSize_ && ProfileFile_ == other.ProfileFile_;
+  }
+
+  bool
+  operator!=(const UnrollSettings & other) const noexcept
+  {
+    return !operator==(other);
+  }
+
+private:
+  size_t Factor_;
+  size_t FullUnrollThreshold_;
+  size_t MaxUnrolledSize_;
+  util::filepath ProfileFile_;
+};
+
+/**
+ * \brief Iteration counts of loops
+ *
+ * A loop is identified by the name of the function that contains it and by its index, which
+ * numbers the theta nodes of a function in pre-order, i.e., an outer loop precedes the loops
+ * nested in it. The loops of a region are numbered in topological order, and loops of the same
+ * depth in the order of their creation.
+ *
+ * The textual format of a profile has one loop per line, consisting of the function name, the
+ * loop index, and the average number of iterations of the loop, separated by whitespace. Empty
+ * lines and lines starting with '#' are ignored.
+ */
+class UnrollProfile final
+{
+public:
+  /**
+   * Returns the iteration count of loop \p loopIndex in function \p functionName.
+   *
+   * @param functionName The name of the function.
+   * @param loopIndex The index of the loop within the function.
+   * @param numIterations Set to the iteration count of the loop, if the profile contains it.
+   *
+   * @return True if the profile contains the loop, otherwise false.
+   */
+  bool
+  GetIterationCount(const std::string & functionName, size_t loopIndex, size_t & numIterations)
+      const;
+
+  void
+  SetIterationCount(const std::string & functionName, size_t loopIndex, size_t numIterations);
+
+  [[nodiscard]] size_t
+  NumLoops() const noexcept;
+
+  /**
+   * Parses a profile in textual format from \p stream.
+   *
+   * @throws util::error if a line of the profile is malformed.
+   */
+  static UnrollProfile
+  Parse(std::istream & stream);
+
+  /**
+   * Reads a profile in textual format from \p file.
+   *
+   * @throws util::error if the file cannot be read or is malformed.
+   */
+  static UnrollProfile
+  Read(const util::filepath & file);
+
+private:
+  std::unordered_map<std::string, std::unordered_map<size_t, size_t>> IterationCounts_;
+};
+
 /**
  * \brief Optimization that attempts to unroll loops (thetas).
+ *
+ * All innermost loops of the module are unrolled, and the decision how to unroll a loop is taken
+ * for every loop individually, as described in UnrollSettings.
  */
 class loopunroll final : public optimization
 {
 public:
   virtual ~loopunroll();
 
-  constexpr loopunroll(size_t factor)
-      : factor_(factor)
+  explicit loopunroll(size_t factor)
+      : Settings_(factor, factor, UnrollSettings::DefaultMaxUnrolledSize)
   {}
 
+  explicit loopunroll(UnrollSettings settings)
+      : Settings_(std::move(settings))
+  {}
+
+  [[nodiscard]] const UnrollSettings &
+  GetSettings() const noexcept
+  {
+    return Settings_;
+  }
+
+  void
+  SetSettings(const UnrollSettings & settings)
+  {
+    Settings_ = settings;
+  }
+
   /**
    * Given a module all inner most loops (thetas) are found and unrolled if possible.
    * All nodes in the module are traversed and if a theta is found and is the inner most theta
@@ -35,12 +198,27 @@ public:
    *
    * \param module Module where the innermost loops are unrolled
    * \param statisticsCollector Statistics collector for collecting loop unrolling statistics.
+   *
+   * \throws util::error if the profile file of the settings cannot be read.
    */
   virtual void
   run(RvsdgModule & module, util::StatisticsCollector & statisticsCollector) override;
 
+  /**
+   * Unrolls the innermost loops of \p module according to \p profile. The profile file of the
+   * settings is ignored.
+   */
+  void
+  run(
+      RvsdgModule & module,
+      const UnrollProfile & profile,
+      util::StatisticsCollector & statisticsCollector);
+
+  [[nodiscard]] bool
+  ReportsModifications() const noexcept override;
+
 private:
-  size_t factor_;
+  UnrollSettings Settings_;
 };
 
 class unrollinfo final
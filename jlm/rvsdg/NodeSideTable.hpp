@@ -0,0 +1,231 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_RVSDG_NODESIDETABLE_HPP
+#define JLM_RVSDG_NODESIDETABLE_HPP
+
+#include <jlm/rvsdg/node.hpp>
+#include <jlm/util/common.hpp>
+
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace jlm::rvsdg
+{
+
+/**
+ * Associates values with the nodes of a graph. The values of nodes with nearby identifiers are
+ * stored in a vector that is indexed by the nodes' identifiers, which avoids the hashing and
+ * per-entry allocations of pointer-keyed maps. The vector only covers a range of identifiers that
+ * is proportional to the number of entries, such that a table for the few nodes of a region in a
+ * large graph does not allocate storage for all identifiers of the graph. Values of nodes with
+ * identifiers outside of this range are kept in a hash map.
+ *
+ * Node identifiers are recycled when nodes are destroyed. The entry of a destroyed node must
+ * therefore be removed before new nodes are created, as the entry would otherwise be associated
+ * with a new node that reuses the identifier.
+ *
+ * References to values are invalidated by the insertion of new entries.
+ *
+ * @tparam T The type of the associated values.
+ *
+ * \see node::GetId()
+ * \see graph::NumNodeIds()
+ */
+template<typename T>
+class NodeSideTable final
+{
+  /**
+   * The dense range of identifiers covers at most this many identifiers per entry of the table.
+   */
+  static constexpr size_t DenseRangeFactor_ = 4;
+
+  /**
+   * The dense range of identifiers can always cover at least this many identifiers.
+   */
+  static constexpr size_t MinDenseRangeSize_ = 64;
+
+public:
+  NodeSideTable()
+      : size_(0),
+        denseBase_(0)
+  {}
+
+  [[nodiscard]] bool
+  Contains(const jlm::rvsdg::node & node) const noexcept
+  {
+    return Find(node.GetId()) != nullptr;
+  }
+
+  /**
+   * @return The value associated with \p node. The node must be in the table.
+   */
+  [[nodiscard]] T &
+  Lookup(const jlm::rvsdg::node & node)
+  {
+    JLM_ASSERT(Contains(node));
+    return *Find(node.GetId());
+  }
+
+  [[nodiscard]] const T &
+  Lookup(const jlm::rvsdg::node & node) const
+  {
+    JLM_ASSERT(Contains(node));
+    return *Find(node.GetId());
+  }
+
+  /**
+   * Returns the value associated with \p node. A default constructed value is inserted if the
+   * node is not in the table.
+   */
+  T &
+  operator[](const jlm::rvsdg::node & node)
+  {
+    auto id = node.GetId();
+    if (auto value = Find(id))
+      return *value;
+
+    size_++;
+    if (IsInDenseRange(id) || ExtendDenseRange(id))
+      return denseValues_[id - denseBase_].emplace();
+
+    return sparseValues_[id];
+  }
+
+  /**
+   * Associates \p value with \p node, replacing any previously associated value.
+   *
+   * @return True if the node was not in the table before, otherwise false.
+   */
+  bool
+  Insert(const jlm::rvsdg::node & node, T value)
+  {
+    auto inserted = !Contains(node);
+    (*this)[node] = std::move(value);
+    return inserted;
+  }
+
+  /**
+   * Removes the entry of \p node from the table.
+   *
+   * @return True if the node was in the table, otherwise false.
+   */
+  bool
+  Remove(const jlm::rvsdg::node & node)
+  {
+    auto id = node.GetId();
+    if (IsInDenseRange(id))
+    {
+      auto & value = denseValues_[id - denseBase_];
+      if (!value.has_value())
+        return false;
+
+      value.reset();
+      size_--;
+      return true;
+    }
+
+    if (sparseValues_.erase(id) == 0)
+      return false;
+
+    size_--;
+    return true;
+  }
+
+  void
+  Clear() noexcept
+  {
+    denseValues_.clear();
+    sparseValues_.clear();
+    denseBase_ = 0;
+    size_ = 0;
+  }
+
+  /**
+   * @return The number of nodes in the table.
+   */
+  [[nodiscard]] size_t
+  Size() const noexcept
+  {
+    return size_;
+  }
+
+private:
+  [[nodiscard]] bool
+  IsInDenseRange(size_t id) const noexcept
+  {
+    return id >= denseBase_ && id - denseBase_ < denseValues_.size();
+  }
+
+  [[nodiscard]] T *
+  Find(size_t id)
+  {
+    return const_cast<T *>(std::as_const(*this).Find(id));
+  }
+
+  [[nodiscard]] const T *
+  Find(size_t id) const
+  {
+    if (IsInDenseRange(id))
+    {
+      auto & value = denseValues_[id - denseBase_];
+      return value.has_value() ? &*value : nullptr;
+    }
+
+    auto it = sparseValues_.find(id);
+    return it != sparseValues_.end() ? &it->second : nullptr;
+  }
+
+  /**
+   * Extends the dense range of identifiers such that it covers \p id, unless the range would
+   * become disproportionately large for the number of entries. The range at least doubles in
+   * size, and the values of the sparse entries that fall into the new range are moved into it.
+   *
+   * @return True if the dense range covers \p id afterwards, otherwise false.
+   */
+  bool
+  ExtendDenseRange(size_t id)
+  {
+    auto first = denseValues_.empty() ? id : std::min(denseBase_, id);
+    auto last = denseValues_.empty() ? id + 1 : std::max(denseBase_ + denseValues_.size(), id + 1);
+    if (last - first > std::max(MinDenseRangeSize_, DenseRangeFactor_ * size_))
+      return false;
+
+    auto rangeSize = std::max(last - first, 2 * denseValues_.size());
+    auto base = id < denseBase_ ? (last > rangeSize ? last - rangeSize : 0) : first;
+
+    std::vector<std::optional<T>> values(std::max(last, base + rangeSize) - base);
+    for (size_t n = 0; n < denseValues_.size(); n++)
+      values[denseBase_ + n - base] = std::move(denseValues_[n]);
+
+    for (auto it = sparseValues_.begin(); it != sparseValues_.end();)
+    {
+      if (it->first >= base && it->first - base < values.size())
+      {
+        values[it->first - base] = std::move(it->second);
+        it = sparseValues_.erase(it);
+      }
+      else
+      {
+        it++;
+      }
+    }
+
+    denseValues_ = std::move(values);
+    denseBase_ = base;
+    return true;
+  }
+
+  size_t size_;
+  size_t denseBase_;
+  std::vector<std::optional<T>> denseValues_;
+  std::unordered_map<size_t, T> sparseValues_;
+};
+
+}
+
+#endif
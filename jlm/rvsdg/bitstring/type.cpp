@@ -34,6 +34,12 @@ bittype::copy() const
   return std::unique_ptr<jlm::rvsdg::type>(new bittype(*this));
 }
 
+size_t
+bittype::hash() const noexcept
+{
+  return typeid(bittype).hash_code() ^ std::hash<size_t>()(nbits_);
+}
+
 const bittype bit1(1);
 const bittype bit8(8);
 const bittype bit16(16);
@@ -42,6 +42,9 @@ public:
   virtual std::unique_ptr<jlm::rvsdg::type>
   copy() const override;
 
+  [[nodiscard]] size_t
+  hash() const noexcept override;
+
 private:
   size_t nbits_;
 };
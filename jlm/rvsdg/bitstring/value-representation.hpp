@@ -12,6 +12,7 @@
 #include <cstdint>
 #include <cstring>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace jlm::rvsdg
@@ -372,6 +373,12 @@ public:
     return std::string(data_.begin(), data_.end());
   }
 
+  [[nodiscard]] size_t
+  hash() const noexcept
+  {
+    return std::hash<std::string_view>()(std::string_view(data_.data(), data_.size()));
+  }
+
   uint64_t
   to_uint() const;
 
@@ -47,6 +47,12 @@ ctltype::copy() const
   return std::unique_ptr<jlm::rvsdg::type>(new ctltype(*this));
 }
 
+size_t
+ctltype::hash() const noexcept
+{
+  return typeid(ctltype).hash_code() ^ std::hash<size_t>()(nalternatives_);
+}
+
 const ctltype ctl2(2);
 
 /* control value representation */
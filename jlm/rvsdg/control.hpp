@@ -38,6 +38,9 @@ public:
   virtual std::unique_ptr<jlm::rvsdg::type>
   copy() const override;
 
+  [[nodiscard]] size_t
+  hash() const noexcept override;
+
   inline size_t
   nalternatives() const noexcept
   {
@@ -85,6 +88,12 @@ public:
     return nalternatives_;
   }
 
+  [[nodiscard]] size_t
+  hash() const noexcept
+  {
+    return std::hash<size_t>()(alternative_) ^ (std::hash<size_t>()(nalternatives_) << 1);
+  }
+
 private:
   size_t alternative_;
   size_t nalternatives_;
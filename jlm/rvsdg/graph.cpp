@@ -59,6 +59,7 @@ graph::~graph()
 
 graph::graph()
     : normalized_(false),
+      nextNodeId_(0),
       root_(new jlm::rvsdg::region(nullptr, this))
 {}
 
@@ -71,9 +72,30 @@ graph::copy() const
   return graph;
 }
 
+size_t
+graph::AllocateNodeId()
+{
+  std::lock_guard<std::recursive_mutex> guard(mutex_);
+  if (freeNodeIds_.empty())
+    return nextNodeId_++;
+
+  auto id = freeNodeIds_.back();
+  freeNodeIds_.pop_back();
+  return id;
+}
+
+void
+graph::ReleaseNodeId(size_t id)
+{
+  std::lock_guard<std::recursive_mutex> guard(mutex_);
+  JLM_ASSERT(id < nextNodeId_);
+  freeNodeIds_.push_back(id);
+}
+
 jlm::rvsdg::node_normal_form *
 graph::node_normal_form(const std::type_info & type) noexcept
 {
+  std::lock_guard<std::recursive_mutex> guard(mutex_);
   auto i = node_normal_forms_.find(std::type_index(type));
   if (i != node_normal_forms_.end())
     return i.ptr();
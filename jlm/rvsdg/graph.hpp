@@ -10,6 +10,8 @@
 #include <stdbool.h>
 #include <stdlib.h>
 
+#include <atomic>
+#include <mutex>
 #include <typeindex>
 
 #include <jlm/rvsdg/node-normal-form.hpp>
@@ -17,6 +19,7 @@
 #include <jlm/rvsdg/region.hpp>
 #include <jlm/rvsdg/tracker.hpp>
 
+#include <jlm/util/Arena.hpp>
 #include <jlm/util/common.hpp>
 
 namespace jlm::rvsdg
@@ -114,6 +117,8 @@ private:
 
 class graph
 {
+  friend jlm::rvsdg::node;
+
 public:
   ~graph();
 
@@ -162,6 +167,34 @@ public:
     root()->prune(true);
   }
 
+  /**
+   * Returns the arena in which the simple nodes, their inputs and outputs, as well as the region
+   * arguments and results of the graph are allocated. Memory of removed objects is recycled for
+   * subsequently created ones, and the arena is released in bulk with the graph.
+   *
+   * @return The arena of the graph.
+   */
+  [[nodiscard]] jlm::util::Arena &
+  GetArena() noexcept
+  {
+    return arena_;
+  }
+
+  /**
+   * The identifiers of the nodes of the graph are dense, i.e., they are all smaller than the value
+   * returned by this method. They can therefore be used to index vectors of per-node data.
+   *
+   * @return An upper bound for the identifiers of the nodes in the graph.
+   *
+   * \see node::GetId()
+   * \see NodeSideTable
+   */
+  [[nodiscard]] size_t
+  NumNodeIds() const noexcept
+  {
+    return nextNodeId_;
+  }
+
   /**
    * Extracts all tail nodes of the RVSDG root region.
    *
@@ -175,7 +208,18 @@ public:
   ExtractTailNodes(const graph & rvsdg);
 
 private:
-  bool normalized_;
+  size_t
+  AllocateNodeId();
+
+  void
+  ReleaseNodeId(size_t id);
+
+  std::atomic<bool> normalized_;
+  /* protects the node identifiers and the normal forms, which are shared by all regions */
+  std::recursive_mutex mutex_;
+  size_t nextNodeId_;
+  std::vector<size_t> freeNodeIds_;
+  jlm::util::Arena arena_;
   jlm::rvsdg::region * root_;
   jlm::rvsdg::node_normal_form_hash node_normal_forms_;
 };
@@ -11,6 +11,9 @@
 #include <jlm/rvsdg/substitution.hpp>
 #include <jlm/rvsdg/theta.hpp>
 
+#include <queue>
+#include <unordered_set>
+
 namespace jlm::rvsdg
 {
 
@@ -57,16 +60,23 @@ input::divert_to(jlm::rvsdg::output * new_origin)
   if (region() != new_origin->region())
     throw jlm::util::error("Invalid operand region.");
 
+  auto simpleNode = is<simple_input>(*this) ? static_cast<simple_input *>(this)->node() : nullptr;
+  if (simpleNode)
+    region()->RemoveFromCseIndex(simpleNode);
+
   auto old_origin = origin();
   old_origin->remove_user(this);
   this->origin_ = new_origin;
   new_origin->add_user(this);
 
+  if (simpleNode)
+    region()->InsertIntoCseIndex(simpleNode);
+
   if (is<node_input>(*this))
     static_cast<node_input *>(this)->node()->recompute_depth();
 
   region()->graph()->mark_denormalized();
-  on_input_change(this, old_origin, new_origin);
+  region()->GetNotifiers().on_input_change(this, old_origin, new_origin);
 }
 
 jlm::rvsdg::node *
@@ -86,7 +96,8 @@ output::~output() noexcept
 output::output(jlm::rvsdg::region * region, const jlm::rvsdg::port & port)
     : index_(0),
       region_(region),
-      port_(port.copy())
+      port_(port.copy()),
+      nusers_(0)
 {}
 
 std::string
@@ -98,9 +109,11 @@ output::debug_string() const
 void
 output::remove_user(jlm::rvsdg::input * user)
 {
-  JLM_ASSERT(users_.find(user) != users_.end());
+  JLM_ASSERT(user->origin() == this);
+  JLM_ASSERT(nusers_ != 0);
 
   users_.erase(user);
+  nusers_--;
 
   if (auto node = node_output::node(this))
   {
@@ -112,14 +125,15 @@ output::remove_user(jlm::rvsdg::input * user)
 void
 output::add_user(jlm::rvsdg::input * user)
 {
-  JLM_ASSERT(users_.find(user) == users_.end());
+  JLM_ASSERT(user->origin() == this);
 
   if (auto node = node_output::node(this))
   {
     if (!node->has_users())
       region()->bottom_nodes.erase(node);
   }
-  users_.insert(user);
+  users_.push_back(user);
+  nusers_++;
 }
 
 }
@@ -164,6 +178,7 @@ node_output::node_output(jlm::rvsdg::node * node, const jlm::rvsdg::port & port)
 
 node::node(std::unique_ptr<jlm::rvsdg::operation> op, jlm::rvsdg::region * region)
     : depth_(0),
+      id_(region->graph()->AllocateNodeId()),
       graph_(region->graph()),
       region_(region),
       operation_(std::move(op))
@@ -183,6 +198,7 @@ node::~node()
   inputs_.clear();
 
   region()->nodes.erase(this);
+  graph()->ReleaseNodeId(id_);
 }
 
 node_input *
@@ -251,37 +267,60 @@ node::RemoveOutput(size_t index)
   outputs_.pop_back();
 }
 
-void
-node::recompute_depth() noexcept
+static size_t
+ComputeDepth(const jlm::rvsdg::node & node) noexcept
 {
-  /*
-    FIXME: This function is inefficient, as it can visit the
-    node's successors multiple times. Optimally, we would like
-    to visit the node's successors in top down order to ensure
-    that each node is only visited once.
-  */
-  size_t new_depth = 0;
-  for (size_t n = 0; n < ninputs(); n++)
+  size_t depth = 0;
+  for (size_t n = 0; n < node.ninputs(); n++)
   {
-    auto producer = node_output::node(input(n)->origin());
-    new_depth = std::max(new_depth, producer ? producer->depth() + 1 : 0);
+    auto producer = node_output::node(node.input(n)->origin());
+    depth = std::max(depth, producer ? producer->depth() + 1 : 0);
   }
-  if (new_depth == depth())
-    return;
 
-  size_t old_depth = depth();
-  depth_ = new_depth;
-  on_node_depth_change(this, old_depth);
+  return depth;
+}
 
-  for (size_t n = 0; n < noutputs(); n++)
+void
+node::recompute_depth() noexcept
+{
+  if (ComputeDepth(*this) == depth())
+    return;
+
+  // The depths of the nodes before the change form a valid topological numbering of all nodes
+  // affected by it, as all affected nodes are successors of this node. Processing the affected
+  // nodes in increasing order of their old depths therefore guarantees that the depths of all
+  // producers are final once a node is visited, such that every node is visited at most once.
+  typedef std::pair<size_t, jlm::rvsdg::node *> queue_entry;
+  std::priority_queue<queue_entry, std::vector<queue_entry>, std::greater<queue_entry>> queue;
+  std::unordered_set<jlm::rvsdg::node *> queued;
+  auto & notifiers = region()->GetNotifiers();
+
+  queue.push({ depth(), this });
+  queued.insert(this);
+  while (!queue.empty())
   {
-    for (auto user : *(output(n)))
-    {
-      if (!is<node_input>(*user))
-        continue;
+    auto node = queue.top().second;
+    queue.pop();
+
+    auto new_depth = ComputeDepth(*node);
+    if (new_depth == node->depth())
+      continue;
 
-      auto node = static_cast<node_input *>(user)->node();
-      node->recompute_depth();
+    size_t old_depth = node->depth();
+    node->depth_ = new_depth;
+    notifiers.on_node_depth_change(node, old_depth);
+
+    for (size_t n = 0; n < node->noutputs(); n++)
+    {
+      for (auto user : *(node->output(n)))
+      {
+        if (!is<node_input>(*user))
+          continue;
+
+        auto successor = static_cast<node_input *>(user)->node();
+        if (queued.insert(successor).second)
+          queue.push({ successor->depth(), successor });
+      }
     }
   }
 }
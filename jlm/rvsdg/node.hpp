@@ -15,6 +15,7 @@
 
 #include <jlm/rvsdg/operation.hpp>
 #include <jlm/util/common.hpp>
+#include <jlm/util/intrusive-hash.hpp>
 #include <jlm/util/intrusive-list.hpp>
 #include <jlm/util/strfmt.hpp>
 
@@ -35,6 +36,7 @@ class substitution_map;
 class input
 {
   friend jlm::rvsdg::node;
+  friend jlm::rvsdg::output;
   friend jlm::rvsdg::region;
 
 public:
@@ -268,6 +270,12 @@ public:
   };
 
 private:
+  jlm::util::intrusive_list_anchor<jlm::rvsdg::input> output_user_list_anchor_;
+
+  typedef jlm::util::
+      intrusive_list_accessor<jlm::rvsdg::input, &jlm::rvsdg::input::output_user_list_anchor_>
+          output_user_list_accessor;
+
   size_t index_;
   jlm::rvsdg::output * origin_;
   jlm::rvsdg::region * region_;
@@ -293,9 +301,70 @@ class output
   friend jlm::rvsdg::node;
   friend jlm::rvsdg::region;
 
-  typedef std::unordered_set<jlm::rvsdg::input *>::const_iterator user_iterator;
+  typedef jlm::util::intrusive_list<jlm::rvsdg::input, jlm::rvsdg::input::output_user_list_accessor>
+      user_list;
 
 public:
+  /**
+   * Iterator over the users of an output. The users are threaded through an intrusive list
+   * anchored in the inputs, and are visited in the order in which they were added to the output.
+   */
+  class user_iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = jlm::rvsdg::input *;
+    using difference_type = std::ptrdiff_t;
+    using pointer = jlm::rvsdg::input * const *;
+    using reference = jlm::rvsdg::input * const &;
+
+    constexpr explicit user_iterator(jlm::rvsdg::input * user) noexcept
+        : user_(user)
+    {}
+
+    reference
+    operator*() const noexcept
+    {
+      return user_;
+    }
+
+    pointer
+    operator->() const noexcept
+    {
+      return &user_;
+    }
+
+    user_iterator &
+    operator++() noexcept
+    {
+      user_ = jlm::rvsdg::input::output_user_list_accessor().get_next(user_);
+      return *this;
+    }
+
+    user_iterator
+    operator++(int) noexcept
+    {
+      user_iterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    bool
+    operator==(const user_iterator & other) const noexcept
+    {
+      return user_ == other.user_;
+    }
+
+    bool
+    operator!=(const user_iterator & other) const noexcept
+    {
+      return !operator==(other);
+    }
+
+  private:
+    jlm::rvsdg::input * user_;
+  };
+
   virtual ~output() noexcept;
 
   output(jlm::rvsdg::region * region, const jlm::rvsdg::port & port);
@@ -319,7 +388,7 @@ public:
   inline size_t
   nusers() const noexcept
   {
-    return users_.size();
+    return nusers_;
   }
 
   /**
@@ -343,20 +412,20 @@ public:
     if (this == new_origin)
       return;
 
-    while (users_.size())
-      (*users_.begin())->divert_to(new_origin);
+    while (auto user = users_.first())
+      user->divert_to(new_origin);
   }
 
   inline user_iterator
   begin() const noexcept
   {
-    return users_.begin();
+    return user_iterator(users_.first());
   }
 
   inline user_iterator
   end() const noexcept
   {
-    return users_.end();
+    return user_iterator(nullptr);
   }
 
   inline const jlm::rvsdg::type &
@@ -559,7 +628,8 @@ private:
   size_t index_;
   jlm::rvsdg::region * region_;
   std::unique_ptr<jlm::rvsdg::port> port_;
-  std::unordered_set<jlm::rvsdg::input *> users_;
+  size_t nusers_;
+  user_list users_;
 };
 
 template<class T>
@@ -633,6 +703,8 @@ private:
 
 class node
 {
+  friend jlm::rvsdg::region;
+
 public:
   virtual ~node();
 
@@ -709,6 +781,10 @@ public:
     return outputs_[index].get();
   }
 
+  /**
+   * Recomputes the depth of the node from the depths of its producers and propagates any change
+   * to the node's transitive users. Every affected node is visited at most once.
+   */
   inline void
   recompute_depth() noexcept;
 
@@ -844,6 +920,20 @@ public:
     return depth_;
   }
 
+  /**
+   * Every node has an identifier that is unique among the nodes of its graph. Identifiers are
+   * dense and are recycled once their node is destroyed.
+   *
+   * @return The identifier of the node.
+   *
+   * \see graph::NumNodeIds()
+   */
+  [[nodiscard]] size_t
+  GetId() const noexcept
+  {
+    return id_;
+  }
+
 private:
   jlm::util::intrusive_list_anchor<jlm::rvsdg::node> region_node_list_anchor_;
 
@@ -851,6 +941,16 @@ private:
 
   jlm::util::intrusive_list_anchor<jlm::rvsdg::node> region_bottom_node_list_anchor_;
 
+  jlm::util::intrusive_hash_anchor<jlm::rvsdg::node> region_cse_hash_anchor_;
+
+  /**
+   * Hash over the node's operation and the origins of its inputs. It is only valid while the node
+   * is linked into the CSE index of its region.
+   *
+   * \see region#FindCongruentNode()
+   */
+  size_t cse_hash_;
+
 public:
   typedef jlm::util::
       intrusive_list_accessor<jlm::rvsdg::node, &jlm::rvsdg::node::region_node_list_anchor_>
@@ -864,8 +964,16 @@ public:
       intrusive_list_accessor<jlm::rvsdg::node, &jlm::rvsdg::node::region_bottom_node_list_anchor_>
           region_bottom_node_list_accessor;
 
+  typedef jlm::util::intrusive_hash_accessor<
+      size_t,
+      jlm::rvsdg::node,
+      &jlm::rvsdg::node::cse_hash_,
+      &jlm::rvsdg::node::region_cse_hash_anchor_>
+      region_cse_hash_accessor;
+
 private:
   size_t depth_;
+  size_t id_;
   jlm::rvsdg::graph * graph_;
   jlm::rvsdg::region * region_;
   std::unique_ptr<jlm::rvsdg::operation> operation_;
@@ -16,24 +16,54 @@ class node;
 class output;
 class region;
 
-extern jlm::util::notifier<jlm::rvsdg::region *> on_region_create;
-extern jlm::util::notifier<jlm::rvsdg::region *> on_region_destroy;
-
-extern jlm::util::notifier<jlm::rvsdg::node *> on_node_create;
-extern jlm::util::notifier<jlm::rvsdg::node *> on_node_destroy;
-extern jlm::util::notifier<jlm::rvsdg::node *, size_t> on_node_depth_change;
-
-extern jlm::util::notifier<jlm::rvsdg::input *> on_input_create;
-extern jlm::util::notifier<
-    jlm::rvsdg::input *,
-    jlm::rvsdg::output *, /* old */
-    jlm::rvsdg::output *  /* new */
-    >
-    on_input_change;
-extern jlm::util::notifier<jlm::rvsdg::input *> on_input_destroy;
-
-extern jlm::util::notifier<jlm::rvsdg::output *> on_output_create;
-extern jlm::util::notifier<jlm::rvsdg::output *> on_output_destroy;
+/**
+ * The notifiers that report changes to the nodes, inputs, outputs, and subregions of a single
+ * region.
+ *
+ * Every region owns its own set of notifiers, such that listeners are only invoked for changes to
+ * the region they are connected to. Disjoint regions of a graph, e.g., the subregions of different
+ * lambda nodes, can consequently be modified concurrently from different threads. A single region
+ * and its notifiers are not thread-safe.
+ *
+ * The creation and destruction of a subregion is reported to the notifiers of the region that
+ * contains the subregion's structural node.
+ *
+ * \see region::GetNotifiers()
+ */
+class Notifiers final
+{
+public:
+  Notifiers() = default;
+
+  Notifiers(const Notifiers &) = delete;
+
+  Notifiers(Notifiers &&) = delete;
+
+  Notifiers &
+  operator=(const Notifiers &) = delete;
+
+  Notifiers &
+  operator=(Notifiers &&) = delete;
+
+  jlm::util::notifier<jlm::rvsdg::region *> on_region_create;
+  jlm::util::notifier<jlm::rvsdg::region *> on_region_destroy;
+
+  jlm::util::notifier<jlm::rvsdg::node *> on_node_create;
+  jlm::util::notifier<jlm::rvsdg::node *> on_node_destroy;
+  jlm::util::notifier<jlm::rvsdg::node *, size_t> on_node_depth_change;
+
+  jlm::util::notifier<jlm::rvsdg::input *> on_input_create;
+  jlm::util::notifier<
+      jlm::rvsdg::input *,
+      jlm::rvsdg::output *, /* old */
+      jlm::rvsdg::output *  /* new */
+      >
+      on_input_change;
+  jlm::util::notifier<jlm::rvsdg::input *> on_input_destroy;
+
+  jlm::util::notifier<jlm::rvsdg::output *> on_output_create;
+  jlm::util::notifier<jlm::rvsdg::output *> on_output_destroy;
+};
 
 }
 
@@ -50,7 +50,9 @@ struct default_type_of_value
  *   as std::string a human-readable representation of the value
  * - TypeOfValue: functional that takes a ValueRepr instance and returns
  *   the Type instances corresponding to this value (in case the type
- *   class is polymorphic) */
+ *   class is polymorphic)
+ * - ValueRepr must provide a hash() method that is consistent with its
+ *   equality comparison */
 template<typename Type, typename ValueRepr, typename FormatValue, typename TypeOfValue>
 class domain_const_op final : public nullary_op
 {
@@ -76,6 +78,12 @@ public:
     return op && op->value_ == value_;
   }
 
+  [[nodiscard]] size_t
+  hash() const noexcept override
+  {
+    return typeid(*this).hash_code() ^ value_.hash();
+  }
+
   virtual std::string
   debug_string() const override
   {
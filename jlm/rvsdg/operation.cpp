@@ -17,17 +17,17 @@ port::~port()
 {}
 
 port::port(const jlm::rvsdg::type & type)
-    : port(type.copy())
+    : type_(type::Intern(type))
 {}
 
 port::port(std::unique_ptr<jlm::rvsdg::type> type)
-    : type_(std::move(type))
+    : type_(type::Intern(std::move(type)))
 {}
 
 bool
 port::operator==(const port & other) const noexcept
 {
-  return *type_ == *other.type_;
+  return type_ == other.type_ || *type_ == *other.type_;
 }
 
 std::unique_ptr<port>
@@ -41,6 +41,12 @@ port::copy() const
 operation::~operation() noexcept
 {}
 
+size_t
+operation::hash() const noexcept
+{
+  return typeid(*this).hash_code();
+}
+
 jlm::rvsdg::node_normal_form *
 operation::normal_form(jlm::rvsdg::graph * graph) noexcept
 {
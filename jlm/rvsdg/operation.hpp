@@ -36,7 +36,7 @@ public:
   port(std::unique_ptr<jlm::rvsdg::type> type);
 
   inline port(const port & other)
-      : type_(other.type_->copy())
+      : type_(other.type_)
   {}
 
   inline port(port && other)
@@ -49,7 +49,7 @@ public:
     if (&other == this)
       return *this;
 
-    type_ = other.type_->copy();
+    type_ = other.type_;
 
     return *this;
   }
@@ -84,7 +84,12 @@ public:
   copy() const;
 
 private:
-  std::unique_ptr<jlm::rvsdg::type> type_;
+  /**
+   * The type of the port. It is interned, such that ports of equal types share it.
+   *
+   * \see type#Intern()
+   */
+  std::shared_ptr<const jlm::rvsdg::type> type_;
 };
 
 /* operation */
@@ -103,6 +108,19 @@ public:
   virtual std::unique_ptr<jlm::rvsdg::operation>
   copy() const = 0;
 
+  /**
+   * Computes a hash value of the operation.
+   *
+   * The hash value must be consistent with operator==(), i.e., two operations that compare equal
+   * must have the same hash value. The default implementation hashes the dynamic type of the
+   * operation. Operations that are distinguished by additional attributes, such as the value of a
+   * constant, should override this method to include them.
+   *
+   * @return The hash value of the operation.
+   */
+  [[nodiscard]] virtual size_t
+  hash() const noexcept;
+
   inline bool
   operator!=(const operation & other) const noexcept
   {
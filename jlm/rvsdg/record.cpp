@@ -27,6 +27,12 @@ rcdtype::operator==(const jlm::rvsdg::type & other) const noexcept
   return type != nullptr && declaration() == type->declaration();
 }
 
+size_t
+rcdtype::hash() const noexcept
+{
+  return typeid(rcdtype).hash_code() ^ std::hash<const rcddeclaration *>()(dcl_);
+}
+
 std::unique_ptr<jlm::rvsdg::type>
 rcdtype::copy() const
 {
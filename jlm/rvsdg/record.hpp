@@ -97,6 +97,9 @@ public:
   virtual bool
   operator==(const jlm::rvsdg::type & type) const noexcept override;
 
+  [[nodiscard]] size_t
+  hash() const noexcept override;
+
   virtual std::unique_ptr<jlm::rvsdg::type>
   copy() const override;
 
@@ -5,7 +5,9 @@
  */
 
 #include <jlm/rvsdg/graph.hpp>
+#include <jlm/rvsdg/NodeSideTable.hpp>
 #include <jlm/rvsdg/notifiers.hpp>
+#include <jlm/rvsdg/simple-node.hpp>
 #include <jlm/rvsdg/structural-node.hpp>
 #include <jlm/rvsdg/substitution.hpp>
 #include <jlm/rvsdg/traverser.hpp>
@@ -13,11 +15,17 @@
 namespace jlm::rvsdg
 {
 
+static inline size_t
+CombineCseHash(size_t seed, size_t value) noexcept
+{
+  return seed ^ (value + 0x9e3779b97f4a7c15 + (seed << 6) + (seed >> 2));
+}
+
 /* argument */
 
 argument::~argument() noexcept
 {
-  on_output_destroy(this);
+  region()->GetNotifiers().on_output_destroy(this);
 
   if (input())
     input()->arguments.erase(this);
@@ -45,7 +53,7 @@ argument::create(
     structural_input * input,
     const jlm::rvsdg::port & port)
 {
-  auto argument = new jlm::rvsdg::argument(region, input, port);
+  auto argument = new (region->graph()->GetArena()) jlm::rvsdg::argument(region, input, port);
   region->append_argument(argument);
   return argument;
 }
@@ -54,7 +62,7 @@ argument::create(
 
 result::~result() noexcept
 {
-  on_input_destroy(this);
+  region()->GetNotifiers().on_input_destroy(this);
 
   if (output())
     output()->results.erase(this);
@@ -84,7 +92,7 @@ result::create(
     jlm::rvsdg::structural_output * output,
     const jlm::rvsdg::port & port)
 {
-  auto result = new jlm::rvsdg::result(region, origin, output, port);
+  auto result = new (region->graph()->GetArena()) jlm::rvsdg::result(region, origin, output, port);
   region->append_result(result);
   return result;
 }
@@ -93,7 +101,8 @@ result::create(
 
 region::~region()
 {
-  on_region_destroy(this);
+  if (node())
+    node()->region()->GetNotifiers().on_region_destroy(this);
 
   while (results_.size())
     RemoveResult(results_.size() - 1);
@@ -110,17 +119,17 @@ region::~region()
 region::region(jlm::rvsdg::region * parent, jlm::rvsdg::graph * graph)
     : index_(0),
       graph_(graph),
-      node_(nullptr)
-{
-  on_region_create(this);
-}
+      node_(nullptr),
+      IsCseIndexStale_(false)
+{}
 
 region::region(jlm::rvsdg::structural_node * node, size_t index)
     : index_(index),
       graph_(node->graph()),
-      node_(node)
+      node_(node),
+      IsCseIndexStale_(false)
 {
-  on_region_create(this);
+  node->region()->GetNotifiers().on_region_create(this);
 }
 
 void
@@ -136,7 +145,7 @@ region::append_argument(jlm::rvsdg::argument * argument)
 
   argument->index_ = narguments();
   arguments_.push_back(argument);
-  on_output_create(argument);
+  notifiers_.on_output_create(argument);
 }
 
 void
@@ -171,7 +180,7 @@ region::append_result(jlm::rvsdg::result * result)
 
   result->index_ = nresults();
   results_.push_back(result);
-  on_input_create(result);
+  notifiers_.on_input_create(result);
 }
 
 void
@@ -195,18 +204,113 @@ region::remove_node(jlm::rvsdg::node * node)
   delete node;
 }
 
+jlm::rvsdg::node *
+region::FindCongruentNode(
+    const jlm::rvsdg::operation & op,
+    const std::vector<jlm::rvsdg::output *> & operands)
+{
+  auto hash = op.hash();
+  for (auto operand : operands)
+    hash = CombineCseHash(hash, std::hash<const jlm::rvsdg::output *>()(operand));
+
+  auto isCongruent = [&](const jlm::rvsdg::node & node)
+  {
+    if (node.ninputs() != operands.size())
+      return false;
+
+    for (size_t n = 0; n < operands.size(); n++)
+    {
+      if (node.input(n)->origin() != operands[n])
+        return false;
+    }
+
+    return node.operation() == op;
+  };
+
+  /*
+    All nodes with the same hash reside in the same bucket. The bucket's chain is therefore
+    walked from the first node with a matching hash until its end.
+  */
+  if (IsCseIndexStale_)
+    RebuildCseIndex();
+
+  jlm::rvsdg::node::region_cse_hash_accessor accessor;
+  for (auto node = cse_index_.find(hash).ptr(); node; node = accessor.get_next(node))
+  {
+    if (node->cse_hash_ == hash && isCongruent(*node))
+      return node;
+  }
+
+  return nullptr;
+}
+
+void
+region::InsertIntoCseIndex(jlm::rvsdg::node * node)
+{
+  JLM_ASSERT(node->region() == this);
+  if (IsCseIndexStale_)
+    return;
+
+  auto hash = node->operation().hash();
+  for (size_t n = 0; n < node->ninputs(); n++)
+    hash = CombineCseHash(hash, std::hash<const jlm::rvsdg::output *>()(node->input(n)->origin()));
+
+  node->cse_hash_ = hash;
+  cse_index_.insert(node);
+}
+
+void
+region::RemoveFromCseIndex(jlm::rvsdg::node * node) noexcept
+{
+  JLM_ASSERT(node->region() == this);
+  if (IsCseIndexStale_)
+    return;
+
+  cse_index_.erase(node);
+}
+
+void
+region::RebuildCseIndex()
+{
+  IsCseIndexStale_ = false;
+  cse_index_.clear();
+  cse_index_.reserve(nnodes());
+
+  for (auto & node : nodes)
+  {
+    if (dynamic_cast<const simple_node *>(&node))
+      InsertIntoCseIndex(&node);
+  }
+}
+
 void
 region::copy(region * target, substitution_map & smap, bool copy_arguments, bool copy_results) const
 {
   smap.insert(this, target);
 
-  /* order nodes top-down */
-  std::vector<std::vector<const jlm::rvsdg::node *>> context(nnodes());
+  // Order the nodes top-down by sorting them according to their depth
+  std::vector<size_t> depthOffsets;
+  size_t numOutputs = copy_arguments ? narguments() : 0;
   for (const auto & node : nodes)
   {
-    JLM_ASSERT(node.depth() < context.size());
-    context[node.depth()].push_back(&node);
+    if (node.depth() >= depthOffsets.size())
+      depthOffsets.resize(node.depth() + 1, 0);
+    depthOffsets[node.depth()]++;
+    numOutputs += node.noutputs();
   }
+  smap.reserve(smap.noutputs() + numOutputs);
+
+  size_t offset = 0;
+  for (auto & depthOffset : depthOffsets)
+  {
+    auto numNodes = depthOffset;
+    depthOffset = offset;
+    offset += numNodes;
+  }
+
+  std::vector<const jlm::rvsdg::node *> sortedNodes(nnodes());
+  for (const auto & node : nodes)
+    sortedNodes[depthOffsets[node.depth()]++] = &node;
 
   /* copy arguments */
   if (copy_arguments)
@@ -219,14 +323,58 @@ region::copy(region * target, substitution_map & smap, bool copy_arguments, bool
     }
   }
 
+  // Rebuilding the CSE index of the target region on the next lookup is at most as expensive as
+  // the copy itself.
+  if (target != this && nnodes() >= target->nnodes())
+  {
+    target->IsCseIndexStale_ = true;
+  }
+
+  // The copies of the simple nodes are kept in a dense table if the region holds a substantial
+  // share of the nodes of the graph, as the size of the table is bounded by the node identifiers.
+  auto useDenseTable = nnodes() * 8 >= graph()->NumNodeIds();
+
   /* copy nodes */
-  for (size_t n = 0; n < context.size(); n++)
+  NodeSideTable<jlm::rvsdg::node *> copies;
+  std::vector<jlm::rvsdg::output *> operands;
+  for (auto node : sortedNodes)
   {
-    for (const auto node : context[n])
+    JLM_ASSERT(target == smap.lookup(node->region()));
+
+    auto simpleNode = dynamic_cast<const simple_node *>(node);
+    if (simpleNode == nullptr)
     {
-      JLM_ASSERT(target == smap.lookup(node->region()));
       node->copy(target, smap);
+      continue;
     }
+
+    operands.clear();
+    for (size_t n = 0; n < simpleNode->ninputs(); n++)
+    {
+      auto origin = simpleNode->input(n)->origin();
+      auto producer = node_output::node(origin);
+      if (useDenseTable && producer && copies.Contains(*producer))
+      {
+        operands.push_back(copies.Lookup(*producer)->output(origin->index()));
+        continue;
+      }
+
+      auto operand = smap.lookup(origin);
+      if (operand == nullptr)
+      {
+        if (target != this)
+          throw jlm::util::error("Node operand not in substitution map.");
+
+        operand = origin;
+      }
+      operands.push_back(operand);
+    }
+
+    auto copy = simpleNode->copy(target, operands);
+    if (useDenseTable)
+      copies.Insert(*simpleNode, copy);
+    for (size_t n = 0; n < copy->noutputs(); n++)
+      smap.insert(simpleNode->output(n), copy->output(n));
   }
 
   /* copy results */
@@ -11,6 +11,8 @@
 #include <stddef.h>
 
 #include <jlm/rvsdg/node.hpp>
+#include <jlm/rvsdg/notifiers.hpp>
+#include <jlm/util/Arena.hpp>
 #include <jlm/util/common.hpp>
 
 namespace jlm::rvsdg
@@ -25,7 +27,7 @@ class structural_op;
 class structural_output;
 class substitution_map;
 
-class argument : public output
+class argument : public output, public jlm::util::ArenaAllocated
 {
   jlm::util::intrusive_list_anchor<jlm::rvsdg::argument> structural_input_anchor_;
 
@@ -66,7 +68,7 @@ private:
   jlm::rvsdg::structural_input * input_;
 };
 
-class result : public input
+class result : public input, public jlm::util::ArenaAllocated
 {
   jlm::util::intrusive_list_anchor<jlm::rvsdg::result> structural_output_anchor_;
 
@@ -114,6 +116,9 @@ private:
 
 class region
 {
+  friend jlm::rvsdg::input;
+  friend jlm::rvsdg::simple_node;
+
   typedef jlm::util::intrusive_list<jlm::rvsdg::node, jlm::rvsdg::node::region_node_list_accessor>
       region_nodes_list;
 
@@ -125,6 +130,10 @@ class region
       intrusive_list<jlm::rvsdg::node, jlm::rvsdg::node::region_bottom_node_list_accessor>
           region_bottom_node_list;
 
+  typedef jlm::util::
+      intrusive_hash<size_t, jlm::rvsdg::node, jlm::rvsdg::node::region_cse_hash_accessor>
+          region_cse_hash;
+
 public:
   ~region();
 
@@ -168,6 +177,16 @@ public:
     return node_;
   }
 
+  /**
+   * @return The notifiers that report changes to the nodes, inputs, outputs, and subregions of
+   * this region.
+   */
+  [[nodiscard]] Notifiers &
+  GetNotifiers() noexcept
+  {
+    return notifiers_;
+  }
+
   size_t
   index() const noexcept
   {
@@ -321,6 +340,26 @@ public:
   void
   remove_node(jlm::rvsdg::node * node);
 
+  /**
+   * Looks up a simple node in the region that performs operation \p op on \p operands.
+   *
+   * The lookup is performed on a hash index that the region maintains over all its simple nodes.
+   * The index is keyed on the hash of a node's operation and the origins of its inputs, and
+   * therefore runs in O(1) expected time independently of the number of users of \p operands.
+   * An index that was deferred by copy() is rebuilt first, which allocates.
+   *
+   * @param op The operation of the node.
+   * @param operands The origins of the node's inputs.
+   * @return A node that is congruent to a node created from \p op and \p operands, or nullptr if
+   * no such node exists.
+   *
+   * \see operation#hash()
+   */
+  [[nodiscard]] jlm::rvsdg::node *
+  FindCongruentNode(
+      const jlm::rvsdg::operation & op,
+      const std::vector<jlm::rvsdg::output *> & operands);
+
   /**
     \brief Copy a region with substitutions
     \param target Target region to create nodes in
@@ -332,6 +371,11 @@ public:
     subregions into the target region. Substitutions
     will be performed as specified, and the substitution
     map will be updated as nodes are copied.
+
+    The operands of the copied simple nodes are resolved through a dense table of the copies if
+    the region holds a substantial share of the nodes of the graph. Copies that are at least as
+    large as the target region defer the update of the target region's CSE index until the index
+    is queried again.
   */
   void
   copy(region * target, substitution_map & smap, bool copy_arguments, bool copy_results) const;
@@ -373,11 +417,35 @@ public:
   region_bottom_node_list bottom_nodes;
 
 private:
+  /**
+   * Links \p node into the region's CSE index. Must be invoked after the inputs of \p node were
+   * created or any of their origins changed.
+   */
+  void
+  InsertIntoCseIndex(jlm::rvsdg::node * node);
+
+  /**
+   * Unlinks \p node from the region's CSE index. Must be invoked before \p node is destroyed or
+   * any of the origins of its inputs change.
+   */
+  void
+  RemoveFromCseIndex(jlm::rvsdg::node * node) noexcept;
+
+  /**
+   * Rebuilds the region's CSE index from all its simple nodes.
+   */
+  void
+  RebuildCseIndex();
+
   size_t index_;
   jlm::rvsdg::graph * graph_;
   jlm::rvsdg::structural_node * node_;
   std::vector<jlm::rvsdg::result *> results_;
   std::vector<jlm::rvsdg::argument *> arguments_;
+  region_cse_hash cse_index_;
+  // The CSE index is not updated while it is stale, and rebuilt on the next lookup
+  bool IsCseIndexStale_;
+  Notifiers notifiers_;
 };
 
 static inline void
@@ -15,7 +15,7 @@ namespace jlm::rvsdg
 
 simple_input::~simple_input() noexcept
 {
-  on_input_destroy(this);
+  region()->GetNotifiers().on_input_destroy(this);
 }
 
 simple_input::simple_input(
@@ -33,14 +33,15 @@ simple_output::simple_output(jlm::rvsdg::simple_node * node, const jlm::rvsdg::p
 
 simple_output::~simple_output() noexcept
 {
-  on_output_destroy(this);
+  region()->GetNotifiers().on_output_destroy(this);
 }
 
 /* simple nodes */
 
 simple_node::~simple_node()
 {
-  on_node_destroy(this);
+  region()->GetNotifiers().on_node_destroy(this);
+  region()->RemoveFromCseIndex(this);
 }
 
 simple_node::simple_node(
@@ -57,16 +58,21 @@ simple_node::simple_node(
         operands.size(),
         " arguments."));
 
+  auto & arena = region->graph()->GetArena();
   for (size_t n = 0; n < operation().narguments(); n++)
   {
-    node::add_input(
-        std::unique_ptr<node_input>(new simple_input(this, operands[n], operation().argument(n))));
+    node::add_input(std::unique_ptr<node_input>(
+        new (arena) simple_input(this, operands[n], operation().argument(n))));
   }
 
   for (size_t n = 0; n < operation().nresults(); n++)
-    node::add_output(std::unique_ptr<node_output>(new simple_output(this, operation().result(n))));
+  {
+    node::add_output(
+        std::unique_ptr<node_output>(new (arena) simple_output(this, operation().result(n))));
+  }
 
-  on_node_create(this);
+  region->InsertIntoCseIndex(this);
+  region->GetNotifiers().on_node_create(this);
 }
 
 jlm::rvsdg::node *
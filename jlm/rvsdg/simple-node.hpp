@@ -20,7 +20,7 @@ class simple_output;
 
 /* simple nodes */
 
-class simple_node : public node
+class simple_node : public node, public jlm::util::ArenaAllocated
 {
 public:
   virtual ~simple_node();
@@ -54,7 +54,7 @@ public:
       const jlm::rvsdg::simple_op & op,
       const std::vector<jlm::rvsdg::output *> & operands)
   {
-    return new simple_node(region, op, operands);
+    return new (region->graph()->GetArena()) simple_node(region, op, operands);
   }
 
   static inline std::vector<jlm::rvsdg::output *>
@@ -70,7 +70,7 @@ public:
 
 /* inputs */
 
-class simple_input final : public node_input
+class simple_input final : public node_input, public jlm::util::ArenaAllocated
 {
   friend jlm::rvsdg::output;
 
@@ -89,7 +89,7 @@ public:
 
 /* outputs */
 
-class simple_output final : public node_output
+class simple_output final : public node_output, public jlm::util::ArenaAllocated
 {
   friend jlm::rvsdg::simple_input;
 
@@ -6,41 +6,6 @@
 #include <jlm/rvsdg/graph.hpp>
 #include <jlm/rvsdg/simple-node.hpp>
 
-static jlm::rvsdg::node *
-node_cse(
-    jlm::rvsdg::region * region,
-    const jlm::rvsdg::operation & op,
-    const std::vector<jlm::rvsdg::output *> & arguments)
-{
-  auto cse_test = [&](const jlm::rvsdg::node * node)
-  {
-    return node->operation() == op && arguments == jlm::rvsdg::operands(node);
-  };
-
-  if (!arguments.empty())
-  {
-    for (const auto & user : *arguments[0])
-    {
-      if (!jlm::rvsdg::is<jlm::rvsdg::node_input>(*user))
-        continue;
-
-      auto node = static_cast<jlm::rvsdg::node_input *>(user)->node();
-      if (cse_test(node))
-        return node;
-    }
-  }
-  else
-  {
-    for (auto & node : region->top_nodes)
-    {
-      if (cse_test(&node))
-        return &node;
-    }
-  }
-
-  return nullptr;
-}
-
 namespace jlm::rvsdg
 {
 
@@ -66,7 +31,7 @@ simple_normal_form::normalize_node(jlm::rvsdg::node * node) const
 
   if (get_cse())
   {
-    auto new_node = node_cse(node->region(), node->operation(), operands(node));
+    auto new_node = node->region()->FindCongruentNode(node->operation(), operands(node));
     JLM_ASSERT(new_node);
     if (new_node != node)
     {
@@ -87,7 +52,7 @@ simple_normal_form::normalized_create(
 {
   jlm::rvsdg::node * node = nullptr;
   if (get_mutable() && get_cse())
-    node = node_cse(region, op, arguments);
+    node = region->FindCongruentNode(op, arguments);
   if (!node)
     node = simple_node::create(region, op, arguments);
 
@@ -17,7 +17,7 @@ structural_input::~structural_input() noexcept
 {
   JLM_ASSERT(arguments.empty());
 
-  on_input_destroy(this);
+  region()->GetNotifiers().on_input_destroy(this);
 }
 
 structural_input::structural_input(
@@ -26,7 +26,7 @@ structural_input::structural_input(
     const jlm::rvsdg::port & port)
     : node_input(origin, node, port)
 {
-  on_input_create(this);
+  region()->GetNotifiers().on_input_create(this);
 }
 
 /* structural output */
@@ -35,7 +35,7 @@ structural_output::~structural_output() noexcept
 {
   JLM_ASSERT(results.empty());
 
-  on_output_destroy(this);
+  region()->GetNotifiers().on_output_destroy(this);
 }
 
 structural_output::structural_output(
@@ -43,14 +43,14 @@ structural_output::structural_output(
     const jlm::rvsdg::port & port)
     : node_output(node, port)
 {
-  on_output_create(this);
+  region()->GetNotifiers().on_output_create(this);
 }
 
 /* structural node */
 
 structural_node::~structural_node()
 {
-  on_node_destroy(this);
+  region()->GetNotifiers().on_node_destroy(this);
 
   subregions_.clear();
 }
@@ -67,7 +67,7 @@ structural_node::structural_node(
   for (size_t n = 0; n < nsubregions; n++)
     subregions_.emplace_back(std::unique_ptr<jlm::rvsdg::region>(new jlm::rvsdg::region(this, n)));
 
-  on_node_create(this);
+  region->GetNotifiers().on_node_create(this);
 }
 
 structural_input *
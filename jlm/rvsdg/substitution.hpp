@@ -8,8 +8,7 @@
 #define JLM_RVSDG_SUBSTITUTION_HPP
 
 #include <jlm/util/common.hpp>
-
-#include <unordered_map>
+#include <jlm/util/FlatPointerMap.hpp>
 
 namespace jlm::rvsdg
 {
@@ -18,25 +17,32 @@ class output;
 class region;
 class structural_input;
 
+/**
+ * Maps the regions, outputs, and structural inputs of a graph to their copies.
+ *
+ * The mappings are kept in flat open-addressing tables. Callers that know the number of outputs
+ * they are about to copy can reserve capacity up front, and a map can be cleared and reused for
+ * a sequence of copies without reallocating its tables.
+ */
 class substitution_map final
 {
 public:
   bool
   contains(const output & original) const noexcept
   {
-    return output_map_.find(&original) != output_map_.end();
+    return output_map_.Contains(&original);
   }
 
   bool
   contains(const region & original) const noexcept
   {
-    return region_map_.find(&original) != region_map_.end();
+    return region_map_.Contains(&original);
   }
 
   bool
   contains(const structural_input & original) const noexcept
   {
-    return structinput_map_.find(&original) != structinput_map_.end();
+    return structinput_map_.Contains(&original);
   }
 
   output &
@@ -45,7 +51,7 @@ public:
     if (!contains(original))
       throw jlm::util::error("Output not in substitution map.");
 
-    return *output_map_.find(&original)->second;
+    return *output_map_.Lookup(&original);
   }
 
   region &
@@ -54,7 +60,7 @@ public:
     if (!contains(original))
       throw jlm::util::error("Region not in substitution map.");
 
-    return *region_map_.find(&original)->second;
+    return *region_map_.Lookup(&original);
   }
 
   structural_input &
@@ -63,52 +69,78 @@ public:
     if (!contains(original))
       throw jlm::util::error("Structural input not in substitution map.");
 
-    return *structinput_map_.find(&original)->second;
+    return *structinput_map_.Lookup(&original);
   }
 
   inline jlm::rvsdg::output *
   lookup(const jlm::rvsdg::output * original) const noexcept
   {
-    auto i = output_map_.find(original);
-    return i != output_map_.end() ? i->second : nullptr;
+    return output_map_.Lookup(original);
   }
 
   inline jlm::rvsdg::region *
   lookup(const jlm::rvsdg::region * original) const noexcept
   {
-    auto i = region_map_.find(original);
-    return i != region_map_.end() ? i->second : nullptr;
+    return region_map_.Lookup(original);
   }
 
   inline jlm::rvsdg::structural_input *
   lookup(const jlm::rvsdg::structural_input * original) const noexcept
   {
-    auto i = structinput_map_.find(original);
-    return i != structinput_map_.end() ? i->second : nullptr;
+    return structinput_map_.Lookup(original);
   }
 
   inline void
   insert(const jlm::rvsdg::output * original, jlm::rvsdg::output * substitute)
   {
-    output_map_[original] = substitute;
+    output_map_.Insert(original, substitute);
   }
 
   inline void
   insert(const jlm::rvsdg::region * original, jlm::rvsdg::region * substitute)
   {
-    region_map_[original] = substitute;
+    region_map_.Insert(original, substitute);
   }
 
   inline void
   insert(const jlm::rvsdg::structural_input * original, jlm::rvsdg::structural_input * substitute)
   {
-    structinput_map_[original] = substitute;
+    structinput_map_.Insert(original, substitute);
+  }
+
+  /**
+   * @return The number of outputs in the map.
+   */
+  [[nodiscard]] size_t
+  noutputs() const noexcept
+  {
+    return output_map_.Size();
+  }
+
+  /**
+   * Reserves capacity such that the map can hold \p noutputs outputs without growing.
+   */
+  void
+  reserve(size_t noutputs)
+  {
+    output_map_.Reserve(noutputs);
+  }
+
+  /**
+   * Removes all mappings, but keeps the capacity of the map for its reuse.
+   */
+  void
+  clear() noexcept
+  {
+    region_map_.Clear();
+    output_map_.Clear();
+    structinput_map_.Clear();
   }
 
 private:
-  std::unordered_map<const jlm::rvsdg::region *, jlm::rvsdg::region *> region_map_;
-  std::unordered_map<const jlm::rvsdg::output *, jlm::rvsdg::output *> output_map_;
-  std::unordered_map<const jlm::rvsdg::structural_input *, jlm::rvsdg::structural_input *>
+  util::FlatPointerMap<jlm::rvsdg::region, jlm::rvsdg::region> region_map_;
+  util::FlatPointerMap<jlm::rvsdg::output, jlm::rvsdg::output> output_map_;
+  util::FlatPointerMap<jlm::rvsdg::structural_input, jlm::rvsdg::structural_input>
       structinput_map_;
 };
 
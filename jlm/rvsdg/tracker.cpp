@@ -7,12 +7,18 @@
 #include <jlm/rvsdg/graph.hpp>
 #include <jlm/rvsdg/notifiers.hpp>
 
+#include <mutex>
+#include <unordered_set>
+
 using namespace std::placeholders;
 
 namespace
 {
 
-typedef std::unordered_set<const jlm::rvsdg::graph *> tracker_set;
+typedef std::unordered_multiset<const jlm::rvsdg::graph *> tracker_set;
+
+/* Trackers of disjoint regions can be created concurrently from different threads. */
+std::mutex active_trackers_mutex;
 
 tracker_set *
 active_trackers()
@@ -27,13 +33,16 @@ active_trackers()
 void
 register_tracker(const jlm::rvsdg::tracker * tracker)
 {
+  std::lock_guard<std::mutex> guard(active_trackers_mutex);
   active_trackers()->insert(tracker->graph());
 }
 
 void
 unregister_tracker(const jlm::rvsdg::tracker * tracker)
 {
-  active_trackers()->erase(tracker->graph());
+  std::lock_guard<std::mutex> guard(active_trackers_mutex);
+  auto trackers = active_trackers();
+  trackers->erase(trackers->find(tracker->graph()));
 }
 
 }
@@ -44,6 +53,7 @@ namespace jlm::rvsdg
 bool
 has_active_trackers(const jlm::rvsdg::graph * graph)
 {
+  std::lock_guard<std::mutex> guard(active_trackers_mutex);
   auto at = active_trackers();
   return at->find(graph) != at->end();
 }
@@ -53,10 +63,11 @@ has_active_trackers(const jlm::rvsdg::graph * graph)
 class tracker_depth_state
 {
 public:
-  inline tracker_depth_state()
+  inline tracker_depth_state(NodeSideTable<tracker::nodestate> & nodestates)
       : count_(0),
         top_depth_(0),
-        bottom_depth_(0)
+        bottom_depth_(0),
+        nodestates_(nodestates)
   {}
 
   tracker_depth_state(const tracker_depth_state &) = delete;
@@ -69,26 +80,30 @@ public:
   tracker_depth_state &
   operator=(tracker_depth_state &&) = delete;
 
-  inline tracker_nodestate *
+  inline jlm::rvsdg::node *
   peek_top() const noexcept
   {
-    return count_ ? *nodestates_.at(top_depth_).begin() : nullptr;
+    return count_ ? nodes_[top_depth_] : nullptr;
   }
 
-  inline tracker_nodestate *
+  inline jlm::rvsdg::node *
   peek_bottom() const noexcept
   {
-    return count_ ? *nodestates_.at(bottom_depth_).begin() : nullptr;
+    return count_ ? nodes_[bottom_depth_] : nullptr;
   }
 
   inline void
-  add(tracker_nodestate * nodestate, size_t depth)
+  add(jlm::rvsdg::node * node, size_t depth)
   {
-    auto it = nodestates_.find(depth);
-    if (it != nodestates_.end())
-      it->second.insert(nodestate);
-    else
-      nodestates_[depth] = { nodestate };
+    if (depth >= nodes_.size())
+      nodes_.resize(depth + 1, nullptr);
+
+    auto & nstate = nodestates_.Lookup(*node);
+    nstate.prev = nullptr;
+    nstate.next = nodes_[depth];
+    if (nstate.next)
+      nodestates_.Lookup(*nstate.next).prev = node;
+    nodes_[depth] = node;
 
     count_++;
     if (count_ == 1)
@@ -106,9 +121,17 @@ public:
   }
 
   inline void
-  remove(tracker_nodestate * nodestate, size_t depth)
+  remove(jlm::rvsdg::node * node, size_t depth)
   {
-    nodestates_[depth].erase(nodestate);
+    auto & nstate = nodestates_.Lookup(*node);
+    if (nstate.prev)
+      nodestates_.Lookup(*nstate.prev).next = nstate.next;
+    else
+      nodes_[depth] = nstate.next;
+    if (nstate.next)
+      nodestates_.Lookup(*nstate.next).prev = nstate.prev;
+    nstate.prev = nullptr;
+    nstate.next = nullptr;
 
     count_--;
     if (count_ == 0)
@@ -116,44 +139,46 @@ public:
 
     if (depth == top_depth_)
     {
-      while (nodestates_[top_depth_].empty())
+      while (nodes_[top_depth_] == nullptr)
         top_depth_++;
     }
 
     if (depth == bottom_depth_)
     {
-      while (nodestates_[bottom_depth_].empty())
+      while (nodes_[bottom_depth_] == nullptr)
         bottom_depth_--;
     }
 
     JLM_ASSERT(top_depth_ <= bottom_depth_);
   }
 
-  inline tracker_nodestate *
+  inline jlm::rvsdg::node *
   pop_top()
   {
-    auto nodestate = peek_top();
-    if (nodestate)
-      remove(nodestate, top_depth_);
+    auto node = peek_top();
+    if (node)
+      remove(node, top_depth_);
 
-    return nodestate;
+    return node;
   }
 
-  inline tracker_nodestate *
+  inline jlm::rvsdg::node *
   pop_bottom()
   {
-    auto nodestate = peek_bottom();
-    if (nodestate)
-      remove(nodestate, bottom_depth_);
+    auto node = peek_bottom();
+    if (node)
+      remove(node, bottom_depth_);
 
-    return nodestate;
+    return node;
   }
 
 private:
   size_t count_;
   size_t top_depth_;
   size_t bottom_depth_;
-  std::unordered_map<size_t, std::unordered_set<tracker_nodestate *>> nodestates_;
+  /* heads of the lists of nodes with the same depth, indexed by depth */
+  std::vector<jlm::rvsdg::node *> nodes_;
+  NodeSideTable<tracker::nodestate> & nodestates_;
 };
 
 /* tracker */
@@ -163,101 +188,98 @@ tracker::~tracker() noexcept
   unregister_tracker(this);
 }
 
-tracker::tracker(jlm::rvsdg::graph * graph, size_t nstates)
-    : graph_(graph),
+tracker::tracker(jlm::rvsdg::region * region, size_t nstates)
+    : region_(region),
       states_(nstates)
 {
   for (size_t n = 0; n < states_.size(); n++)
-    states_[n] = std::make_unique<tracker_depth_state>();
+    states_[n] = std::make_unique<tracker_depth_state>(nodestates_);
 
+  auto & notifiers = region->GetNotifiers();
   depth_callback_ =
-      on_node_depth_change.connect(std::bind(&tracker::node_depth_change, this, _1, _2));
-  destroy_callback_ = on_node_destroy.connect(std::bind(&tracker::node_destroy, this, _1));
+      notifiers.on_node_depth_change.connect(std::bind(&tracker::node_depth_change, this, _1, _2));
+  destroy_callback_ =
+      notifiers.on_node_destroy.connect(std::bind(&tracker::node_destroy, this, _1));
 
   register_tracker(this);
 }
 
+jlm::rvsdg::graph *
+tracker::graph() const noexcept
+{
+  return region_->graph();
+}
+
 void
 tracker::node_depth_change(jlm::rvsdg::node * node, size_t old_depth)
 {
-  auto nstate = nodestate(node);
-  if (nstate->state() < states_.size())
+  if (!nodestates_.Contains(*node))
+    return;
+
+  auto state = nodestates_.Lookup(*node).state;
+  if (state < states_.size())
   {
-    states_[nstate->state()]->remove(nstate, old_depth);
-    states_[nstate->state()]->add(nstate, node->depth());
+    states_[state]->remove(node, old_depth);
+    states_[state]->add(node, node->depth());
   }
 }
 
 void
 tracker::node_destroy(jlm::rvsdg::node * node)
 {
-  auto nstate = nodestate(node);
-  if (nstate->state() < states_.size())
-    states_[nstate->state()]->remove(nstate, node->depth());
+  if (!nodestates_.Contains(*node))
+    return;
 
-  nodestates_.erase(node);
+  auto state = nodestates_.Lookup(*node).state;
+  if (state < states_.size())
+    states_[state]->remove(node, node->depth());
+
+  nodestates_.Remove(*node);
 }
 
 ssize_t
 tracker::get_nodestate(jlm::rvsdg::node * node)
 {
-  return nodestate(node)->state();
+  return nodestates_.Contains(*node) ? nodestates_.Lookup(*node).state : tracker_nodestate_none;
 }
 
 void
 tracker::set_nodestate(jlm::rvsdg::node * node, size_t state)
 {
-  auto nstate = nodestate(node);
-  if (nstate->state() != state)
+  auto & nstate = nodestates_[*node];
+  if (nstate.state != state)
   {
-    if (nstate->state() < states_.size())
-      states_[nstate->state()]->remove(nstate, node->depth());
+    if (nstate.state < states_.size())
+      states_[nstate.state]->remove(node, node->depth());
 
-    nstate->state_ = state;
-    if (nstate->state() < states_.size())
-      states_[nstate->state()]->add(nstate, node->depth());
+    nstate.state = state;
+    if (nstate.state < states_.size())
+      states_[nstate.state]->add(node, node->depth());
   }
 }
 
 jlm::rvsdg::node *
-tracker::peek_top(size_t state) const
+tracker::peek_top(size_t state)
 {
   JLM_ASSERT(state < states_.size());
 
-  auto nodestate = states_[state]->pop_top();
-  if (nodestate)
-  {
-    nodestate->state_ = tracker_nodestate_none;
-    return nodestate->node();
-  }
+  auto node = states_[state]->pop_top();
+  if (node)
+    nodestates_.Lookup(*node).state = tracker_nodestate_none;
 
-  return nullptr;
+  return node;
 }
 
 jlm::rvsdg::node *
-tracker::peek_bottom(size_t state) const
+tracker::peek_bottom(size_t state)
 {
   JLM_ASSERT(state < states_.size());
 
-  auto nodestate = states_[state]->pop_bottom();
-  if (nodestate)
-  {
-    nodestate->state_ = tracker_nodestate_none;
-    return nodestate->node();
-  }
-
-  return nullptr;
-}
-
-jlm::rvsdg::tracker_nodestate *
-tracker::nodestate(jlm::rvsdg::node * node)
-{
-  auto it = nodestates_.find(node);
-  if (it != nodestates_.end())
-    return it->second.get();
+  auto node = states_[state]->pop_bottom();
+  if (node)
+    nodestates_.Lookup(*node).state = tracker_nodestate_none;
 
-  nodestates_[node] = std::make_unique<jlm::rvsdg::tracker_nodestate>(node);
-  return nodestates_[node].get();
+  return node;
 }
 
 }
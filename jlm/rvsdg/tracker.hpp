@@ -10,8 +10,10 @@
 #include <stdbool.h>
 #include <stddef.h>
 
-#include <unordered_map>
+#include <memory>
+#include <vector>
 
+#include <jlm/rvsdg/NodeSideTable.hpp>
 #include <jlm/util/callbacks.hpp>
 
 namespace jlm::rvsdg
@@ -23,12 +25,11 @@ class graph;
 class node;
 class region;
 class tracker_depth_state;
-class tracker_nodestate;
 
 bool
 has_active_trackers(const jlm::rvsdg::graph * graph);
 
-/* Track states of nodes within the graph. Each node can logically be in
+/* Track states of nodes within a region. Each node can logically be in
  * one of the numbered states, plus another "initial" state. All nodes are
  * at the beginning assumed to be implicitly in this "initial" state. */
 struct tracker
@@ -36,7 +37,7 @@ struct tracker
 public:
   ~tracker() noexcept;
 
-  tracker(jlm::rvsdg::graph * graph, size_t nstates);
+  tracker(jlm::rvsdg::region * region, size_t nstates);
 
   /* get state of the node */
   ssize_t
@@ -48,21 +49,34 @@ public:
 
   /* get one of the top nodes for the given state */
   jlm::rvsdg::node *
-  peek_top(size_t state) const;
+  peek_top(size_t state);
 
   /* get one of the bottom nodes for the given state */
   jlm::rvsdg::node *
-  peek_bottom(size_t state) const;
+  peek_bottom(size_t state);
 
-  inline jlm::rvsdg::graph *
-  graph() const noexcept
+  jlm::rvsdg::graph *
+  graph() const noexcept;
+
+  inline jlm::rvsdg::region *
+  region() const noexcept
   {
-    return graph_;
+    return region_;
   }
 
 private:
-  jlm::rvsdg::tracker_nodestate *
-  nodestate(jlm::rvsdg::node * node);
+  friend tracker_depth_state;
+
+  /**
+   * The state of a node. Nodes with the same state and depth are linked into a list, which
+   * permits to add and remove them from their depth state without any allocations.
+   */
+  struct nodestate
+  {
+    size_t state = tracker_nodestate_none;
+    jlm::rvsdg::node * prev = nullptr;
+    jlm::rvsdg::node * next = nullptr;
+  };
 
   void
   node_depth_change(jlm::rvsdg::node * node, size_t old_depth);
@@ -70,52 +84,14 @@ private:
   void
   node_destroy(jlm::rvsdg::node * node);
 
-  jlm::rvsdg::graph * graph_;
+  jlm::rvsdg::region * region_;
 
   /* FIXME: need RAII idiom for state reservation */
   std::vector<std::unique_ptr<tracker_depth_state>> states_;
 
   jlm::util::callback depth_callback_, destroy_callback_;
 
-  std::unordered_map<jlm::rvsdg::node *, std::unique_ptr<jlm::rvsdg::tracker_nodestate>>
-      nodestates_;
-};
-
-class tracker_nodestate
-{
-  friend tracker;
-
-public:
-  inline tracker_nodestate(jlm::rvsdg::node * node)
-      : state_(tracker_nodestate_none),
-        node_(node)
-  {}
-
-  tracker_nodestate(const tracker_nodestate &) = delete;
-
-  tracker_nodestate(tracker_nodestate &&) = delete;
-
-  tracker_nodestate &
-  operator=(const tracker_nodestate &) = delete;
-
-  tracker_nodestate &
-  operator=(tracker_nodestate &&) = delete;
-
-  inline jlm::rvsdg::node *
-  node() const noexcept
-  {
-    return node_;
-  }
-
-  inline size_t
-  state() const noexcept
-  {
-    return state_;
-  }
-
-private:
-  size_t state_;
-  jlm::rvsdg::node * node_;
+  NodeSideTable<nodestate> nodestates_;
 };
 
 }
@@ -20,7 +20,7 @@ topdown_traverser::~topdown_traverser() noexcept
 
 topdown_traverser::topdown_traverser(jlm::rvsdg::region * region)
     : region_(region),
-      tracker_(region->graph())
+      tracker_(region)
 {
   for (auto & node : region->top_nodes)
     tracker_.set_nodestate(&node, traversal_nodestate::frontier);
@@ -41,10 +41,11 @@ topdown_traverser::topdown_traverser(jlm::rvsdg::region * region)
     }
   }
 
+  auto & notifiers = region->GetNotifiers();
   callbacks_.push_back(
-      on_node_create.connect(std::bind(&topdown_traverser::node_create, this, _1)));
-  callbacks_.push_back(
-      on_input_change.connect(std::bind(&topdown_traverser::input_change, this, _1, _2, _3)));
+      notifiers.on_node_create.connect(std::bind(&topdown_traverser::node_create, this, _1)));
+  callbacks_.push_back(notifiers.on_input_change.connect(
+      std::bind(&topdown_traverser::input_change, this, _1, _2, _3)));
 }
 
 bool
@@ -125,7 +126,7 @@ bottomup_traverser::~bottomup_traverser() noexcept
 
 bottomup_traverser::bottomup_traverser(jlm::rvsdg::region * region, bool revisit)
     : region_(region),
-      tracker_(region->graph()),
+      tracker_(region),
       new_node_state_(revisit ? traversal_nodestate::frontier : traversal_nodestate::behind)
 {
   for (auto & node : region->bottom_nodes)
@@ -138,12 +139,13 @@ bottomup_traverser::bottomup_traverser(jlm::rvsdg::region * region, bool revisit
       tracker_.set_nodestate(node, traversal_nodestate::frontier);
   }
 
+  auto & notifiers = region->GetNotifiers();
   callbacks_.push_back(
-      on_node_create.connect(std::bind(&bottomup_traverser::node_create, this, _1)));
-  callbacks_.push_back(
-      on_node_destroy.connect(std::bind(&bottomup_traverser::node_destroy, this, _1)));
+      notifiers.on_node_create.connect(std::bind(&bottomup_traverser::node_create, this, _1)));
   callbacks_.push_back(
-      on_input_change.connect(std::bind(&bottomup_traverser::input_change, this, _1, _2, _3)));
+      notifiers.on_node_destroy.connect(std::bind(&bottomup_traverser::node_destroy, this, _1)));
+  callbacks_.push_back(notifiers.on_input_change.connect(
+      std::bind(&bottomup_traverser::input_change, this, _1, _2, _3)));
 }
 
 jlm::rvsdg::node *
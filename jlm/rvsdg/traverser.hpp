@@ -86,7 +86,7 @@ enum class traversal_nodestate
 class traversal_tracker final
 {
 public:
-  inline traversal_tracker(jlm::rvsdg::graph * graph);
+  inline traversal_tracker(jlm::rvsdg::region * region);
 
   inline traversal_nodestate
   get_nodestate(jlm::rvsdg::node * node);
@@ -231,8 +231,8 @@ private:
 
 /* traversal tracker implementation */
 
-traversal_tracker::traversal_tracker(jlm::rvsdg::graph * graph)
-    : tracker_(graph, 2)
+traversal_tracker::traversal_tracker(jlm::rvsdg::region * region)
+    : tracker_(region, 2)
 {}
 
 traversal_nodestate
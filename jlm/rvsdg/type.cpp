@@ -6,12 +6,117 @@
 
 #include <jlm/rvsdg/type.hpp>
 
+#include <algorithm>
+#include <mutex>
+#include <typeinfo>
+#include <unordered_map>
+
 namespace jlm::rvsdg
 {
 
+/**
+ * Process-wide table of interned types.
+ *
+ * The table only holds weak references to the interned types, such that a type is released
+ * together with the last port referencing it. Expired entries are removed whenever they are
+ * encountered during a lookup, and all remaining ones are swept once the table doubled in size
+ * since the last sweep.
+ */
+class TypeInterningTable final
+{
+public:
+  std::shared_ptr<const type>
+  Intern(const type & candidate, std::unique_ptr<type> ownedCandidate)
+  {
+    auto hash = candidate.hash();
+
+    std::lock_guard<std::mutex> guard(Mutex_);
+
+    auto range = Types_.equal_range(hash);
+    for (auto it = range.first; it != range.second;)
+    {
+      if (auto internedType = it->second.lock())
+      {
+        if (*internedType == candidate)
+          return internedType;
+
+        it++;
+      }
+      else
+      {
+        it = Types_.erase(it);
+      }
+    }
+
+    std::shared_ptr<const type> internedType;
+    if (ownedCandidate)
+      internedType = std::move(ownedCandidate);
+    else
+      internedType = candidate.copy();
+
+    Types_.emplace(hash, internedType);
+    if (Types_.size() > 2 * SweepSize_)
+      Sweep();
+
+    return internedType;
+  }
+
+  static TypeInterningTable &
+  Instance()
+  {
+    static TypeInterningTable table;
+    return table;
+  }
+
+private:
+  TypeInterningTable()
+      : SweepSize_(64)
+  {}
+
+  void
+  Sweep()
+  {
+    for (auto it = Types_.begin(); it != Types_.end();)
+    {
+      if (it->second.expired())
+        it = Types_.erase(it);
+      else
+        it++;
+    }
+
+    SweepSize_ = std::max(Types_.size(), size_t(64));
+  }
+
+  std::mutex Mutex_;
+  size_t SweepSize_;
+  std::unordered_multimap<size_t, std::weak_ptr<const type>> Types_;
+};
+
 type::~type() noexcept
 {}
 
+size_t
+type::hash() const noexcept
+{
+  return typeid(*this).hash_code();
+}
+
+std::shared_ptr<const jlm::rvsdg::type>
+type::Intern(const jlm::rvsdg::type & type)
+{
+  if (auto internedType = type.weak_from_this().lock())
+    return internedType;
+
+  return TypeInterningTable::Instance().Intern(type, nullptr);
+}
+
+std::shared_ptr<const jlm::rvsdg::type>
+type::Intern(std::unique_ptr<jlm::rvsdg::type> type)
+{
+  auto & candidate = *type;
+  return TypeInterningTable::Instance().Intern(candidate, std::move(type));
+}
+
 valuetype::~valuetype() noexcept
 {}
 
@@ -13,7 +13,13 @@
 namespace jlm::rvsdg
 {
 
-class type
+/**
+ * Base class of all types.
+ *
+ * Types are only owned by shared pointers once they were interned, which allows an interned type
+ * to be recognized, and returned by Intern() without consulting the interning table.
+ */
+class type : public std::enable_shared_from_this<type>
 {
 public:
   virtual ~type() noexcept;
@@ -29,7 +35,7 @@ public:
   inline bool
   operator!=(const jlm::rvsdg::type & other) const noexcept
   {
-    return !(*this == other);
+    return this != &other && !(*this == other);
   }
 
   virtual std::unique_ptr<type>
@@ -37,6 +43,43 @@ public:
 
   virtual std::string
   debug_string() const = 0;
+
+  /**
+   * Computes a hash value of the type.
+   *
+   * The hash value must be consistent with operator==(), i.e., two types that compare equal must
+   * have the same hash value. The default implementation hashes the dynamic type of the type.
+   * Parameterized types, such as bitstrings of a certain width, should override this method to
+   * include their parameters.
+   *
+   * @return The hash value of the type.
+   */
+  [[nodiscard]] virtual size_t
+  hash() const noexcept;
+
+  /**
+   * Returns a shared, immutable instance of a type that is equal to \p type.
+   *
+   * Interned types are kept in a process-wide table. Interning equal types yields the same
+   * instance, such that ports of equal types share a single type object and their equality can be
+   * determined by pointer comparison. The table is thread-safe, and an interned type is released
+   * once the last reference to it is dropped. Interning a type that is already interned, such as
+   * the type of another port, returns it without locking the table.
+   *
+   * @param type The type to intern.
+   * @return The interned instance.
+   */
+  static std::shared_ptr<const jlm::rvsdg::type>
+  Intern(const jlm::rvsdg::type & type);
+
+  /**
+   * \copydoc Intern(const jlm::rvsdg::type&)
+   *
+   * Takes ownership of \p type, and uses it as interned instance if no equal type was interned
+   * before.
+   */
+  static std::shared_ptr<const jlm::rvsdg::type>
+  Intern(std::unique_ptr<jlm::rvsdg::type> type);
 };
 
 class valuetype : public jlm::rvsdg::type
@@ -295,12 +295,55 @@ JlmOptCommand::ToString() const
   std::string statisticsDirArgument =
       "-s " + CommandLineOptions_.GetStatisticsCollectorSettings().GetFilePath().path() + " ";
 
+  auto numJobsArgument = CommandLineOptions_.GetNumJobs() > 1
+                           ? "--jobs=" + std::to_string(CommandLineOptions_.GetNumJobs()) + " "
+                           : "";
+
+  std::string inliningArguments;
+  auto & inliningSettings = CommandLineOptions_.GetInliningSettings();
+  if (inliningSettings != llvm::InliningSettings())
+  {
+    inliningArguments = util::strfmt(
+        "--inline-threshold=",
+        inliningSettings.GetThreshold(),
+        " --inline-loop-bonus=",
+        inliningSettings.GetLoopBonus(),
+        " --inline-constant-argument-bonus=",
+        inliningSettings.GetConstantArgumentBonus(),
+        " ");
+  }
+
+  std::string unrollArguments;
+  auto & unrollSettings = CommandLineOptions_.GetUnrollSettings();
+  if (unrollSettings != llvm::UnrollSettings())
+  {
+    unrollArguments = util::strfmt(
+        "--unroll-factor=",
+        unrollSettings.GetFactor(),
+        " --unroll-full-threshold=",
+        unrollSettings.GetFullUnrollThreshold(),
+        " --unroll-max-size=",
+        unrollSettings.GetMaxUnrolledSize(),
+        " ");
+    if (!(unrollSettings.GetProfileFile() == ""))
+      unrollArguments += "--unroll-profile=" + unrollSettings.GetProfileFile().to_str() + " ";
+  }
+
+  std::string coarseningBudgetArgument;
+  auto & coarseningBudget = CommandLineOptions_.GetMemoryNodeCoarseningBudget();
+  if (coarseningBudget.has_value())
+    coarseningBudgetArgument = util::strfmt("--aa-coarsening-budget=", *coarseningBudget, " ");
+
   return util::strfmt(
       ProgramName_ + " ",
       outputFormatArgument,
       optimizationArguments,
       statisticsDirArgument,
       statisticsArguments,
+      numJobsArgument,
+      inliningArguments,
+      unrollArguments,
+      coarseningBudgetArgument,
       outputFileArgument,
       CommandLineOptions_.GetInputFile().to_str());
 }
@@ -327,7 +370,8 @@ JlmOptCommand::Run() const
   llvm::OptimizationSequence::CreateAndRun(
       *rvsdgModule,
       statisticsCollector,
-      CommandLineOptions_.GetOptimizations());
+      CommandLineOptions_.GetOptimizations(),
+      CommandLineOptions_.GetNumJobs());
 
   PrintRvsdgModule(
       *rvsdgModule,
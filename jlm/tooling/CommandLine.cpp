@@ -92,6 +92,36 @@ JlmOptCommandLineOptions::Reset() noexcept
   OutputFormat_ = OutputFormat::Llvm;
   StatisticsCollectorSettings_ = util::StatisticsCollectorSettings();
   OptimizationIds_.clear();
+  NumJobs_ = 1;
+  InliningSettings_ = llvm::InliningSettings();
+  UnrollSettings_ = llvm::UnrollSettings();
+  MemoryNodeCoarseningBudget_ = std::nullopt;
+  CreateConfiguredOptimizations();
+}
+
+void
+JlmOptCommandLineOptions::CreateConfiguredOptimizations()
+{
+  auto functionInlining = std::make_shared<llvm::fctinline>(InliningSettings_);
+  auto loopUnrolling = std::make_shared<llvm::loopunroll>(UnrollSettings_);
+
+  auto & budget = MemoryNodeCoarseningBudget_;
+
+  ConfiguredOptimizations_ = {
+    { OptimizationId::AAAndersenAgnostic, std::make_shared<llvm::aa::AndersenAgnostic>(budget) },
+    { OptimizationId::AAAndersenRegionAware,
+      std::make_shared<llvm::aa::AndersenRegionAware>(NumJobs_, budget) },
+    { OptimizationId::AASteensgaardAgnostic,
+      std::make_shared<llvm::aa::SteensgaardAgnostic>(budget) },
+    { OptimizationId::AASteensgaardFieldSensitiveRegionAware,
+      std::make_shared<llvm::aa::SteensgaardFieldSensitiveRegionAware>(NumJobs_, budget) },
+    { OptimizationId::AASteensgaardRegionAware,
+      std::make_shared<llvm::aa::SteensgaardRegionAware>(NumJobs_, budget) },
+    { OptimizationId::FunctionInlining, functionInlining },
+    { OptimizationId::iln, functionInlining },
+    { OptimizationId::LoopUnrolling, loopUnrolling },
+    { OptimizationId::url, loopUnrolling },
+  };
 }
 
 std::vector<llvm::optimization *>
@@ -102,7 +132,11 @@ JlmOptCommandLineOptions::GetOptimizations() const noexcept
 
   for (auto & optimizationId : OptimizationIds_)
   {
-    optimizations.emplace_back(GetOptimization(optimizationId));
+    auto it = ConfiguredOptimizations_.find(optimizationId);
+    if (it != ConfiguredOptimizations_.end())
+      optimizations.emplace_back(it->second.get());
+    else
+      optimizations.emplace_back(GetOptimization(optimizationId));
   }
 
   return optimizations;
@@ -113,8 +147,14 @@ JlmOptCommandLineOptions::FromCommandLineArgumentToOptimizationId(
     const std::string & commandLineArgument)
 {
   static std::unordered_map<std::string, OptimizationId> map(
-      { { OptimizationCommandLineArgument::AaSteensgaardAgnostic_,
+      { { OptimizationCommandLineArgument::AaAndersenAgnostic_,
+          OptimizationId::AAAndersenAgnostic },
+        { OptimizationCommandLineArgument::AaAndersenRegionAware_,
+          OptimizationId::AAAndersenRegionAware },
+        { OptimizationCommandLineArgument::AaSteensgaardAgnostic_,
           OptimizationId::AASteensgaardAgnostic },
+        { OptimizationCommandLineArgument::AaSteensgaardFieldSensitiveRegionAware_,
+          OptimizationId::AASteensgaardFieldSensitiveRegionAware },
         { OptimizationCommandLineArgument::AaSteensgaardRegionAware_,
           OptimizationId::AASteensgaardRegionAware },
         { OptimizationCommandLineArgument::CommonNodeElimination_,
@@ -149,8 +189,14 @@ const char *
 JlmOptCommandLineOptions::ToCommandLineArgument(OptimizationId optimizationId)
 {
   static std::unordered_map<OptimizationId, const char *> map(
-      { { OptimizationId::AASteensgaardAgnostic,
+      { { OptimizationId::AAAndersenAgnostic,
+          OptimizationCommandLineArgument::AaAndersenAgnostic_ },
+        { OptimizationId::AAAndersenRegionAware,
+          OptimizationCommandLineArgument::AaAndersenRegionAware_ },
+        { OptimizationId::AASteensgaardAgnostic,
           OptimizationCommandLineArgument::AaSteensgaardAgnostic_ },
+        { OptimizationId::AASteensgaardFieldSensitiveRegionAware,
+          OptimizationCommandLineArgument::AaSteensgaardFieldSensitiveRegionAware_ },
         { OptimizationId::AASteensgaardRegionAware,
           OptimizationCommandLineArgument::AaSteensgaardRegionAware_ },
         { OptimizationId::cne, OptimizationCommandLineArgument::CommonNodeEliminationDeprecated_ },
@@ -187,6 +233,8 @@ JlmOptCommandLineOptions::FromCommandLineArgumentToStatisticsId(
 {
   static std::unordered_map<std::string, util::Statistics::Id> map(
       { { StatisticsCommandLineArgument::Aggregation_, util::Statistics::Id::Aggregation },
+        { StatisticsCommandLineArgument::AndersenAnalysis_,
+          util::Statistics::Id::AndersenAnalysis },
         { StatisticsCommandLineArgument::BasicEncoderEncoding_,
           util::Statistics::Id::BasicEncoderEncoding },
         { StatisticsCommandLineArgument::Annotation_, util::Statistics::Id::Annotation },
@@ -231,6 +279,8 @@ JlmOptCommandLineOptions::ToCommandLineArgument(jlm::util::Statistics::Id statis
 {
   static std::unordered_map<util::Statistics::Id, const char *> map(
       { { util::Statistics::Id::Aggregation, StatisticsCommandLineArgument::Aggregation_ },
+        { util::Statistics::Id::AndersenAnalysis,
+          StatisticsCommandLineArgument::AndersenAnalysis_ },
         { util::Statistics::Id::BasicEncoderEncoding,
           StatisticsCommandLineArgument::BasicEncoderEncoding_ },
         { util::Statistics::Id::Annotation, StatisticsCommandLineArgument::Annotation_ },
@@ -285,7 +335,10 @@ JlmOptCommandLineOptions::ToCommandLineArgument(OutputFormat outputFormat)
 llvm::optimization *
 JlmOptCommandLineOptions::GetOptimization(enum OptimizationId id)
 {
+  static llvm::aa::AndersenAgnostic andersenAgnostic;
+  static llvm::aa::AndersenRegionAware andersenRegionAware;
   static llvm::aa::SteensgaardAgnostic steensgaardAgnostic;
+  static llvm::aa::SteensgaardFieldSensitiveRegionAware steensgaardFieldSensitiveRegionAware;
   static llvm::aa::SteensgaardRegionAware steensgaardRegionAware;
   static llvm::cne commonNodeElimination;
   static llvm::DeadNodeElimination deadNodeElimination;
@@ -294,11 +347,15 @@ JlmOptCommandLineOptions::GetOptimization(enum OptimizationId id)
   static llvm::pullin nodePullIn;
   static llvm::pushout nodePushOut;
   static llvm::tginversion thetaGammaInversion;
-  static llvm::loopunroll loopUnrolling(4);
+  static llvm::loopunroll loopUnrolling((llvm::UnrollSettings()));
   static llvm::nodereduction nodeReduction;
 
   static std::unordered_map<OptimizationId, llvm::optimization *> map(
-      { { OptimizationId::AASteensgaardAgnostic, &steensgaardAgnostic },
+      { { OptimizationId::AAAndersenAgnostic, &andersenAgnostic },
+        { OptimizationId::AAAndersenRegionAware, &andersenRegionAware },
+        { OptimizationId::AASteensgaardAgnostic, &steensgaardAgnostic },
+        { OptimizationId::AASteensgaardFieldSensitiveRegionAware,
+          &steensgaardFieldSensitiveRegionAware },
         { OptimizationId::AASteensgaardRegionAware, &steensgaardRegionAware },
         { OptimizationId::cne, &commonNodeElimination },
         { OptimizationId::CommonNodeElimination, &commonNodeElimination },
@@ -512,6 +569,7 @@ JlcCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
       cl::value_desc("value"));
 
   auto aggregationStatisticsId = util::Statistics::Id::Aggregation;
+  auto andersenAnalysisStatisticsId = util::Statistics::Id::AndersenAnalysis;
   auto annotationStatisticsId = util::Statistics::Id::Annotation;
   auto basicEncoderEncodingStatisticsId = util::Statistics::Id::BasicEncoderEncoding;
   auto commonNodeEliminationStatisticsId = util::Statistics::Id::CommonNodeElimination;
@@ -539,6 +597,10 @@ JlcCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
               aggregationStatisticsId,
               JlmOptCommandLineOptions::ToCommandLineArgument(aggregationStatisticsId),
               "Collect control flow graph aggregation pass statistics."),
+          ::clEnumValN(
+              andersenAnalysisStatisticsId,
+              JlmOptCommandLineOptions::ToCommandLineArgument(andersenAnalysisStatisticsId),
+              "Collect Andersen alias analysis pass statistics."),
           ::clEnumValN(
               annotationStatisticsId,
               JlmOptCommandLineOptions::ToCommandLineArgument(annotationStatisticsId),
@@ -765,7 +827,61 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
       cl::desc(statisticDirectoryDescription),
       cl::value_desc("dir"));
 
+  cl::opt<size_t> numJobs(
+      "jobs",
+      cl::init(1),
+      cl::desc("Number of threads used for function-local optimizations"),
+      cl::value_desc("N"));
+
+  cl::opt<size_t> inlineThreshold(
+      "inline-threshold",
+      cl::init(llvm::InliningSettings::DefaultThreshold),
+      cl::desc("Maximal number of nodes of an inlined function"),
+      cl::value_desc("N"));
+
+  cl::opt<size_t> inlineLoopBonus(
+      "inline-loop-bonus",
+      cl::init(llvm::InliningSettings::DefaultLoopBonus),
+      cl::desc("Increase of the inline threshold for every loop around a call"),
+      cl::value_desc("N"));
+
+  cl::opt<size_t> inlineConstantArgumentBonus(
+      "inline-constant-argument-bonus",
+      cl::init(llvm::InliningSettings::DefaultConstantArgumentBonus),
+      cl::desc("Increase of the inline threshold for every constant argument of a call"),
+      cl::value_desc("N"));
+
+  cl::opt<size_t> unrollFactor(
+      "unroll-factor",
+      cl::init(llvm::UnrollSettings::DefaultFactor),
+      cl::desc("Factor by which loops are unrolled"),
+      cl::value_desc("N"));
+
+  cl::opt<size_t> unrollFullThreshold(
+      "unroll-full-threshold",
+      cl::init(llvm::UnrollSettings::DefaultFullUnrollThreshold),
+      cl::desc("Maximal number of iterations of a completely unrolled loop"),
+      cl::value_desc("N"));
+
+  cl::opt<size_t> unrollMaxSize(
+      "unroll-max-size",
+      cl::init(llvm::UnrollSettings::DefaultMaxUnrolledSize),
+      cl::desc("Maximal number of nodes of an unrolled loop body"),
+      cl::value_desc("N"));
+
+  cl::opt<std::string> unrollProfile(
+      "unroll-profile",
+      cl::init(""),
+      cl::desc("Profile file with the iteration counts of loops"),
+      cl::value_desc("file"));
+
+  cl::opt<size_t> memoryNodeCoarseningBudget(
+      "aa-coarsening-budget",
+      cl::desc("Coarsen the memory nodes of functions that reference more than N memory nodes"),
+      cl::value_desc("N"));
+
   auto aggregationStatisticsId = util::Statistics::Id::Aggregation;
+  auto andersenAnalysisStatisticsId = util::Statistics::Id::AndersenAnalysis;
   auto annotationStatisticsId = util::Statistics::Id::Annotation;
   auto basicEncoderEncodingStatisticsId = util::Statistics::Id::BasicEncoderEncoding;
   auto commonNodeEliminationStatisticsId = util::Statistics::Id::CommonNodeElimination;
@@ -792,6 +908,10 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
               aggregationStatisticsId,
               JlmOptCommandLineOptions::ToCommandLineArgument(aggregationStatisticsId),
               "Write aggregation statistics to file."),
+          ::clEnumValN(
+              andersenAnalysisStatisticsId,
+              JlmOptCommandLineOptions::ToCommandLineArgument(andersenAnalysisStatisticsId),
+              "Write Andersen analysis statistics to file."),
           ::clEnumValN(
               annotationStatisticsId,
               JlmOptCommandLineOptions::ToCommandLineArgument(annotationStatisticsId),
@@ -887,7 +1007,11 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
       cl::init(llvmOutputFormat),
       cl::desc("Select output format"));
 
+  auto aAAndersenAgnostic = JlmOptCommandLineOptions::OptimizationId::AAAndersenAgnostic;
+  auto aAAndersenRegionAware = JlmOptCommandLineOptions::OptimizationId::AAAndersenRegionAware;
   auto aASteensgaardAgnostic = JlmOptCommandLineOptions::OptimizationId::AASteensgaardAgnostic;
+  auto aASteensgaardFieldSensitiveRegionAware =
+      JlmOptCommandLineOptions::OptimizationId::AASteensgaardFieldSensitiveRegionAware;
   auto aASteensgaardRegionAware =
       JlmOptCommandLineOptions::OptimizationId::AASteensgaardRegionAware;
   auto commonNodeElimination = JlmOptCommandLineOptions::OptimizationId::CommonNodeElimination;
@@ -911,10 +1035,23 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
 
   cl::list<JlmOptCommandLineOptions::OptimizationId> optimizationIds(
       cl::values(
+          ::clEnumValN(
+              aAAndersenAgnostic,
+              JlmOptCommandLineOptions::ToCommandLineArgument(aAAndersenAgnostic),
+              "Andersen alias analysis with agnostic memory state encoding"),
+          ::clEnumValN(
+              aAAndersenRegionAware,
+              JlmOptCommandLineOptions::ToCommandLineArgument(aAAndersenRegionAware),
+              "Andersen alias analysis with region-aware memory state encoding"),
           ::clEnumValN(
               aASteensgaardAgnostic,
               JlmOptCommandLineOptions::ToCommandLineArgument(aASteensgaardAgnostic),
               "Steensgaard alias analysis with agnostic memory state encoding"),
+          ::clEnumValN(
+              aASteensgaardFieldSensitiveRegionAware,
+              JlmOptCommandLineOptions::ToCommandLineArgument(
+                  aASteensgaardFieldSensitiveRegionAware),
+              "Field-sensitive Steensgaard alias analysis with region-aware memory state encoding"),
           ::clEnumValN(
               aASteensgaardRegionAware,
               JlmOptCommandLineOptions::ToCommandLineArgument(aASteensgaardRegionAware),
@@ -1016,7 +1153,17 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
       outputFile,
       outputFormat,
       std::move(statisticsCollectorSettings),
-      std::move(optimizationIds));
+      std::move(optimizationIds),
+      numJobs,
+      llvm::InliningSettings(inlineThreshold, inlineLoopBonus, inlineConstantArgumentBonus),
+      llvm::UnrollSettings(
+          unrollFactor,
+          unrollFullThreshold,
+          unrollMaxSize,
+          util::filepath(unrollProfile)),
+      memoryNodeCoarseningBudget.getNumOccurrences() > 0
+          ? std::optional<size_t>(memoryNodeCoarseningBudget.getValue())
+          : std::nullopt);
 
   return *CommandLineOptions_;
 }
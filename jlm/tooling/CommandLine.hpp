@@ -6,10 +6,15 @@
 #ifndef JLM_TOOLING_COMMANDLINE_HPP
 #define JLM_TOOLING_COMMANDLINE_HPP
 
+#include <jlm/llvm/opt/inlining.hpp>
 #include <jlm/llvm/opt/optimization.hpp>
+#include <jlm/llvm/opt/unroll.hpp>
 #include <jlm/util/file.hpp>
 #include <jlm/util/Statistics.hpp>
 
+#include <memory>
+#include <optional>
+#include <unordered_map>
 #include <vector>
 
 namespace jlm::tooling
@@ -50,7 +55,10 @@ public:
   {
     FirstEnumValue, // must always be the first enum value, used for iteration
 
+    AAAndersenAgnostic,
+    AAAndersenRegionAware,
     AASteensgaardAgnostic,
+    AASteensgaardFieldSensitiveRegionAware,
     AASteensgaardRegionAware,
 
     /**
@@ -118,13 +126,23 @@ public:
       util::filepath outputFile,
       OutputFormat outputFormat,
       util::StatisticsCollectorSettings statisticsCollectorSettings,
-      std::vector<OptimizationId> optimizations)
+      std::vector<OptimizationId> optimizations,
+      size_t numJobs = 1,
+      llvm::InliningSettings inliningSettings = llvm::InliningSettings(),
+      llvm::UnrollSettings unrollSettings = llvm::UnrollSettings(),
+      std::optional<size_t> memoryNodeCoarseningBudget = std::nullopt)
       : InputFile_(std::move(inputFile)),
         OutputFile_(std::move(outputFile)),
         OutputFormat_(outputFormat),
         StatisticsCollectorSettings_(std::move(statisticsCollectorSettings)),
-        OptimizationIds_(std::move(optimizations))
-  {}
+        OptimizationIds_(std::move(optimizations)),
+        NumJobs_(numJobs),
+        InliningSettings_(inliningSettings),
+        UnrollSettings_(std::move(unrollSettings)),
+        MemoryNodeCoarseningBudget_(memoryNodeCoarseningBudget)
+  {
+    CreateConfiguredOptimizations();
+  }
 
   void
   Reset() noexcept override;
@@ -162,6 +180,43 @@ public:
   [[nodiscard]] std::vector<llvm::optimization *>
   GetOptimizations() const noexcept;
 
+  /**
+   * @return The number of threads used for applying function-local optimizations.
+   */
+  [[nodiscard]] size_t
+  GetNumJobs() const noexcept
+  {
+    return NumJobs_;
+  }
+
+  /**
+   * @return The parameters of the cost model used by function inlining.
+   */
+  [[nodiscard]] const llvm::InliningSettings &
+  GetInliningSettings() const noexcept
+  {
+    return InliningSettings_;
+  }
+
+  /**
+   * @return The parameters of the per-loop unroll decisions of loop unrolling.
+   */
+  [[nodiscard]] const llvm::UnrollSettings &
+  GetUnrollSettings() const noexcept
+  {
+    return UnrollSettings_;
+  }
+
+  /**
+   * @return The budget of the memory node coarsening of the alias analyses. The memory nodes are
+   * not coarsened if no budget is given.
+   */
+  [[nodiscard]] const std::optional<size_t> &
+  GetMemoryNodeCoarseningBudget() const noexcept
+  {
+    return MemoryNodeCoarseningBudget_;
+  }
+
   static OptimizationId
   FromCommandLineArgumentToOptimizationId(const std::string & commandLineArgument);
 
@@ -186,14 +241,22 @@ public:
       util::filepath outputFile,
       OutputFormat outputFormat,
       util::StatisticsCollectorSettings statisticsCollectorSettings,
-      std::vector<OptimizationId> optimizations)
+      std::vector<OptimizationId> optimizations,
+      size_t numJobs = 1,
+      llvm::InliningSettings inliningSettings = llvm::InliningSettings(),
+      llvm::UnrollSettings unrollSettings = llvm::UnrollSettings(),
+      std::optional<size_t> memoryNodeCoarseningBudget = std::nullopt)
   {
     return std::make_unique<JlmOptCommandLineOptions>(
         std::move(inputFile),
         std::move(outputFile),
         outputFormat,
         std::move(statisticsCollectorSettings),
-        std::move(optimizations));
+        std::move(optimizations),
+        numJobs,
+        inliningSettings,
+        std::move(unrollSettings),
+        memoryNodeCoarseningBudget);
   }
 
 private:
@@ -202,10 +265,29 @@ private:
   OutputFormat OutputFormat_;
   util::StatisticsCollectorSettings StatisticsCollectorSettings_;
   std::vector<OptimizationId> OptimizationIds_;
+  size_t NumJobs_;
+  llvm::InliningSettings InliningSettings_;
+  llvm::UnrollSettings UnrollSettings_;
+  std::optional<size_t> MemoryNodeCoarseningBudget_;
+
+  /**
+   * Creates the optimizations that are configured by the options, such as the number of jobs, the
+   * inlining settings, or the memory node coarsening budget. They are owned by the options such
+   * that the function-local statics returned by GetOptimization() are never modified.
+   */
+  void
+  CreateConfiguredOptimizations();
+
+  std::unordered_map<OptimizationId, std::shared_ptr<llvm::optimization>>
+      ConfiguredOptimizations_;
 
   struct OptimizationCommandLineArgument
   {
+    inline static const char * AaAndersenAgnostic_ = "AAAndersenAgnostic";
+    inline static const char * AaAndersenRegionAware_ = "AAAndersenRegionAware";
     inline static const char * AaSteensgaardAgnostic_ = "AASteensgaardAgnostic";
+    inline static const char * AaSteensgaardFieldSensitiveRegionAware_ =
+        "AASteensgaardFieldSensitiveRegionAware";
     inline static const char * AaSteensgaardRegionAware_ = "AASteensgaardRegionAware";
     inline static const char * CommonNodeElimination_ = "CommonNodeElimination";
     inline static const char * CommonNodeEliminationDeprecated_ = "cne";
@@ -229,6 +311,7 @@ private:
   struct StatisticsCommandLineArgument
   {
     inline static const char * Aggregation_ = "print-aggregation-time";
+    inline static const char * AndersenAnalysis_ = "print-andersen-analysis";
     inline static const char * Annotation_ = "print-annotation-time";
     inline static const char * BasicEncoderEncoding_ = "print-basicencoder-encoding";
     inline static const char * CommonNodeElimination_ = "print-cne-stat";
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/util/Arena.hpp>
+
+#include <algorithm>
+
+namespace jlm::util
+{
+
+static_assert(
+    sizeof(Arena *) <= alignof(std::max_align_t),
+    "The arena header must fit into a single alignment unit.");
+
+Arena::~Arena() noexcept = default;
+
+Arena::Arena()
+    : chunkCurrent_(nullptr),
+      chunkEnd_(nullptr),
+      freeLists_({})
+{}
+
+void
+Arena::AllocateChunk()
+{
+  // Invoked by Allocate() with the mutex held.
+  // The remainder of the current chunk is too small for the requested block. Hand it out to the
+  // free lists instead of wasting it.
+  while (static_cast<size_t>(chunkEnd_ - chunkCurrent_) >= Alignment_)
+  {
+    auto size = std::min(static_cast<size_t>(chunkEnd_ - chunkCurrent_), MaxBlockSize_);
+    size -= size % Alignment_;
+
+    auto sizeClass = GetSizeClass(size);
+    auto block = reinterpret_cast<FreeBlock *>(chunkCurrent_);
+    block->next = freeLists_[sizeClass];
+    freeLists_[sizeClass] = block;
+    chunkCurrent_ += size;
+  }
+
+  chunks_.push_back(std::unique_ptr<char[]>(new char[ChunkSize_]));
+  chunkCurrent_ = chunks_.back().get();
+  chunkEnd_ = chunkCurrent_ + ChunkSize_;
+}
+
+void *
+Arena::AllocateObject(Arena * arena, size_t size)
+{
+  auto totalSize = size + Alignment_;
+  auto header = static_cast<char *>(arena ? arena->Allocate(totalSize) : ::operator new(totalSize));
+  *reinterpret_cast<Arena **>(header) = arena;
+
+  return header + Alignment_;
+}
+
+void
+Arena::DeallocateObject(void * p, size_t size) noexcept
+{
+  if (p == nullptr)
+    return;
+
+  auto header = static_cast<char *>(p) - Alignment_;
+  auto arena = *reinterpret_cast<Arena **>(header);
+  if (arena)
+    arena->Deallocate(header, size + Alignment_);
+  else
+    ::operator delete(header);
+}
+
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_UTIL_ARENA_HPP
+#define JLM_UTIL_ARENA_HPP
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace jlm::util
+{
+
+/**
+ * A bump allocator for many small objects of similar lifetime.
+ *
+ * Memory is carved from large chunks. Deallocated blocks are kept in per-size free lists and are
+ * recycled by subsequent allocations of the same size class. All chunks are released in bulk when
+ * the arena is destroyed. Requests larger than the biggest size class are forwarded to the global
+ * heap.
+ *
+ * Allocations and deallocations are thread-safe.
+ */
+class Arena final
+{
+  struct FreeBlock
+  {
+    FreeBlock * next;
+  };
+
+public:
+  ~Arena() noexcept;
+
+  Arena();
+
+  Arena(const Arena &) = delete;
+
+  Arena(Arena &&) = delete;
+
+  Arena &
+  operator=(const Arena &) = delete;
+
+  Arena &
+  operator=(Arena &&) = delete;
+
+  /**
+   * Allocates \p size bytes aligned to alignof(std::max_align_t).
+   */
+  [[nodiscard]] void *
+  Allocate(size_t size)
+  {
+    if (size > MaxBlockSize_)
+      return ::operator new(size);
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto sizeClass = GetSizeClass(size);
+    if (auto block = freeLists_[sizeClass])
+    {
+      freeLists_[sizeClass] = block->next;
+      return block;
+    }
+
+    auto blockSize = (sizeClass + 1) * Alignment_;
+    if (static_cast<size_t>(chunkEnd_ - chunkCurrent_) < blockSize)
+      AllocateChunk();
+
+    auto block = chunkCurrent_;
+    chunkCurrent_ += blockSize;
+    return block;
+  }
+
+  /**
+   * Returns the block \p p of \p size bytes to the arena. \p size must be the same as the one
+   * given to the Allocate() call that returned \p p.
+   */
+  void
+  Deallocate(void * p, size_t size) noexcept
+  {
+    if (size > MaxBlockSize_)
+    {
+      ::operator delete(p);
+      return;
+    }
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto sizeClass = GetSizeClass(size);
+    auto block = static_cast<FreeBlock *>(p);
+    block->next = freeLists_[sizeClass];
+    freeLists_[sizeClass] = block;
+  }
+
+  /**
+   * @return The number of bytes that were reserved from the global heap in chunks.
+   */
+  [[nodiscard]] size_t
+  NumReservedBytes() const noexcept
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return chunks_.size() * ChunkSize_;
+  }
+
+  /**
+   * Allocates \p size bytes for an object from \p arena, or from the global heap if \p arena is
+   * NULL. The arena is recorded in front of the object, such that DeallocateObject() can return
+   * the memory to the right place.
+   */
+  [[nodiscard]] static void *
+  AllocateObject(Arena * arena, size_t size);
+
+  /**
+   * Releases memory obtained from AllocateObject().
+   */
+  static void
+  DeallocateObject(void * p, size_t size) noexcept;
+
+private:
+  static size_t
+  GetSizeClass(size_t size) noexcept
+  {
+    return size == 0 ? 0 : (size - 1) / Alignment_;
+  }
+
+  void
+  AllocateChunk();
+
+  static constexpr size_t Alignment_ = alignof(std::max_align_t);
+  static constexpr size_t MaxBlockSize_ = 512;
+  static constexpr size_t NumSizeClasses_ = MaxBlockSize_ / Alignment_;
+  static constexpr size_t ChunkSize_ = 64 * 1024;
+
+  mutable std::mutex mutex_;
+  char * chunkCurrent_;
+  char * chunkEnd_;
+  std::array<FreeBlock *, NumSizeClasses_> freeLists_;
+  std::vector<std::unique_ptr<char[]>> chunks_;
+};
+
+/**
+ * Base class for objects that can be placed in an Arena. Derived objects are created with
+ * placement syntax, i.e., new (arena) T(...), and are destroyed with an ordinary delete. Objects
+ * created without an arena are allocated from the global heap.
+ */
+class ArenaAllocated
+{
+public:
+  static void *
+  operator new(size_t size)
+  {
+    return Arena::AllocateObject(nullptr, size);
+  }
+
+  static void *
+  operator new(size_t size, Arena & arena)
+  {
+    return Arena::AllocateObject(&arena, size);
+  }
+
+  static void
+  operator delete(void * p, size_t size) noexcept
+  {
+    Arena::DeallocateObject(p, size);
+  }
+
+  static void
+  operator delete(void * p, Arena &) noexcept
+  {
+    // Only invoked if a constructor throws, in which case the size is unknown. The block is
+    // reclaimed when the arena is destroyed.
+    static_cast<void>(p);
+  }
+};
+
+}
+
+#endif
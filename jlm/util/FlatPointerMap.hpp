@@ -0,0 +1,205 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_UTIL_FLATPOINTERMAP_HPP
+#define JLM_UTIL_FLATPOINTERMAP_HPP
+
+#include <jlm/util/common.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace jlm::util
+{
+
+/**
+ * Maps pointers to pointers in a flat open-addressing table.
+ *
+ * The key-value pairs are stored inline in a single power-of-two sized array, and collisions are
+ * resolved by linear probing. The table is kept at most half full, such that lookups typically
+ * touch a single cache line. Null pointers are not valid keys, as they mark empty slots, and
+ * entries cannot be removed individually.
+ *
+ * Clearing the map keeps its capacity, such that a map can be reused for a sequence of similarly
+ * sized mappings without reallocating its table.
+ *
+ * @tparam KeyType The pointee type of the keys.
+ * @tparam ValueType The pointee type of the values.
+ */
+template<typename KeyType, typename ValueType>
+class FlatPointerMap final
+{
+  struct Slot
+  {
+    const KeyType * Key;
+    ValueType * Value;
+  };
+
+public:
+  ~FlatPointerMap() noexcept = default;
+
+  FlatPointerMap()
+      : Size_(0),
+        Shift_(64)
+  {}
+
+  FlatPointerMap(const FlatPointerMap & other) = default;
+
+  FlatPointerMap(FlatPointerMap && other) noexcept
+      : Slots_(std::move(other.Slots_)),
+        Size_(other.Size_),
+        Shift_(other.Shift_)
+  {
+    other.Slots_.clear();
+    other.Size_ = 0;
+    other.Shift_ = 64;
+  }
+
+  FlatPointerMap &
+  operator=(const FlatPointerMap & other) = default;
+
+  FlatPointerMap &
+  operator=(FlatPointerMap && other) noexcept
+  {
+    Slots_ = std::move(other.Slots_);
+    Size_ = other.Size_;
+    Shift_ = other.Shift_;
+    other.Slots_.clear();
+    other.Size_ = 0;
+    other.Shift_ = 64;
+    return *this;
+  }
+
+  /**
+   * @return The number of keys in the map.
+   */
+  [[nodiscard]] size_t
+  Size() const noexcept
+  {
+    return Size_;
+  }
+
+  /**
+   * @return The number of keys the map can hold without growing its table.
+   */
+  [[nodiscard]] size_t
+  Capacity() const noexcept
+  {
+    return Slots_.size() / 2;
+  }
+
+  [[nodiscard]] bool
+  Contains(const KeyType * key) const noexcept
+  {
+    return Lookup(key) != nullptr;
+  }
+
+  /**
+   * @return The value of \p key, or nullptr if the map does not contain \p key.
+   */
+  [[nodiscard]] ValueType *
+  Lookup(const KeyType * key) const noexcept
+  {
+    if (Size_ == 0)
+      return nullptr;
+
+    auto & slot = Slots_[FindSlot(key)];
+    return slot.Key == key ? slot.Value : nullptr;
+  }
+
+  /**
+   * Maps \p key to \p value. An existing value of \p key is replaced.
+   *
+   * @param key The key. Must not be nullptr.
+   * @param value The value.
+   */
+  void
+  Insert(const KeyType * key, ValueType * value)
+  {
+    JLM_ASSERT(key != nullptr);
+    if ((Size_ + 1) * 2 > Slots_.size())
+      Rehash(std::max<size_t>(16, Slots_.size() * 2));
+
+    auto & slot = Slots_[FindSlot(key)];
+    if (slot.Key == nullptr)
+    {
+      slot.Key = key;
+      Size_++;
+    }
+    slot.Value = value;
+  }
+
+  /**
+   * Grows the table such that the map can hold \p size keys without growing it again.
+   */
+  void
+  Reserve(size_t size)
+  {
+    if (size <= Capacity())
+      return;
+
+    size_t numSlots = std::max<size_t>(16, Slots_.size());
+    while (numSlots < size * 2)
+      numSlots *= 2;
+
+    if (numSlots != Slots_.size())
+      Rehash(numSlots);
+  }
+
+  /**
+   * Removes all keys from the map, but keeps its capacity.
+   */
+  void
+  Clear() noexcept
+  {
+    if (Size_ == 0)
+      return;
+
+    std::fill(Slots_.begin(), Slots_.end(), Slot{ nullptr, nullptr });
+    Size_ = 0;
+  }
+
+private:
+  /**
+   * @return The index of the slot that holds \p key, or of the empty slot that would hold it.
+   */
+  size_t
+  FindSlot(const KeyType * key) const noexcept
+  {
+    // Fibonacci hashing spreads the aligned pointers over the table
+    auto hash = reinterpret_cast<uintptr_t>(key) * UINT64_C(0x9E3779B97F4A7C15);
+    auto mask = Slots_.size() - 1;
+    for (size_t index = hash >> Shift_;; index = (index + 1) & mask)
+    {
+      auto & slot = Slots_[index];
+      if (slot.Key == key || slot.Key == nullptr)
+        return index;
+    }
+  }
+
+  void
+  Rehash(size_t numSlots)
+  {
+    auto slots = std::move(Slots_);
+    Slots_.assign(numSlots, Slot{ nullptr, nullptr });
+    Shift_ = 64 - __builtin_ctzll(numSlots);
+
+    for (auto & slot : slots)
+    {
+      if (slot.Key != nullptr)
+        Slots_[FindSlot(slot.Key)] = slot;
+    }
+  }
+
+  std::vector<Slot> Slots_;
+  size_t Size_;
+  // The number of bits the hash is shifted to the right to obtain a slot index
+  size_t Shift_;
+};
+
+}
+
+#endif // JLM_UTIL_FLATPOINTERMAP_HPP
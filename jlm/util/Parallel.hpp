@@ -0,0 +1,69 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_UTIL_PARALLEL_HPP
+#define JLM_UTIL_PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace jlm::util
+{
+
+/**
+ * Invokes \p f for all \p items with up to \p numThreads threads, including the calling thread.
+ * The items are handed out dynamically such that a thread that finished an item immediately
+ * proceeds with the next unprocessed one.
+ *
+ * All items are processed even if \p f throws for some of them. The exception of the first
+ * failing item is rethrown afterwards, which makes the reported error independent of the
+ * scheduling.
+ *
+ * @param items The items to process.
+ * @param numThreads The maximal number of threads.
+ * @param f The function invoked for every item.
+ */
+template<typename T, typename F>
+void
+ParallelForEach(const std::vector<T> & items, size_t numThreads, const F & f)
+{
+  std::atomic<size_t> nextItem(0);
+  std::vector<std::exception_ptr> exceptions(items.size());
+  auto worker = [&]()
+  {
+    for (auto n = nextItem++; n < items.size(); n = nextItem++)
+    {
+      try
+      {
+        f(items[n]);
+      }
+      catch (...)
+      {
+        exceptions[n] = std::current_exception();
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t n = 1; n < std::min(numThreads, items.size()); n++)
+    threads.emplace_back(worker);
+
+  worker();
+  for (auto & thread : threads)
+    thread.join();
+
+  for (auto & exception : exceptions)
+  {
+    if (exception)
+      std::rethrow_exception(exception);
+  }
+}
+
+}
+
+#endif // JLM_UTIL_PARALLEL_HPP
@@ -0,0 +1,501 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_UTIL_SPARSEBITVECTOR_HPP
+#define JLM_UTIL_SPARSEBITVECTOR_HPP
+
+#include <jlm/util/iterator_range.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <vector>
+
+namespace jlm::util
+{
+
+/**
+ * Represents a set of non-negative integers as a sparse bit vector.
+ *
+ * The bits are grouped in fixed-size blocks, and only blocks with at least one bit set are stored.
+ * The blocks are kept sorted by their offset, such that set operations are a linear merge over the
+ * blocks of both operands, and combine the bits of matching blocks word by word. The word loops
+ * have a fixed trip count and are readily vectorized by the compiler.
+ *
+ * The representation is efficient for sets whose items are clustered, e.g., dense indices of
+ * objects that are created together. Items are iterated in ascending order.
+ */
+class SparseBitVector final
+{
+  using Word = uint64_t;
+
+  static constexpr size_t BitsPerWord_ = 64;
+  static constexpr size_t WordsPerBlock_ = 4;
+  static constexpr size_t BitsPerBlock_ = BitsPerWord_ * WordsPerBlock_;
+
+  struct Block
+  {
+    // The index of the first item represented by the block, divided by BitsPerBlock_
+    size_t Offset;
+    std::array<Word, WordsPerBlock_> Words;
+
+    bool
+    operator==(const Block & other) const noexcept
+    {
+      return Offset == other.Offset && Words == other.Words;
+    }
+
+    [[nodiscard]] bool
+    IsEmpty() const noexcept
+    {
+      Word bits = 0;
+      for (size_t w = 0; w < WordsPerBlock_; w++)
+        bits |= Words[w];
+      return bits == 0;
+    }
+
+    [[nodiscard]] size_t
+    Size() const noexcept
+    {
+      size_t size = 0;
+      for (size_t w = 0; w < WordsPerBlock_; w++)
+        size += __builtin_popcountll(Words[w]);
+      return size;
+    }
+  };
+
+public:
+  class ItemConstIterator final
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const size_t *;
+    using reference = const size_t &;
+
+  private:
+    friend SparseBitVector;
+
+    ItemConstIterator(const std::vector<Block> & blocks, size_t block)
+        : Blocks_(&blocks),
+          Block_(block),
+          Word_(0),
+          Bits_(0),
+          Item_(0)
+    {
+      if (Block_ < Blocks_->size())
+      {
+        Bits_ = (*Blocks_)[Block_].Words[0];
+        Advance();
+      }
+    }
+
+  public:
+    const size_t &
+    operator*() const noexcept
+    {
+      return Item_;
+    }
+
+    const size_t *
+    operator->() const noexcept
+    {
+      return &Item_;
+    }
+
+    ItemConstIterator &
+    operator++()
+    {
+      Bits_ &= Bits_ - 1;
+      Advance();
+      return *this;
+    }
+
+    ItemConstIterator
+    operator++(int)
+    {
+      ItemConstIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    bool
+    operator==(const ItemConstIterator & other) const noexcept
+    {
+      return Block_ == other.Block_ && Word_ == other.Word_ && Bits_ == other.Bits_;
+    }
+
+    bool
+    operator!=(const ItemConstIterator & other) const noexcept
+    {
+      return !operator==(other);
+    }
+
+  private:
+    // Moves to the lowest remaining bit, starting at the current word
+    void
+    Advance()
+    {
+      while (Bits_ == 0)
+      {
+        if (++Word_ == WordsPerBlock_)
+        {
+          Word_ = 0;
+          if (++Block_ == Blocks_->size())
+            return;
+        }
+        Bits_ = (*Blocks_)[Block_].Words[Word_];
+      }
+
+      Item_ = (*Blocks_)[Block_].Offset * BitsPerBlock_ + Word_ * BitsPerWord_
+            + __builtin_ctzll(Bits_);
+    }
+
+    const std::vector<Block> * Blocks_;
+    size_t Block_;
+    size_t Word_;
+    Word Bits_;
+    size_t Item_;
+  };
+
+  ~SparseBitVector() noexcept = default;
+
+  SparseBitVector()
+      : Size_(0)
+  {}
+
+  SparseBitVector(std::initializer_list<size_t> initializerList)
+      : Size_(0)
+  {
+    for (auto item : initializerList)
+      Insert(item);
+  }
+
+  SparseBitVector(const SparseBitVector & other) = default;
+
+  SparseBitVector(SparseBitVector && other) noexcept
+      : Blocks_(std::move(other.Blocks_)),
+        Size_(other.Size_)
+  {
+    other.Blocks_.clear();
+    other.Size_ = 0;
+  }
+
+  SparseBitVector &
+  operator=(const SparseBitVector & other) = default;
+
+  SparseBitVector &
+  operator=(SparseBitVector && other) noexcept
+  {
+    Blocks_ = std::move(other.Blocks_);
+    Size_ = other.Size_;
+    other.Blocks_.clear();
+    other.Size_ = 0;
+    return *this;
+  }
+
+  void
+  Clear() noexcept
+  {
+    Blocks_.clear();
+    Size_ = 0;
+  }
+
+  [[nodiscard]] bool
+  Contains(size_t item) const noexcept
+  {
+    auto block = FindBlock(item / BitsPerBlock_);
+    return block != Blocks_.end() && block->Offset == item / BitsPerBlock_
+        && (block->Words[WordIndex(item)] & BitMask(item)) != 0;
+  }
+
+  [[nodiscard]] size_t
+  Size() const noexcept
+  {
+    return Size_;
+  }
+
+  [[nodiscard]] bool
+  IsEmpty() const noexcept
+  {
+    return Size_ == 0;
+  }
+
+  /**
+   * Inserts \p item into the set.
+   *
+   * @return True if \p item was added, false if it was already present.
+   */
+  bool
+  Insert(size_t item)
+  {
+    auto offset = item / BitsPerBlock_;
+    auto block = FindBlock(offset);
+    if (block == Blocks_.end() || block->Offset != offset)
+      block = Blocks_.insert(block, Block{ offset, {} });
+
+    auto & word = block->Words[WordIndex(item)];
+    if (word & BitMask(item))
+      return false;
+
+    word |= BitMask(item);
+    Size_++;
+    return true;
+  }
+
+  /**
+   * Removes \p item from the set.
+   *
+   * @return True if \p item was removed, false if it was not present.
+   */
+  bool
+  Remove(size_t item)
+  {
+    auto offset = item / BitsPerBlock_;
+    auto block = FindBlock(offset);
+    if (block == Blocks_.end() || block->Offset != offset)
+      return false;
+
+    auto & word = block->Words[WordIndex(item)];
+    if (!(word & BitMask(item)))
+      return false;
+
+    word &= ~BitMask(item);
+    Size_--;
+    if (block->IsEmpty())
+      Blocks_.erase(block);
+    return true;
+  }
+
+  /**
+   * @return An iterator_range over the items of the set in ascending order.
+   */
+  [[nodiscard]] iterator_range<ItemConstIterator>
+  Items() const noexcept
+  {
+    return { ItemConstIterator(Blocks_, 0), ItemConstIterator(Blocks_, Blocks_.size()) };
+  }
+
+  /**
+   * Modifies this set to contain all items that are present in itself, \p other, or both.
+   *
+   * @return True if items were added to this set, otherwise false.
+   */
+  bool
+  UnionWith(const SparseBitVector & other)
+  {
+    auto sizeBefore = Size_;
+
+    // Merge in place if no blocks need to be added
+    size_t numMissingBlocks = 0;
+    auto it = Blocks_.begin();
+    for (auto & otherBlock : other.Blocks_)
+    {
+      while (it != Blocks_.end() && it->Offset < otherBlock.Offset)
+        it++;
+
+      if (it == Blocks_.end() || it->Offset != otherBlock.Offset)
+        numMissingBlocks++;
+      else
+        Size_ += MergeInto(*it, otherBlock);
+    }
+
+    if (numMissingBlocks == 0)
+      return Size_ != sizeBefore;
+
+    // Otherwise, create the merged block list from scratch
+    std::vector<Block> blocks;
+    blocks.reserve(Blocks_.size() + numMissingBlocks);
+    it = Blocks_.begin();
+    for (auto & otherBlock : other.Blocks_)
+    {
+      while (it != Blocks_.end() && it->Offset < otherBlock.Offset)
+        blocks.push_back(*it++);
+
+      if (it != Blocks_.end() && it->Offset == otherBlock.Offset)
+      {
+        // The bits of matching blocks were already merged above
+        blocks.push_back(*it++);
+      }
+      else
+      {
+        blocks.push_back(otherBlock);
+        Size_ += otherBlock.Size();
+      }
+    }
+    blocks.insert(blocks.end(), it, Blocks_.end());
+
+    Blocks_ = std::move(blocks);
+    return true;
+  }
+
+  /**
+   * Modifies this set to contain only items that are present in itself and \p other.
+   *
+   * @return True if items were removed from this set, otherwise false.
+   */
+  bool
+  IntersectWith(const SparseBitVector & other)
+  {
+    auto sizeBefore = Size_;
+    Size_ = 0;
+
+    auto otherIt = other.Blocks_.begin();
+    auto end = std::remove_if(
+        Blocks_.begin(),
+        Blocks_.end(),
+        [&](Block & block)
+        {
+          while (otherIt != other.Blocks_.end() && otherIt->Offset < block.Offset)
+            otherIt++;
+
+          if (otherIt == other.Blocks_.end() || otherIt->Offset != block.Offset)
+            return true;
+
+          for (size_t w = 0; w < WordsPerBlock_; w++)
+            block.Words[w] &= otherIt->Words[w];
+
+          Size_ += block.Size();
+          return block.IsEmpty();
+        });
+    Blocks_.erase(end, Blocks_.end());
+
+    return Size_ != sizeBefore;
+  }
+
+  /**
+   * Modifies this set to contain only items that are not present in \p other.
+   *
+   * @return True if items were removed from this set, otherwise false.
+   */
+  bool
+  DifferenceWith(const SparseBitVector & other)
+  {
+    auto sizeBefore = Size_;
+    Size_ = 0;
+
+    auto otherIt = other.Blocks_.begin();
+    auto end = std::remove_if(
+        Blocks_.begin(),
+        Blocks_.end(),
+        [&](Block & block)
+        {
+          while (otherIt != other.Blocks_.end() && otherIt->Offset < block.Offset)
+            otherIt++;
+
+          if (otherIt != other.Blocks_.end() && otherIt->Offset == block.Offset)
+          {
+            for (size_t w = 0; w < WordsPerBlock_; w++)
+              block.Words[w] &= ~otherIt->Words[w];
+          }
+
+          Size_ += block.Size();
+          return block.IsEmpty();
+        });
+    Blocks_.erase(end, Blocks_.end());
+
+    return Size_ != sizeBefore;
+  }
+
+  /**
+   * @return True if all items of this set are also present in \p other.
+   */
+  [[nodiscard]] bool
+  IsSubsetOf(const SparseBitVector & other) const noexcept
+  {
+    if (Size_ > other.Size_)
+      return false;
+
+    auto otherIt = other.Blocks_.begin();
+    for (auto & block : Blocks_)
+    {
+      while (otherIt != other.Blocks_.end() && otherIt->Offset < block.Offset)
+        otherIt++;
+
+      if (otherIt == other.Blocks_.end() || otherIt->Offset != block.Offset)
+        return false;
+
+      Word bits = 0;
+      for (size_t w = 0; w < WordsPerBlock_; w++)
+        bits |= block.Words[w] & ~otherIt->Words[w];
+      if (bits != 0)
+        return false;
+    }
+
+    return true;
+  }
+
+  bool
+  operator==(const SparseBitVector & other) const noexcept
+  {
+    return Size_ == other.Size_ && Blocks_ == other.Blocks_;
+  }
+
+  bool
+  operator!=(const SparseBitVector & other) const noexcept
+  {
+    return !operator==(other);
+  }
+
+private:
+  static size_t
+  WordIndex(size_t item) noexcept
+  {
+    return (item % BitsPerBlock_) / BitsPerWord_;
+  }
+
+  static Word
+  BitMask(size_t item) noexcept
+  {
+    return Word(1) << (item % BitsPerWord_);
+  }
+
+  // Ors the bits of block \p other into \p block, and returns the number of added bits
+  static size_t
+  MergeInto(Block & block, const Block & other) noexcept
+  {
+    auto sizeBefore = block.Size();
+    for (size_t w = 0; w < WordsPerBlock_; w++)
+      block.Words[w] |= other.Words[w];
+    return block.Size() - sizeBefore;
+  }
+
+  // Returns the first block with an offset not less than offset
+  std::vector<Block>::iterator
+  FindBlock(size_t offset) noexcept
+  {
+    return std::lower_bound(
+        Blocks_.begin(),
+        Blocks_.end(),
+        offset,
+        [](const Block & block, size_t offset)
+        {
+          return block.Offset < offset;
+        });
+  }
+
+  std::vector<Block>::const_iterator
+  FindBlock(size_t offset) const noexcept
+  {
+    return std::lower_bound(
+        Blocks_.begin(),
+        Blocks_.end(),
+        offset,
+        [](const Block & block, size_t offset)
+        {
+          return block.Offset < offset;
+        });
+  }
+
+  std::vector<Block> Blocks_;
+  size_t Size_;
+};
+
+}
+
+#endif // JLM_UTIL_SPARSEBITVECTOR_HPP
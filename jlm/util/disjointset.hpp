@@ -396,13 +396,13 @@ public:
     return root1;
   }
 
-private:
   bool
   contains(const T & element) const
   {
     return values_.find(element) != values_.end();
   }
 
+private:
   std::unordered_set<const set *> roots_;
   std::unordered_map<T, std::unique_ptr<set>> values_;
 };
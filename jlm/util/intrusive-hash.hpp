@@ -361,6 +361,22 @@ public:
     }
   }
 
+  /**
+   * Allocates enough buckets for holding \p size elements without rehashing.
+   */
+  void
+  reserve(size_type size)
+  {
+    if (size <= buckets_.size())
+      return;
+
+    size_type numBuckets = std::max(size_type(1), buckets_.size());
+    while (numBuckets < size)
+      numBuckets *= 2;
+
+    rehash(numBuckets);
+  }
+
   inline iterator
   insert(ElementType * element)
   {
@@ -528,9 +544,13 @@ private:
   void
   rehash()
   {
-    std::vector<bucket_type> new_buckets(
-        std::max(typename decltype(buckets_)::size_type(1), buckets_.size() * 2),
-        bucket_type());
+    rehash(std::max(typename decltype(buckets_)::size_type(1), buckets_.size() * 2));
+  }
+
+  void
+  rehash(size_type numBuckets)
+  {
+    std::vector<bucket_type> new_buckets(numBuckets, bucket_type());
     size_t new_mask = new_buckets.size() - 1;
 
     for (bucket_type & old_bucket_type : buckets_)
@@ -3234,4 +3234,117 @@ NAllocaNodesTest::SetupRvsdg()
   return module;
 }
 
+std::unique_ptr<jlm::llvm::RvsdgModule>
+StructFieldTest::SetupRvsdg()
+{
+  using namespace jlm::llvm;
+
+  auto rvsdgModule = RvsdgModule::Create(jlm::util::filepath(""), "", "");
+  auto & rvsdg = rvsdgModule->Rvsdg();
+
+  auto nf = rvsdg.node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  PointerType pointerType;
+  Declaration_ = jlm::rvsdg::rcddeclaration::create();
+  Declaration_->append(pointerType);
+  Declaration_->append(pointerType);
+  auto structType = StructType::Create("pair", false, *Declaration_);
+
+  MemoryStateType memoryStateType;
+  FunctionType functionType({ &memoryStateType }, { &memoryStateType });
+
+  auto lambda = lambda::node::create(rvsdg.root(), functionType, "f", linkage::external_linkage);
+  auto memoryStateArgument = lambda->fctargument(0);
+
+  auto zero = jlm::rvsdg::create_bitconstant(lambda->subregion(), 32, 0);
+  auto one = jlm::rvsdg::create_bitconstant(lambda->subregion(), 32, 1);
+  auto size = jlm::rvsdg::create_bitconstant(lambda->subregion(), 32, 1);
+
+  auto allocaA = alloca_op::create(jlm::rvsdg::bit32, size, 4);
+  auto allocaB = alloca_op::create(jlm::rvsdg::bit32, size, 4);
+  auto allocaP = alloca_op::create(*structType, size, 8);
+  auto mergedMemoryState =
+      MemStateMergeOperator::Create({ allocaA[1], allocaB[1], allocaP[1], memoryStateArgument });
+
+  auto firstAddress =
+      GetElementPtrOperation::Create(allocaP[0], { zero, zero }, *structType, pointerType);
+  auto secondAddress =
+      GetElementPtrOperation::Create(allocaP[0], { zero, one }, *structType, pointerType);
+
+  auto storeFirst = StoreNode::Create(firstAddress, allocaA[0], { mergedMemoryState }, 8);
+  auto storeSecond = StoreNode::Create(secondAddress, allocaB[0], { storeFirst[0] }, 8);
+
+  auto memoryState = storeSecond[0];
+  switch (Access_)
+  {
+  case Access::None:
+    break;
+  case Access::AggregateStore:
+  {
+    ConstantStruct constantStructOperation(*structType);
+    auto constantStruct = jlm::rvsdg::simple_node::create_normalized(
+        lambda->subregion(),
+        constantStructOperation,
+        { allocaB[0], allocaA[0] })[0];
+    memoryState = StoreNode::Create(allocaP[0], constantStruct, { memoryState }, 8)[0];
+    break;
+  }
+  case Access::AggregateLoad:
+  {
+    auto allocaQ = alloca_op::create(*structType, size, 8);
+    auto aggregateLoad = LoadNode::Create(allocaP[0], { memoryState }, *structType, 8);
+    auto storeQ = StoreNode::Create(allocaQ[0], aggregateLoad[0], { aggregateLoad[1] }, 8);
+    memoryState =
+        MemStateMergeOperator::Create(std::vector<jlm::rvsdg::output *>{ storeQ[0], allocaQ[1] });
+    break;
+  }
+  case Access::Memcpy:
+  {
+    auto allocaQ = alloca_op::create(*structType, size, 8);
+    auto length = jlm::rvsdg::create_bitconstant(lambda->subregion(), 64, 16);
+    auto isVolatile = jlm::rvsdg::create_bitconstant(lambda->subregion(), 1, 0);
+    auto memcpy = Memcpy::create(allocaQ[0], allocaP[0], length, isVolatile, { memoryState });
+    memoryState =
+        MemStateMergeOperator::Create(std::vector<jlm::rvsdg::output *>{ memcpy[0], allocaQ[1] });
+    break;
+  }
+  case Access::Theta:
+  {
+    auto theta = jlm::rvsdg::theta_node::create(lambda->subregion());
+    auto i = theta->add_loopvar(firstAddress);
+    auto second = theta->add_loopvar(secondAddress);
+    i->result()->divert_to(second->argument());
+    theta->set_predicate(jlm::rvsdg::control_false(theta->subregion()));
+    memoryState = LoadNode::Create(i, { memoryState }, pointerType, 8)[1];
+    break;
+  }
+  case Access::OverlappingStore:
+  {
+    auto zero128 = jlm::rvsdg::create_bitconstant(lambda->subregion(), 128, 0);
+    memoryState = StoreNode::Create(allocaP[0], zero128, { memoryState }, 8)[0];
+    break;
+  }
+  default:
+    JLM_UNREACHABLE("Unhandled access.");
+  }
+
+  auto load = LoadNode::Create(secondAddress, { memoryState }, pointerType, 8);
+
+  auto lambdaOutput = lambda->finalize({ load[1] });
+  rvsdg.add_export(lambdaOutput, { pointerType, "f" });
+
+  /*
+   * Assign nodes
+   */
+  this->AllocaA_ = jlm::rvsdg::node_output::node(allocaA[0]);
+  this->AllocaB_ = jlm::rvsdg::node_output::node(allocaB[0]);
+  this->AllocaP_ = jlm::rvsdg::node_output::node(allocaP[0]);
+  this->FirstAddress_ = firstAddress;
+  this->SecondAddress_ = secondAddress;
+  this->Load_ = jlm::rvsdg::node_output::node(load[0]);
+
+  return rvsdgModule;
+}
+
 }
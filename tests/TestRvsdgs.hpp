@@ -1990,4 +1990,113 @@ private:
   std::vector<const rvsdg::node *> AllocaNodes_;
 };
 
+/** \brief RVSDG module with a struct whose fields point to different memory locations.
+ *
+ * The class sets up an RVSDG module corresponding to the code:
+ *
+ * \code{.c}
+ *   struct pair { uint32_t * first; uint32_t * second; };
+ *
+ *   void f()
+ *   {
+ *     uint32_t a, b;
+ *     struct pair p, q;
+ *     p.first = &a;
+ *     p.second = &b;
+ *     ACCESS;
+ *     uint32_t * x = p.second;
+ *   }
+ * \endcode
+ *
+ * where ACCESS is one of the following accesses to p:
+ *
+ * \code{.c}
+ *   Access::None:             ;
+ *   Access::AggregateStore:   p = (struct pair){ &b, &a };
+ *   Access::AggregateLoad:    q = p;
+ *   Access::Memcpy:           memcpy(&q, &p, sizeof(p));
+ *   Access::Theta:            uint32_t ** i = &p.first; do { i = &p.second; } while (0); *i;
+ *   Access::OverlappingStore: *(__int128 *)&p = 0;
+ * \endcode
+ *
+ * It provides getters for the alloca nodes, the field addresses, and the load of p.second.
+ */
+class StructFieldTest final : public RvsdgTest
+{
+public:
+  enum class Access
+  {
+    None,
+    AggregateStore,
+    AggregateLoad,
+    Memcpy,
+    Theta,
+    OverlappingStore
+  };
+
+  explicit StructFieldTest(Access access = Access::None)
+      : Access_(access)
+  {}
+
+  [[nodiscard]] Access
+  GetAccess() const noexcept
+  {
+    return Access_;
+  }
+
+  [[nodiscard]] const jlm::rvsdg::node &
+  GetAllocaA() const noexcept
+  {
+    return *AllocaA_;
+  }
+
+  [[nodiscard]] const jlm::rvsdg::node &
+  GetAllocaB() const noexcept
+  {
+    return *AllocaB_;
+  }
+
+  [[nodiscard]] const jlm::rvsdg::node &
+  GetAllocaP() const noexcept
+  {
+    return *AllocaP_;
+  }
+
+  [[nodiscard]] const jlm::rvsdg::output &
+  GetFirstAddress() const noexcept
+  {
+    return *FirstAddress_;
+  }
+
+  [[nodiscard]] const jlm::rvsdg::output &
+  GetSecondAddress() const noexcept
+  {
+    return *SecondAddress_;
+  }
+
+  [[nodiscard]] const jlm::rvsdg::node &
+  GetLoad() const noexcept
+  {
+    return *Load_;
+  }
+
+private:
+  std::unique_ptr<jlm::llvm::RvsdgModule>
+  SetupRvsdg() override;
+
+  Access Access_;
+
+  jlm::rvsdg::node * AllocaA_;
+  jlm::rvsdg::node * AllocaB_;
+  jlm::rvsdg::node * AllocaP_;
+
+  jlm::rvsdg::output * FirstAddress_;
+  jlm::rvsdg::output * SecondAddress_;
+
+  jlm::rvsdg::node * Load_;
+
+  // The struct type refers to its declaration, which must outlive the RVSDG
+  std::unique_ptr<jlm::rvsdg::rcddeclaration> Declaration_;
+};
+
 }
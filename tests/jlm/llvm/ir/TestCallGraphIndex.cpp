@@ -0,0 +1,231 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-operation.hpp>
+#include <test-registry.hpp>
+#include <test-types.hpp>
+
+#include <jlm/llvm/ir/CallGraphIndex.hpp>
+#include <jlm/llvm/ir/operators.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/DeadNodeElimination.hpp>
+#include <jlm/rvsdg/theta.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+#include <thread>
+
+static std::vector<jlm::rvsdg::output *>
+GetFunctionArguments(const jlm::llvm::lambda::node & lambdaNode)
+{
+  std::vector<jlm::rvsdg::output *> arguments;
+  for (size_t n = 0; n < lambdaNode.nfctarguments(); n++)
+    arguments.push_back(lambdaNode.fctargument(n));
+
+  return arguments;
+}
+
+static std::vector<jlm::rvsdg::output *>
+CreateCall(jlm::rvsdg::output * function, const jlm::llvm::lambda::node & caller)
+{
+  return jlm::llvm::CallNode::Create(function, caller.type(), GetFunctionArguments(caller));
+}
+
+static void
+TestIncrementalUpdates()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::tests::valuetype vt;
+  iostatetype iOStateType;
+  MemoryStateType memoryStateType;
+  loopstatetype loopStateType;
+  FunctionType functionType(
+      { &vt, &iOStateType, &memoryStateType, &loopStateType },
+      { &vt, &iOStateType, &memoryStateType, &loopStateType });
+
+  RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+
+  auto lambdaF = lambda::node::create(graph.root(), functionType, "f", linkage::internal_linkage);
+  auto outputF = lambdaF->finalize(GetFunctionArguments(*lambdaF));
+
+  auto lambdaG = lambda::node::create(graph.root(), functionType, "g", linkage::external_linkage);
+  auto ctxVarF = lambdaG->add_ctxvar(outputF);
+  auto callResults = CreateCall(ctxVarF, *lambdaG);
+  auto outputG = lambdaG->finalize(callResults);
+  graph.add_export(outputG, { outputG->type(), "g" });
+
+  auto & callGraphIndex = CallGraphIndex::GetOrCreate(rvsdgModule);
+  assert(&CallGraphIndex::GetOrCreate(rvsdgModule) == &callGraphIndex);
+
+  // Act & Assert
+  auto callSummary = &callGraphIndex.GetCallSummary(*lambdaF);
+  assert(callSummary->HasOnlyDirectCalls() && callSummary->NumDirectCalls() == 1);
+  assert(&callGraphIndex.GetCallSummary(*lambdaF) == callSummary);
+  assert(callGraphIndex.NumCallSummaries() == 1);
+
+  // Modifications that do not use f keep the summary of f
+  jlm::tests::test_op::create(lambdaG->subregion(), { lambdaG->fctargument(0) }, { &vt });
+  assert(callGraphIndex.NumCallSummaries() == 1);
+
+  // A new call of f discards the summary of f
+  auto secondCallResults = CreateCall(ctxVarF, *lambdaG);
+  assert(callGraphIndex.NumCallSummaries() == 0);
+  assert(callGraphIndex.GetCallSummary(*lambdaF).NumDirectCalls() == 2);
+
+  // The removal of a call of f discards the summary of f
+  remove(jlm::rvsdg::node_output::node(secondCallResults[0]));
+  assert(callGraphIndex.NumCallSummaries() == 0);
+  assert(callGraphIndex.GetCallSummary(*lambdaF).NumDirectCalls() == 1);
+
+  // The export of f discards the summary of f
+  graph.add_export(outputF, { outputF->type(), "f" });
+  assert(callGraphIndex.GetCallSummary(*lambdaF).IsExported());
+  graph.root()->RemoveResult(graph.root()->nresults() - 1);
+  assert(!callGraphIndex.GetCallSummary(*lambdaF).IsExported());
+
+  // The removal of f discards its summary
+  for (size_t n = 0; n < callResults.size(); n++)
+    lambdaG->fctresult(n)->divert_to(lambdaG->fctargument(n));
+  jlm::util::StatisticsCollector statisticsCollector;
+  DeadNodeElimination deadNodeElimination;
+  deadNodeElimination.run(rvsdgModule, statisticsCollector);
+  assert(graph.root()->nnodes() == 1);
+  assert(callGraphIndex.NumCallSummaries() == 0);
+  assert(callGraphIndex.GetCallSummary(*lambdaG).IsOnlyExported());
+}
+
+static void
+TestNestedRegions()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::tests::valuetype vt;
+  iostatetype iOStateType;
+  MemoryStateType memoryStateType;
+  loopstatetype loopStateType;
+  FunctionType functionType(
+      { &vt, &iOStateType, &memoryStateType, &loopStateType },
+      { &vt, &iOStateType, &memoryStateType, &loopStateType });
+
+  RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+  auto & callGraphIndex = CallGraphIndex::GetOrCreate(rvsdgModule);
+
+  auto lambdaF = lambda::node::create(graph.root(), functionType, "f", linkage::internal_linkage);
+  auto outputF = lambdaF->finalize(GetFunctionArguments(*lambdaF));
+
+  // The subregion of g is created after the index, and the call of f is nested in a theta node
+  auto lambdaG = lambda::node::create(graph.root(), functionType, "g", linkage::external_linkage);
+  auto ctxVarF = lambdaG->add_ctxvar(outputF);
+  auto theta = jlm::rvsdg::theta_node::create(lambdaG->subregion());
+  auto loopVarF = theta->add_loopvar(ctxVarF);
+  auto outputG = lambdaG->finalize(GetFunctionArguments(*lambdaG));
+  graph.add_export(outputG, { outputG->type(), "g" });
+
+  assert(callGraphIndex.GetCallSummary(*lambdaF).IsDead());
+
+  // Act & Assert
+  std::vector<jlm::rvsdg::output *> arguments;
+  for (auto argument : GetFunctionArguments(*lambdaG))
+    arguments.push_back(theta->add_loopvar(argument)->argument());
+  CallNode::Create(loopVarF->argument(), functionType, arguments);
+  assert(callGraphIndex.GetCallSummary(*lambdaF).NumDirectCalls() == 1);
+  callGraphIndex.GetCallSummary(*lambdaG);
+  assert(callGraphIndex.NumCallSummaries() == 2);
+
+  // The removal of g removes the theta node and the call without reporting the removal of the
+  // call, but the index is notified through the removal of the context variable of g. The summary
+  // of g is discarded along with g.
+  graph.root()->RemoveResult(0);
+  remove(lambdaG);
+  assert(callGraphIndex.GetCallSummary(*lambdaF).IsDead());
+  assert(callGraphIndex.NumCallSummaries() == 1);
+}
+
+static void
+TestConcurrentModifications()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::tests::valuetype vt;
+  iostatetype iOStateType;
+  MemoryStateType memoryStateType;
+  loopstatetype loopStateType;
+  FunctionType functionType(
+      { &vt, &iOStateType, &memoryStateType, &loopStateType },
+      { &vt, &iOStateType, &memoryStateType, &loopStateType });
+
+  RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+
+  // Every caller calls its own callee
+  const size_t numFunctions = 4;
+  std::vector<lambda::node *> callees;
+  std::vector<lambda::node *> callers;
+  std::vector<jlm::rvsdg::output *> ctxVars;
+  for (size_t n = 0; n < numFunctions; n++)
+  {
+    auto name = std::to_string(n);
+    auto callee =
+        lambda::node::create(graph.root(), functionType, "f" + name, linkage::internal_linkage);
+    auto calleeOutput = callee->finalize(GetFunctionArguments(*callee));
+
+    auto caller =
+        lambda::node::create(graph.root(), functionType, "g" + name, linkage::external_linkage);
+    auto ctxVar = caller->add_ctxvar(calleeOutput);
+    auto callerOutput = caller->finalize(CreateCall(ctxVar, *caller));
+    graph.add_export(callerOutput, { callerOutput->type(), "g" + name });
+
+    callees.push_back(callee);
+    callers.push_back(caller);
+    ctxVars.push_back(ctxVar);
+  }
+
+  auto & callGraphIndex = CallGraphIndex::GetOrCreate(rvsdgModule);
+  for (auto callee : callees)
+    assert(callGraphIndex.GetCallSummary(*callee).NumDirectCalls() == 1);
+
+  // Act
+  // The callers are modified concurrently, as by a function-local optimization
+  std::vector<std::thread> threads;
+  for (size_t n = 0; n < numFunctions; n++)
+  {
+    threads.emplace_back(
+        [&, n]()
+        {
+          auto theta = jlm::rvsdg::theta_node::create(callers[n]->subregion());
+          auto loopVar = theta->add_loopvar(ctxVars[n]);
+          std::vector<jlm::rvsdg::output *> arguments;
+          for (auto argument : GetFunctionArguments(*callers[n]))
+            arguments.push_back(theta->add_loopvar(argument)->argument());
+          CallNode::Create(loopVar->argument(), functionType, arguments);
+        });
+  }
+  for (auto & thread : threads)
+    thread.join();
+
+  // Assert
+  assert(callGraphIndex.NumCallSummaries() == 0);
+  for (auto callee : callees)
+    assert(callGraphIndex.GetCallSummary(*callee).NumDirectCalls() == 2);
+  assert(callGraphIndex.NumCallSummaries() == numFunctions);
+}
+
+static int
+TestCallGraphIndex()
+{
+  TestIncrementalUpdates();
+  TestNestedRegions();
+  TestConcurrentModifications();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/ir/TestCallGraphIndex", TestCallGraphIndex)
@@ -0,0 +1,116 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/llvm/ir/types.hpp>
+#include <jlm/rvsdg/bitstring/type.hpp>
+
+#include <cassert>
+
+static void
+TestStructTypeHash()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::rvsdg::bittype bit32(32);
+  auto declaration1 = jlm::rvsdg::rcddeclaration::create({ &bit32 });
+  auto declaration2 = jlm::rvsdg::rcddeclaration::create({ &bit32 });
+
+  StructType structType1("s", false, *declaration1);
+  StructType structType2("s", false, *declaration1);
+  StructType packedStructType("s", true, *declaration1);
+  StructType otherStructType("s", false, *declaration2);
+
+  // Act & Assert
+  assert(structType1 == structType2);
+  assert(structType1.hash() == structType2.hash());
+
+  // Struct types that only differ in their parameters are distributed over different buckets
+  assert(structType1.hash() != packedStructType.hash());
+  assert(structType1.hash() != otherStructType.hash());
+
+  auto internedType = jlm::rvsdg::type::Intern(structType1);
+  assert(jlm::rvsdg::type::Intern(structType2) == internedType);
+  assert(jlm::rvsdg::type::Intern(packedStructType) != internedType);
+  assert(jlm::rvsdg::type::Intern(otherStructType) != internedType);
+}
+
+static void
+TestVectorTypeHash()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::rvsdg::bittype bit8(8);
+  jlm::rvsdg::bittype bit32(32);
+  fixedvectortype fixedVectorType(bit32, 4);
+  scalablevectortype scalableVectorType(bit32, 4);
+
+  // Act & Assert
+  // Fixed and scalable vector types compare equal, and must therefore have equal hash values
+  assert(fixedVectorType == scalableVectorType);
+  assert(fixedVectorType.hash() == scalableVectorType.hash());
+
+  assert(fixedVectorType.hash() != fixedvectortype(bit32, 8).hash());
+  assert(fixedVectorType.hash() != fixedvectortype(bit8, 4).hash());
+}
+
+static void
+TestInternedTypeLookup()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  auto internedType = type::Intern(bittype(32));
+
+  // Act & Assert
+  // Interning an interned type yields the type itself
+  assert(type::Intern(*internedType) == internedType);
+
+  // A type that is not interned yields the interned type
+  bittype bit32(32);
+  assert(type::Intern(bit32) == internedType);
+  assert(type::Intern(bit32).get() != &bit32);
+}
+
+static void
+TestIsOrContains()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::rvsdg::bittype bit32(32);
+  PointerType pointerType;
+  auto declaration = jlm::rvsdg::rcddeclaration::create({ &bit32, &pointerType });
+  StructType structType("s", false, *declaration);
+  arraytype arrayType(structType, 2);
+
+  auto bitsDeclaration = jlm::rvsdg::rcddeclaration::create({ &bit32, &bit32 });
+  StructType bitsStructType("t", false, *bitsDeclaration);
+
+  // Act & Assert
+  assert(IsOrContains<PointerType>(pointerType));
+  assert(!IsOrContains<PointerType>(bit32));
+
+  // The pointer is not the first element of the struct
+  assert(IsOrContains<PointerType>(structType));
+  assert(IsOrContains<PointerType>(arrayType));
+  assert(!IsOrContains<PointerType>(bitsStructType));
+}
+
+static int
+TestTypes()
+{
+  TestStructTypeHash();
+  TestVectorTypeHash();
+  TestInternedTypeLookup();
+  TestIsOrContains();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/ir/TestTypes", TestTypes)
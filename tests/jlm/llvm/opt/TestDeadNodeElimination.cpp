@@ -421,6 +421,130 @@ TestDelta()
   assert(deltaNode->ninputs() == 1);
 }
 
+static void
+TestDeepChain()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::tests::valuetype valueType;
+
+  RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & rvsdg = rvsdgModule.Rvsdg();
+  auto x = rvsdg.add_import({ valueType, "x" });
+
+  // A chain that is long enough to overflow the stack with a recursive mark phase
+  const size_t chainLength = 1000000;
+  jlm::rvsdg::output * alive = x;
+  for (size_t n = 0; n < chainLength; n++)
+    alive = jlm::tests::create_testop(rvsdg.root(), { alive }, { &valueType })[0];
+
+  auto dead = jlm::tests::create_testop(rvsdg.root(), { alive }, { &valueType })[0];
+  jlm::tests::create_testop(rvsdg.root(), { dead }, { &valueType });
+
+  rvsdg.add_export(alive, { alive->type(), "alive" });
+
+  // Act
+  RunDeadNodeElimination(rvsdgModule);
+
+  // Assert
+  assert(rvsdg.root()->nnodes() == chainLength);
+  assert(rvsdg.root()->result(0)->origin() == alive);
+}
+
+static void
+TestIncrementalGamma()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::tests::valuetype valueType;
+  jlm::rvsdg::ctltype controlType(2);
+
+  RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & rvsdg = rvsdgModule.Rvsdg();
+  auto c = rvsdg.add_import({ controlType, "c" });
+  auto x = rvsdg.add_import({ valueType, "x" });
+  auto y = rvsdg.add_import({ valueType, "y" });
+
+  auto u = jlm::tests::create_testop(rvsdg.root(), { x }, { &valueType })[0];
+
+  auto gamma = jlm::rvsdg::gamma_node::create(c, 2);
+  auto ev1 = gamma->add_entryvar(u);
+  auto ev2 = gamma->add_entryvar(y);
+
+  auto t = jlm::tests::create_testop(gamma->subregion(1), { ev1->argument(1) }, { &valueType })[0];
+
+  auto xv1 = gamma->add_exitvar({ ev1->argument(0), t });
+  auto xv2 = gamma->add_exitvar({ ev2->argument(0), ev2->argument(1) });
+
+  auto s = jlm::tests::create_testop(rvsdg.root(), { xv1 }, { &valueType })[0];
+
+  rvsdg.add_export(s, { s->type(), "s" });
+  rvsdg.add_export(xv2, { xv2->type(), "xv2" });
+
+  // Act
+  auto sNode = jlm::rvsdg::node_output::node(s);
+  rvsdg.root()->result(0)->divert_to(y);
+  DeadNodeElimination::RemoveDeadNodes({ sNode });
+
+  // Assert
+  assert(rvsdg.root()->nnodes() == 1);
+  assert(gamma->noutputs() == 1);
+  assert(gamma->ninputs() == 2);
+  assert(gamma->subregion(1)->nnodes() == 0);
+  assert(gamma->subregion(0)->narguments() == 1);
+  assert(rvsdg.root()->narguments() == 3);
+}
+
+static void
+TestIncrementalTheta()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::tests::valuetype valueType;
+  jlm::rvsdg::ctltype controlType(2);
+
+  RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & rvsdg = rvsdgModule.Rvsdg();
+  auto x = rvsdg.add_import({ valueType, "x" });
+  auto y = rvsdg.add_import({ valueType, "y" });
+
+  auto theta = jlm::rvsdg::theta_node::create(rvsdg.root());
+
+  auto lv1 = theta->add_loopvar(x);
+  auto lv2 = theta->add_loopvar(y);
+  auto lv3 = theta->add_loopvar(y);
+
+  auto t = jlm::tests::create_testop(theta->subregion(), { lv1->argument() }, { &valueType })[0];
+  lv1->result()->divert_to(t);
+
+  auto predicate = jlm::tests::create_testop(theta->subregion(), {}, { &controlType })[0];
+  theta->set_predicate(predicate);
+
+  rvsdg.add_export(lv1, { lv1->type(), "lv1" });
+  rvsdg.add_export(lv2, { lv2->type(), "lv2" });
+  rvsdg.add_export(lv3, { lv3->type(), "lv3" });
+
+  // Act
+  rvsdg.root()->result(0)->divert_to(x);
+  rvsdg.root()->result(1)->divert_to(x);
+  DeadNodeElimination::RemoveDeadNodes({ theta });
+
+  // Assert
+  // The loop variable lv1 is kept alive by the cycle through t, while lv2 is removed.
+  assert(theta->noutputs() == 2);
+  assert(theta->output(0) == lv1);
+  assert(theta->output(1) == lv3);
+  assert(theta->subregion()->nnodes() == 2);
+
+  // A full Dead Node Elimination also removes lv1
+  RunDeadNodeElimination(rvsdgModule);
+  assert(theta->noutputs() == 1);
+  assert(theta->subregion()->nnodes() == 1);
+}
+
 static int
 TestDeadNodeElimination()
 {
@@ -433,6 +557,9 @@ TestDeadNodeElimination()
   TestLambda();
   TestPhi();
   TestDelta();
+  TestDeepChain();
+  TestIncrementalGamma();
+  TestIncrementalTheta();
 
   return 0;
 }
@@ -0,0 +1,148 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-operation.hpp"
+#include "test-registry.hpp"
+#include "test-types.hpp"
+
+#include <jlm/llvm/ir/operators/lambda.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/cne.hpp>
+#include <jlm/llvm/opt/DeadNodeElimination.hpp>
+#include <jlm/llvm/opt/inversion.hpp>
+#include <jlm/llvm/opt/OptimizationSequence.hpp>
+#include <jlm/llvm/opt/pull.hpp>
+#include <jlm/llvm/opt/push.hpp>
+#include <jlm/rvsdg/view.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+
+/**
+ * Creates a module with \p numLambdas functions. Each function computes the same value twice
+ * and returns both copies. The two computations use different context variables, which are both
+ * bound to the same import.
+ */
+static std::unique_ptr<jlm::llvm::RvsdgModule>
+SetupModule(size_t numLambdas, std::vector<jlm::llvm::lambda::node *> & lambdaNodes)
+{
+  using namespace jlm::llvm;
+
+  jlm::tests::valuetype valueType;
+  FunctionType functionType({ &valueType }, { &valueType, &valueType });
+
+  auto rvsdgModule = RvsdgModule::Create(jlm::util::filepath(""), "", "");
+  auto & rvsdg = rvsdgModule->Rvsdg();
+  rvsdg.node_normal_form(typeid(jlm::rvsdg::operation))->set_mutable(false);
+
+  auto import = rvsdg.add_import({ valueType, "g" });
+
+  for (size_t n = 0; n < numLambdas; n++)
+  {
+    auto lambda = lambda::node::create(
+        rvsdg.root(),
+        functionType,
+        "f" + std::to_string(n),
+        linkage::external_linkage);
+    auto contextVariable1 = lambda->add_ctxvar(import);
+    auto contextVariable2 = lambda->add_ctxvar(import);
+
+    auto node1 = jlm::tests::test_op::create(
+        lambda->subregion(),
+        { lambda->fctargument(0), contextVariable1 },
+        { &valueType });
+    auto node2 = jlm::tests::test_op::create(
+        lambda->subregion(),
+        { lambda->fctargument(0), contextVariable2 },
+        { &valueType });
+
+    auto lambdaOutput = lambda->finalize({ node1->output(0), node2->output(0) });
+    rvsdg.add_export(lambdaOutput, { lambdaOutput->type(), lambda->name() });
+    lambdaNodes.push_back(lambda);
+  }
+
+  return rvsdgModule;
+}
+
+static void
+TestParallelFunctionLocalOptimizations()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  std::vector<lambda::node *> sequentialLambdaNodes, parallelLambdaNodes;
+  auto sequentialModule = SetupModule(64, sequentialLambdaNodes);
+  auto parallelModule = SetupModule(64, parallelLambdaNodes);
+
+  cne commonNodeElimination;
+  pushout nodePushOut;
+  pullin nodePullIn;
+  tginversion thetaGammaInversion;
+  std::vector<optimization *> optimizations(
+      { &commonNodeElimination, &nodePushOut, &nodePullIn, &thetaGammaInversion });
+
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  // Act
+  OptimizationSequence::CreateAndRun(*sequentialModule, statisticsCollector, optimizations, 1);
+  OptimizationSequence::CreateAndRun(*parallelModule, statisticsCollector, optimizations, 4);
+
+  // Assert
+  for (auto lambdaNode : parallelLambdaNodes)
+  {
+    auto subregion = lambdaNode->subregion();
+    assert(subregion->result(0)->origin() == subregion->result(1)->origin());
+  }
+
+  // The structure of the graphs must not depend on the number of jobs
+  assert(
+      jlm::rvsdg::view(parallelModule->Rvsdg().root())
+      == jlm::rvsdg::view(sequentialModule->Rvsdg().root()));
+}
+
+static void
+TestMixedOptimizations()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  std::vector<lambda::node *> lambdaNodes;
+  auto rvsdgModule = SetupModule(8, lambdaNodes);
+
+  pushout nodePushOut;
+  cne commonNodeElimination;
+  DeadNodeElimination deadNodeElimination;
+  assert(nodePushOut.IsFunctionLocal());
+  assert(!commonNodeElimination.IsFunctionLocal());
+  assert(!deadNodeElimination.IsFunctionLocal());
+
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  // Act
+  OptimizationSequence::CreateAndRun(
+      *rvsdgModule,
+      statisticsCollector,
+      { &nodePushOut, &commonNodeElimination, &deadNodeElimination },
+      3);
+
+  // Assert
+  for (auto lambdaNode : lambdaNodes)
+  {
+    auto subregion = lambdaNode->subregion();
+    assert(subregion->result(0)->origin() == subregion->result(1)->origin());
+    assert(subregion->nnodes() == 1);
+  }
+}
+
+static int
+TestOptimizationSequence()
+{
+  TestParallelFunctionLocalOptimizations();
+  TestMixedOptimizations();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/opt/TestOptimizationSequence", TestOptimizationSequence)
@@ -0,0 +1,314 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "TestRvsdgs.hpp"
+
+#include <test-registry.hpp>
+
+#include <jlm/llvm/opt/alias-analyses/Andersen.hpp>
+#include <jlm/llvm/opt/alias-analyses/Optimization.hpp>
+#include <jlm/llvm/opt/alias-analyses/PointsToGraph.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+
+static std::unique_ptr<jlm::llvm::aa::PointsToGraph>
+RunAndersen(jlm::llvm::RvsdgModule & module)
+{
+  using namespace jlm::llvm;
+
+  aa::Andersen andersen;
+  jlm::util::StatisticsCollector statisticsCollector;
+  return andersen.Analyze(module, statisticsCollector);
+}
+
+static void
+assertTargets(
+    const jlm::llvm::aa::PointsToGraph::Node & node,
+    const std::unordered_set<const jlm::llvm::aa::PointsToGraph::Node *> & targets)
+{
+  using namespace jlm::llvm::aa;
+
+  std::unordered_set<const PointsToGraph::Node *> nodeTargets;
+  for (auto & target : node.Targets())
+    nodeTargets.insert(&target);
+
+  assert(targets == nodeTargets);
+}
+
+/**
+ * Unlike Steensgaard, Andersen keeps the points-to sets of x and y apart.
+ */
+static void
+TestStore2()
+{
+  // Arrange
+  jlm::tests::StoreTest2 test;
+
+  // Act
+  auto pointsToGraph = RunAndersen(test.module());
+
+  // Assert
+  assert(pointsToGraph->NumAllocaNodes() == 5);
+  assert(pointsToGraph->NumLambdaNodes() == 1);
+
+  auto & allocaA = pointsToGraph->GetAllocaNode(*test.alloca_a);
+  auto & allocaB = pointsToGraph->GetAllocaNode(*test.alloca_b);
+  auto & allocaX = pointsToGraph->GetAllocaNode(*test.alloca_x);
+  auto & allocaY = pointsToGraph->GetAllocaNode(*test.alloca_y);
+  auto & allocaP = pointsToGraph->GetAllocaNode(*test.alloca_p);
+  auto & lambda = pointsToGraph->GetLambdaNode(*test.lambda);
+
+  assertTargets(allocaA, {});
+  assertTargets(allocaB, {});
+  assertTargets(allocaX, { &allocaA });
+  assertTargets(allocaY, { &allocaB });
+  assertTargets(allocaP, { &allocaX, &allocaY });
+
+  assertTargets(pointsToGraph->GetRegisterNode(*test.alloca_x->output(0)), { &allocaX });
+  assertTargets(pointsToGraph->GetRegisterNode(*test.alloca_p->output(0)), { &allocaP });
+  // The lambda is exported, which marks its output as pointing to external
+  auto & externalMemory = pointsToGraph->GetExternalMemoryNode();
+  assertTargets(
+      pointsToGraph->GetRegisterNode(*test.lambda->output()),
+      { &lambda, &externalMemory });
+
+  jlm::util::HashSet<const jlm::llvm::aa::PointsToGraph::MemoryNode *> expectedEscapedMemoryNodes(
+      { &lambda });
+  assert(pointsToGraph->GetEscapedMemoryNodes() == expectedEscapedMemoryNodes);
+}
+
+/**
+ * Unlike Steensgaard, Andersen does not merge the functions that are passed to indcall.
+ */
+static void
+TestIndirectCall()
+{
+  // Arrange
+  jlm::tests::IndirectCallTest1 test;
+
+  // Act
+  auto pointsToGraph = RunAndersen(test.module());
+
+  // Assert
+  assert(pointsToGraph->NumLambdaNodes() == 4);
+  assert(pointsToGraph->NumImportNodes() == 0);
+
+  auto & lambdaThree = pointsToGraph->GetLambdaNode(test.GetLambdaThree());
+  auto & lambdaFour = pointsToGraph->GetLambdaNode(test.GetLambdaFour());
+  auto & lambdaIndcall = pointsToGraph->GetLambdaNode(test.GetLambdaIndcall());
+  auto & lambdaTest = pointsToGraph->GetLambdaNode(test.GetLambdaTest());
+
+  auto & lambdaThreeOutput = pointsToGraph->GetRegisterNode(*test.GetLambdaThree().output());
+  auto & lambdaFourOutput = pointsToGraph->GetRegisterNode(*test.GetLambdaFour().output());
+  auto & lambdaIndcallOutput = pointsToGraph->GetRegisterNode(*test.GetLambdaIndcall().output());
+  auto & lambdaIndcallArgument =
+      pointsToGraph->GetRegisterNode(*test.GetLambdaIndcall().fctargument(0));
+
+  assertTargets(lambdaThreeOutput, { &lambdaThree });
+  assertTargets(lambdaFourOutput, { &lambdaFour });
+  assertTargets(lambdaIndcallOutput, { &lambdaIndcall });
+  assertTargets(lambdaIndcallArgument, { &lambdaThree, &lambdaFour });
+
+  jlm::util::HashSet<const jlm::llvm::aa::PointsToGraph::MemoryNode *> expectedEscapedMemoryNodes(
+      { &lambdaTest });
+  assert(pointsToGraph->GetEscapedMemoryNodes() == expectedEscapedMemoryNodes);
+}
+
+static void
+TestPhi1()
+{
+  // Arrange
+  jlm::tests::PhiTest1 test;
+
+  // Act
+  auto pointsToGraph = RunAndersen(test.module());
+
+  // Assert
+  assert(pointsToGraph->NumAllocaNodes() == 1);
+  assert(pointsToGraph->NumLambdaNodes() == 2);
+
+  auto & lambdaFib = pointsToGraph->GetLambdaNode(*test.lambda_fib);
+  auto & lambdaTest = pointsToGraph->GetLambdaNode(*test.lambda_test);
+  auto & alloca = pointsToGraph->GetAllocaNode(*test.alloca);
+
+  auto & lambdaFibArgument1 = pointsToGraph->GetRegisterNode(*test.lambda_fib->fctargument(1));
+  auto & phiRecursionVariable = pointsToGraph->GetRegisterNode(*test.phi->begin_rv().output());
+  auto & phiRecursionVariableArgument =
+      pointsToGraph->GetRegisterNode(*test.phi->begin_rv().output()->argument());
+  auto & gammaResult = pointsToGraph->GetRegisterNode(*test.gamma->subregion(0)->argument(1));
+  auto & gammaFib = pointsToGraph->GetRegisterNode(*test.gamma->subregion(0)->argument(2));
+
+  assertTargets(lambdaFibArgument1, { &alloca });
+  assertTargets(phiRecursionVariable, { &lambdaFib });
+  assertTargets(phiRecursionVariableArgument, { &lambdaFib });
+  assertTargets(gammaResult, { &alloca });
+  assertTargets(gammaFib, { &lambdaFib });
+
+  jlm::util::HashSet<const jlm::llvm::aa::PointsToGraph::MemoryNode *> expectedEscapedMemoryNodes(
+      { &lambdaTest });
+  assert(pointsToGraph->GetEscapedMemoryNodes() == expectedEscapedMemoryNodes);
+}
+
+static void
+TestEscapedMemory1()
+{
+  // Arrange
+  jlm::tests::EscapedMemoryTest1 test;
+
+  // Act
+  auto pointsToGraph = RunAndersen(test.module());
+
+  // Assert
+  assert(pointsToGraph->NumDeltaNodes() == 4);
+  assert(pointsToGraph->NumLambdaNodes() == 1);
+
+  auto & lambdaTestArgument0 = pointsToGraph->GetRegisterNode(*test.LambdaTest->fctargument(0));
+  auto & lambdaTestCv0 = pointsToGraph->GetRegisterNode(*test.LambdaTest->cvargument(0));
+  auto & loadNode1Output = pointsToGraph->GetRegisterNode(*test.LoadNode1->output(0));
+
+  auto deltaA = &pointsToGraph->GetDeltaNode(*test.DeltaA);
+  auto deltaB = &pointsToGraph->GetDeltaNode(*test.DeltaB);
+  auto deltaX = &pointsToGraph->GetDeltaNode(*test.DeltaX);
+  auto deltaY = &pointsToGraph->GetDeltaNode(*test.DeltaY);
+  auto lambdaTest = &pointsToGraph->GetLambdaNode(*test.LambdaTest);
+  auto externalMemory = &pointsToGraph->GetExternalMemoryNode();
+
+  assertTargets(lambdaTestArgument0, { deltaA, deltaX, deltaY, lambdaTest, externalMemory });
+  assertTargets(lambdaTestCv0, { deltaB });
+  assertTargets(loadNode1Output, { deltaA, deltaX, deltaY, lambdaTest, externalMemory });
+
+  // Escaped memory nodes are only reachable from memory nodes through the external memory node
+  assertTargets(*externalMemory, { deltaA, deltaX, deltaY, lambdaTest });
+  assertTargets(*deltaA, { externalMemory });
+
+  jlm::util::HashSet<const jlm::llvm::aa::PointsToGraph::MemoryNode *> expectedEscapedMemoryNodes(
+      { lambdaTest, deltaA, deltaX, deltaY });
+  assert(pointsToGraph->GetEscapedMemoryNodes() == expectedEscapedMemoryNodes);
+}
+
+static void
+TestExternalCall()
+{
+  // Arrange
+  jlm::tests::ExternalCallTest test;
+
+  // Act
+  auto pointsToGraph = RunAndersen(test.module());
+
+  // Assert
+  auto & callResult = pointsToGraph->GetRegisterNode(*test.CallG().Result(0));
+  auto & externalMemory = pointsToGraph->GetExternalMemoryNode();
+
+  bool pointsToExternalMemory = false;
+  for (auto & target : callResult.Targets())
+    pointsToExternalMemory |= &target == &externalMemory;
+  assert(pointsToExternalMemory);
+}
+
+/**
+ * Registers with equal points-to sets share a single register node.
+ */
+static void
+TestRegisterNodeSharing()
+{
+  // Arrange
+  jlm::tests::CallTest1 test;
+
+  // Act
+  auto pointsToGraph = RunAndersen(test.module());
+
+  // Assert
+  auto & allocaXOutput = pointsToGraph->GetRegisterNode(*test.alloca_x->output(0));
+  auto & lambdaFArgument0 = pointsToGraph->GetRegisterNode(*test.lambda_f->fctargument(0));
+  auto & allocaYOutput = pointsToGraph->GetRegisterNode(*test.alloca_y->output(0));
+  assert(&allocaXOutput == &lambdaFArgument0);
+  assert(&allocaXOutput != &allocaYOutput);
+  assert(allocaXOutput.GetOutputs().Contains(test.lambda_f->fctargument(0)));
+
+  assert(pointsToGraph->NumUniqueRegisterNodes() < pointsToGraph->NumRegisterNodes());
+}
+
+/**
+ * Runs the complete Andersen based memory state encoding on a number of RVSDGs.
+ */
+static void
+TestMemoryStateEncoding()
+{
+  using namespace jlm::llvm;
+
+  auto encode = [](jlm::tests::RvsdgTest & test)
+  {
+    jlm::util::StatisticsCollector statisticsCollector;
+
+    aa::AndersenAgnostic andersenAgnostic;
+    andersenAgnostic.run(test.module(), statisticsCollector);
+  };
+
+  auto encodeRegionAware = [](jlm::tests::RvsdgTest & test)
+  {
+    jlm::util::StatisticsCollector statisticsCollector;
+
+    aa::AndersenRegionAware andersenRegionAware;
+    andersenRegionAware.run(test.module(), statisticsCollector);
+  };
+
+  jlm::tests::StoreTest2 storeTest2;
+  jlm::tests::IndirectCallTest1 indirectCallTest1;
+  jlm::tests::PhiTest1 phiTest1;
+  jlm::tests::EscapedMemoryTest1 escapedMemoryTest1;
+  jlm::tests::ExternalCallTest externalCallTest;
+  jlm::tests::GammaTest gammaTest;
+  jlm::tests::ThetaTest thetaTest;
+  jlm::tests::DeltaTest1 deltaTest1;
+  jlm::tests::MemcpyTest memcpyTest;
+  encode(storeTest2);
+  encode(indirectCallTest1);
+  encode(gammaTest);
+  encodeRegionAware(phiTest1);
+  encodeRegionAware(escapedMemoryTest1);
+  encodeRegionAware(externalCallTest);
+  encodeRegionAware(thetaTest);
+  encodeRegionAware(deltaTest1);
+  encodeRegionAware(memcpyTest);
+}
+
+static void
+TestStatistics()
+{
+  // Arrange
+  jlm::tests::LoadTest1 test;
+  jlm::util::filepath filePath("/tmp/TestDisabledStatistics");
+  std::remove(filePath.to_str().c_str());
+
+  jlm::util::StatisticsCollectorSettings statisticsCollectorSettings(
+      filePath,
+      { jlm::util::Statistics::Id::AndersenAnalysis });
+  jlm::util::StatisticsCollector statisticsCollector(statisticsCollectorSettings);
+
+  // Act
+  jlm::llvm::aa::Andersen andersen;
+  andersen.Analyze(test.module(), statisticsCollector);
+
+  // Assert
+  assert(statisticsCollector.NumCollectedStatistics() == 1);
+}
+
+static int
+TestAndersen()
+{
+  TestStore2();
+  TestIndirectCall();
+  TestPhi1();
+  TestEscapedMemory1();
+  TestExternalCall();
+  TestRegisterNodeSharing();
+  TestMemoryStateEncoding();
+  TestStatistics();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/opt/alias-analyses/TestAndersen", TestAndersen)
@@ -0,0 +1,227 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "TestRvsdgs.hpp"
+
+#include <test-registry.hpp>
+
+#include <jlm/llvm/opt/alias-analyses/AgnosticMemoryNodeProvider.hpp>
+#include <jlm/llvm/opt/alias-analyses/MemoryNodeCoarsener.hpp>
+#include <jlm/llvm/opt/alias-analyses/MemoryStateEncoder.hpp>
+#include <jlm/llvm/opt/alias-analyses/Operators.hpp>
+#include <jlm/llvm/opt/alias-analyses/RegionAwareMemoryNodeProvider.hpp>
+#include <jlm/llvm/opt/alias-analyses/Steensgaard.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+
+template<class OP>
+static bool
+is(const jlm::rvsdg::node & node, size_t numInputs, size_t numOutputs)
+{
+  return jlm::rvsdg::is<OP>(&node) && node.ninputs() == numInputs && node.noutputs() == numOutputs;
+}
+
+/**
+ * Validates that the lambda entry splits and exit merges of \p lambdaNode route exactly one memory
+ * state edge for every memory node of \p provisioning.
+ */
+static void
+ValidateLambdaEncoding(
+    const jlm::llvm::lambda::node & lambdaNode,
+    const jlm::llvm::aa::MemoryNodeProvisioning & provisioning)
+{
+  using namespace jlm::llvm;
+
+  auto & subregion = *lambdaNode.subregion();
+  for (size_t n = 0; n < subregion.narguments(); n++)
+  {
+    auto argument = subregion.argument(n);
+    if (!is<MemoryStateType>(argument->type()) || argument->nusers() != 1)
+      continue;
+
+    auto lambdaEntrySplit = input_node(*argument->begin());
+    auto numEntryNodes = provisioning.GetLambdaEntryNodes(lambdaNode).Size();
+    assert(is<aa::LambdaEntryMemStateOperator>(*lambdaEntrySplit, 1, numEntryNodes));
+  }
+
+  for (size_t n = 0; n < subregion.nresults(); n++)
+  {
+    auto result = subregion.result(n);
+    if (!is<MemoryStateType>(result->type()))
+      continue;
+
+    auto lambdaExitMerge = jlm::rvsdg::node_output::node(result->origin());
+    auto numExitNodes = provisioning.GetLambdaExitNodes(lambdaNode).Size();
+    assert(is<aa::LambdaExitMemStateOperator>(*lambdaExitMerge, numExitNodes, 1));
+  }
+}
+
+template<class Test, class Provider>
+static void
+ValidateEncodingWithCoarsening()
+{
+  using namespace jlm::llvm::aa;
+
+  Test test;
+  auto & rvsdgModule = test.module();
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  Steensgaard steensgaard;
+  auto pointsToGraph = steensgaard.Analyze(rvsdgModule, statisticsCollector);
+  auto seedProvisioning = Provider::Create(rvsdgModule, *pointsToGraph);
+  auto provisioning =
+      MemoryNodeCoarsener::Create(rvsdgModule, *seedProvisioning, 0, statisticsCollector);
+
+  MemoryStateEncoder encoder;
+  encoder.Encode(rvsdgModule, *provisioning, statisticsCollector);
+
+  for (auto lambdaNode : jlm::llvm::lambda::CollectLambdaNodes(*rvsdgModule.Rvsdg().root()))
+  {
+    auto & entryNodes = provisioning->GetLambdaEntryNodes(*lambdaNode);
+    assert(entryNodes.Size() <= seedProvisioning->GetLambdaEntryNodes(*lambdaNode).Size());
+
+    ValidateLambdaEncoding(*lambdaNode, *provisioning);
+  }
+}
+
+static void
+TestCoarsening()
+{
+  using namespace jlm::llvm::aa;
+
+  // Arrange
+  jlm::tests::CallTest1 test;
+  auto & rvsdgModule = test.module();
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  Steensgaard steensgaard;
+  auto pointsToGraph = steensgaard.Analyze(rvsdgModule, statisticsCollector);
+  auto seedProvisioning = AgnosticMemoryNodeProvider::Create(rvsdgModule, *pointsToGraph);
+
+  auto & allocaX = pointsToGraph->GetAllocaNode(*test.alloca_x);
+  auto & allocaY = pointsToGraph->GetAllocaNode(*test.alloca_y);
+  auto & allocaZ = pointsToGraph->GetAllocaNode(*test.alloca_z);
+
+  // Act
+  auto provisioning =
+      MemoryNodeCoarsener::Create(rvsdgModule, *seedProvisioning, 0, statisticsCollector);
+
+  // Assert
+  // f only distinguishes x and y, and g only distinguishes z from all other memory nodes.
+  auto & lambdaFEntryNodes = provisioning->GetLambdaEntryNodes(*test.lambda_f);
+  assert(lambdaFEntryNodes.Size() == 3);
+  assert(lambdaFEntryNodes.Contains(&allocaX));
+  assert(lambdaFEntryNodes.Contains(&allocaY));
+
+  auto & lambdaGEntryNodes = provisioning->GetLambdaEntryNodes(*test.lambda_g);
+  assert(lambdaGEntryNodes.Size() == 2);
+  assert(lambdaGEntryNodes.Contains(&allocaZ));
+
+  // The alloca nodes of h are always distinguished.
+  auto & lambdaHEntryNodes = provisioning->GetLambdaEntryNodes(*test.lambda_h);
+  assert(lambdaHEntryNodes.Size() == 4);
+  assert(lambdaHEntryNodes.Contains(&allocaX));
+  assert(lambdaHEntryNodes.Contains(&allocaY));
+  assert(lambdaHEntryNodes.Contains(&allocaZ));
+  assert(provisioning->GetCallEntryNodes(test.CallF()) == lambdaHEntryNodes);
+
+  auto outputNodes = provisioning->GetOutputNodes(*test.lambda_f->fctargument(0));
+  assert(outputNodes.Size() == 1 && outputNodes.Contains(&allocaX));
+}
+
+static void
+TestBudget()
+{
+  using namespace jlm::llvm::aa;
+
+  // Arrange
+  jlm::tests::CallTest1 test;
+  auto & rvsdgModule = test.module();
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  Steensgaard steensgaard;
+  auto pointsToGraph = steensgaard.Analyze(rvsdgModule, statisticsCollector);
+  auto seedProvisioning = AgnosticMemoryNodeProvider::Create(rvsdgModule, *pointsToGraph);
+  auto numMemoryNodes = seedProvisioning->GetLambdaEntryNodes(*test.lambda_h).Size();
+
+  // Act
+  auto provisioning = MemoryNodeCoarsener::Create(
+      rvsdgModule,
+      *seedProvisioning,
+      numMemoryNodes,
+      statisticsCollector);
+
+  // Assert
+  // None of the lambda nodes references more memory nodes than the budget allows. All memory node
+  // sets are therefore taken from the seed provisioning.
+  for (auto lambdaNode : { test.lambda_f, test.lambda_g, test.lambda_h })
+  {
+    assert(
+        &provisioning->GetLambdaEntryNodes(*lambdaNode)
+        == &seedProvisioning->GetLambdaEntryNodes(*lambdaNode));
+  }
+  assert(
+      &provisioning->GetCallEntryNodes(test.CallF())
+      == &seedProvisioning->GetCallEntryNodes(test.CallF()));
+}
+
+static void
+TestEncoding()
+{
+  using namespace jlm::llvm::aa;
+
+  ValidateEncodingWithCoarsening<jlm::tests::CallTest1, AgnosticMemoryNodeProvider>();
+  ValidateEncodingWithCoarsening<jlm::tests::CallTest2, RegionAwareMemoryNodeProvider>();
+  ValidateEncodingWithCoarsening<jlm::tests::GammaTest, AgnosticMemoryNodeProvider>();
+  ValidateEncodingWithCoarsening<jlm::tests::ThetaTest, AgnosticMemoryNodeProvider>();
+  ValidateEncodingWithCoarsening<jlm::tests::PhiTest1, RegionAwareMemoryNodeProvider>();
+  ValidateEncodingWithCoarsening<jlm::tests::MemcpyTest, AgnosticMemoryNodeProvider>();
+}
+
+static void
+TestStatistics()
+{
+  using namespace jlm::llvm::aa;
+
+  // Arrange
+  jlm::tests::CallTest1 test;
+  auto & rvsdgModule = test.module();
+
+  jlm::util::StatisticsCollector steensgaardStatisticsCollector;
+  Steensgaard steensgaard;
+  auto pointsToGraph = steensgaard.Analyze(rvsdgModule, steensgaardStatisticsCollector);
+  auto seedProvisioning = AgnosticMemoryNodeProvider::Create(rvsdgModule, *pointsToGraph);
+
+  jlm::util::StatisticsCollectorSettings statisticsCollectorSettings(
+      jlm::util::filepath("/tmp/TestStatistics"),
+      { jlm::util::Statistics::Id::MemoryNodeProvisioning });
+  jlm::util::StatisticsCollector statisticsCollector(statisticsCollectorSettings);
+
+  // Act
+  MemoryNodeCoarsener::Create(rvsdgModule, *seedProvisioning, 0, statisticsCollector);
+
+  // Assert
+  assert(statisticsCollector.NumCollectedStatistics() == 1);
+
+  auto statistics = statisticsCollector.CollectedStatistics().begin()->ToString();
+  assert(statistics.find("#LambdaNodes:3 ") != std::string::npos);
+  assert(statistics.find("#CoarsenedLambdaNodes:3 ") != std::string::npos);
+}
+
+static int
+TestMemoryNodeCoarsener()
+{
+  TestCoarsening();
+  TestBudget();
+  TestEncoding();
+  TestStatistics();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/alias-analyses/TestMemoryNodeCoarsener",
+    TestMemoryNodeCoarsener)
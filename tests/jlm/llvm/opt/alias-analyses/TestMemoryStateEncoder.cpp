@@ -1192,6 +1192,50 @@ ValidateMemcpySteensgaardRegionAware(const jlm::tests::MemcpyTest & test)
   }
 }
 
+template<class Provider>
+static void
+TestFieldSensitiveEncoding()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::tests::StructFieldTest test;
+  auto & rvsdgModule = test.module();
+
+  jlm::util::StatisticsCollector statisticsCollector;
+  aa::Steensgaard steensgaard(true);
+  auto pointsToGraph = steensgaard.Analyze(rvsdgModule, statisticsCollector);
+  assert(pointsToGraph->NumFieldNodes() == 1);
+
+  // Act
+  auto provisioning = Provider::Create(rvsdgModule, *pointsToGraph);
+  aa::MemoryStateEncoder encoder;
+  encoder.Encode(rvsdgModule, *provisioning, statisticsCollector);
+  jlm::rvsdg::view(rvsdgModule.Rvsdg().root(), stdout);
+
+  // Assert
+  // The stores to the two fields are independent, and both are sequenced after the alloca
+  auto & allocaP = test.GetAllocaP();
+
+  auto storeFirst = input_node(*test.GetFirstAddress().begin());
+  assert(is<StoreOperation>(*storeFirst, 3, 1));
+  assert(storeFirst->input(2)->origin() == allocaP.output(1));
+
+  // The encoder replaces the load, and we therefore find it through the address of the field
+  jlm::rvsdg::node * load = nullptr;
+  for (auto user : test.GetSecondAddress())
+  {
+    if (is<LoadOperation>(*input_node(user), 2, 2))
+      load = input_node(user);
+  }
+  assert(load != nullptr);
+
+  auto storeSecond = jlm::rvsdg::node_output::node(load->input(1)->origin());
+  assert(is<StoreOperation>(*storeSecond, 3, 1));
+  assert(storeSecond->input(0)->origin() == &test.GetSecondAddress());
+  assert(storeSecond->input(2)->origin() == allocaP.output(1));
+}
+
 static int
 test()
 {
@@ -1277,6 +1321,9 @@ test()
   ValidateTest<jlm::tests::MemcpyTest, Steensgaard, RegionAwareMemoryNodeProvider>(
       ValidateMemcpySteensgaardRegionAware);
 
+  TestFieldSensitiveEncoding<AgnosticMemoryNodeProvider>();
+  TestFieldSensitiveEncoding<RegionAwareMemoryNodeProvider>();
+
   return 0;
 }
 
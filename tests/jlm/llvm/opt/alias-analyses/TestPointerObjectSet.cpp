@@ -10,6 +10,7 @@
 #include <jlm/llvm/opt/alias-analyses/PointerObjectSet.hpp>
 
 #include <cassert>
+#include <random>
 
 // Test the flag functions on the PointerObject class
 static void
@@ -296,6 +297,48 @@ TestSupersetOfAllPointeesConstraint()
     ;
   assert(set.GetPointsToSet(reg1).Size() == 2);
   assert(set.GetPointsToSet(reg1).Contains(alloca2));
+
+  // Makes reg0 = *reg2, where reg2 points to external, but none of its pointees point to external
+  set.GetPointerObject(reg2).MarkAsPointsToExternal();
+  SupersetOfAllPointeesConstraint c2(reg0, reg2);
+  assert(!set.GetPointerObject(reg0).PointsToExternal());
+  assert(c2.Apply(set));
+  // Loading from external memory can yield a pointer to any external memory
+  assert(set.GetPointerObject(reg0).PointsToExternal());
+  assert(!set.GetPointerObject(alloca2).PointsToExternal());
+}
+
+// Tests that both solvers let a load from a pointer to external point to external
+static void
+TestLoadFromExternal()
+{
+  using namespace jlm::llvm::aa;
+
+  jlm::tests::NAllocaNodesTest rvsdg(2);
+  rvsdg.InitializeTest();
+
+  for (bool solveNaively : { false, true })
+  {
+    // Arrange
+    PointerObjectSet set;
+    auto reg0 = set.CreateRegisterPointerObject(rvsdg.GetAllocaOutput(0));
+    auto reg1 = set.CreateRegisterPointerObject(rvsdg.GetAllocaOutput(1));
+
+    // reg0 is a pointer argument, and reg1 = *reg0
+    PointerObjectConstraintSet constraints(set);
+    constraints.AddPointsToExternalConstraint(reg0);
+    constraints.AddConstraint(SupersetOfAllPointeesConstraint(reg1, reg0));
+
+    // Act
+    if (solveNaively)
+      constraints.SolveNaively();
+    else
+      constraints.Solve();
+
+    // Assert
+    assert(set.GetPointerObject(reg1).PointsToExternal());
+    assert(set.GetPointsToSet(reg1).Size() == 0);
+  }
 }
 
 static void
@@ -499,6 +542,90 @@ TestPointerObjectConstraintSetSolve()
   assert(set.GetPointerObject(reg[10]).PointsToExternal());
 }
 
+// Tests that the worklist solver and the naive solver produce identical solutions
+static void
+TestCompareSolvers()
+{
+  using namespace jlm::llvm::aa;
+
+  constexpr size_t numAllocas = 64;
+  jlm::tests::NAllocaNodesTest rvsdg(numAllocas);
+  rvsdg.InitializeTest();
+
+  for (unsigned seed = 0; seed < 20; seed++)
+  {
+    // Arrange
+    PointerObjectSet set1, set2;
+    std::vector<PointerObject::Index> registers, memoryObjects;
+    for (size_t i = 0; i < numAllocas; i++)
+    {
+      registers.push_back(set1.CreateRegisterPointerObject(rvsdg.GetAllocaOutput(i)));
+      memoryObjects.push_back(set1.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(i)));
+      set2.CreateRegisterPointerObject(rvsdg.GetAllocaOutput(i));
+      set2.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(i));
+    }
+
+    PointerObjectConstraintSet constraints1(set1), constraints2(set2);
+
+    std::mt19937 random(seed);
+    auto anyObject = [&]()
+    {
+      return random() % set1.NumPointerObjects();
+    };
+    auto anyRegister = [&]()
+    {
+      return registers[random() % registers.size()];
+    };
+    auto anyMemoryObject = [&]()
+    {
+      return memoryObjects[random() % memoryObjects.size()];
+    };
+
+    for (size_t i = 0; i < numAllocas; i++)
+    {
+      auto pointer = anyObject(), pointee = anyMemoryObject();
+      constraints1.AddPointerPointeeConstraint(pointer, pointee);
+      constraints2.AddPointerPointeeConstraint(pointer, pointee);
+    }
+
+    for (size_t i = 0; i < 3; i++)
+    {
+      auto pointer = anyRegister(), escapingRegister = anyRegister();
+      constraints1.AddPointsToExternalConstraint(pointer);
+      constraints2.AddPointsToExternalConstraint(pointer);
+      constraints1.AddRegisterContentEscapedConstraint(escapingRegister);
+      constraints2.AddRegisterContentEscapedConstraint(escapingRegister);
+    }
+
+    for (size_t i = 0; i < 2 * numAllocas; i++)
+    {
+      auto a = anyObject(), b = anyObject();
+      PointerObjectConstraintSet::ConstraintVariant constraint = SupersetConstraint(a, b);
+      if (i % 3 == 1)
+        constraint = AllPointeesPointToSupersetConstraint(a, b);
+      else if (i % 3 == 2)
+        constraint = SupersetOfAllPointeesConstraint(a, b);
+
+      constraints1.AddConstraint(constraint);
+      constraints2.AddConstraint(constraint);
+    }
+
+    // Act
+    constraints1.Solve();
+    constraints2.SolveNaively();
+
+    // Assert
+    for (PointerObject::Index idx = 0; idx < set1.NumPointerObjects(); idx++)
+    {
+      assert(set1.GetPointsToSet(idx) == set2.GetPointsToSet(idx));
+      assert(
+          set1.GetPointerObject(idx).PointsToExternal()
+          == set2.GetPointerObject(idx).PointsToExternal());
+      assert(set1.GetPointerObject(idx).HasEscaped() == set2.GetPointerObject(idx).HasEscaped());
+    }
+  }
+}
+
 static int
 TestPointerObjectSet()
 {
@@ -510,9 +637,11 @@ TestPointerObjectSet()
   TestSupersetConstraint();
   TestAllPointeesPointToSupersetConstraint();
   TestSupersetOfAllPointeesConstraint();
+  TestLoadFromExternal();
   TestAddPointsToExternalConstraint();
   TestAddRegisterContentEscapedConstraint();
   TestPointerObjectConstraintSetSolve();
+  TestCompareSolvers();
   return 0;
 }
 
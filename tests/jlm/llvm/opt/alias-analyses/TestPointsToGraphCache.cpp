@@ -0,0 +1,261 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "TestRvsdgs.hpp"
+
+#include <test-registry.hpp>
+
+#include <jlm/llvm/opt/alias-analyses/PointsToGraph.hpp>
+#include <jlm/llvm/opt/alias-analyses/PointsToGraphCache.hpp>
+#include <jlm/llvm/opt/alias-analyses/Steensgaard.hpp>
+#include <jlm/llvm/opt/DeadNodeElimination.hpp>
+#include <jlm/llvm/opt/inlining.hpp>
+#include <jlm/llvm/opt/InvariantValueRedirection.hpp>
+#include <jlm/llvm/opt/OptimizationSequence.hpp>
+#include <jlm/rvsdg/gamma.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+
+static jlm::llvm::aa::PointsToGraph &
+GetPointsToGraph(jlm::llvm::RvsdgModule & rvsdgModule)
+{
+  using namespace jlm::llvm;
+
+  aa::Steensgaard steensgaard;
+  jlm::util::StatisticsCollector statisticsCollector;
+  return aa::PointsToGraphCache::GetPointsToGraph(
+      rvsdgModule,
+      steensgaard,
+      "Steensgaard",
+      statisticsCollector);
+}
+
+static void
+TestAddCopy()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::tests::StoreTest2 test;
+  aa::Steensgaard steensgaard;
+  jlm::util::StatisticsCollector statisticsCollector;
+  auto pointsToGraph = steensgaard.Analyze(test.module(), statisticsCollector);
+
+  auto allocaX = test.alloca_x;
+  std::vector<jlm::rvsdg::output *> operands;
+  for (size_t n = 0; n < allocaX->ninputs(); n++)
+    operands.push_back(allocaX->input(n)->origin());
+  auto copy = allocaX->copy(allocaX->region(), operands);
+
+  // Act
+  pointsToGraph->AddCopy(*allocaX->output(0), *copy->output(0));
+
+  // Assert
+  auto & allocaNodeX = pointsToGraph->GetAllocaNode(*allocaX);
+  auto & allocaNodeCopy = pointsToGraph->GetAllocaNode(*copy);
+  assert(allocaNodeCopy.NumTargets() == allocaNodeX.NumTargets());
+  // The register node of the copy points to the copy instead of x
+  assert(allocaNodeCopy.NumSources() == allocaNodeX.NumSources() + 1);
+
+  // Everything that points to x also points to the copy of x
+  auto & allocaNodeP = pointsToGraph->GetAllocaNode(*test.alloca_p);
+  bool pointsToCopy = false;
+  for (auto & target : allocaNodeP.Targets())
+    pointsToCopy |= &target == &allocaNodeCopy;
+  assert(pointsToCopy);
+
+  auto & registerNodeCopy = pointsToGraph->GetRegisterNode(*copy->output(0));
+  bool registerPointsToCopy = false;
+  for (auto & target : registerNodeCopy.Targets())
+    registerPointsToCopy |= &target == &allocaNodeCopy;
+  assert(registerPointsToCopy);
+}
+
+static void
+TestInliningKeepsPointsToGraph()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::tests::CallTest1 test;
+  auto & rvsdgModule = test.module();
+  auto & pointsToGraph = GetPointsToGraph(rvsdgModule);
+  assert(pointsToGraph.NumLambdaNodes() == 3);
+
+  fctinline functionInlining;
+  DeadNodeElimination deadNodeElimination;
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  // Act
+  OptimizationSequence::CreateAndRun(
+      rvsdgModule,
+      statisticsCollector,
+      { &functionInlining, &deadNodeElimination });
+
+  // Assert
+  auto cache = rvsdgModule.GetObserver<aa::PointsToGraphCache>();
+  assert(cache != nullptr && cache->IsValid());
+
+  // The points-to graph is reused, and the nodes of the removed functions f and g are purged.
+  auto & cachedPointsToGraph = GetPointsToGraph(rvsdgModule);
+  assert(&cachedPointsToGraph == &pointsToGraph);
+  assert(cachedPointsToGraph.NumLambdaNodes() == 1);
+  assert(cachedPointsToGraph.NumAllocaNodes() == 3);
+  cachedPointsToGraph.GetLambdaNode(*test.lambda_h);
+}
+
+static void
+TestInvalidation()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::tests::CallTest1 test;
+  auto & rvsdgModule = test.module();
+  GetPointsToGraph(rvsdgModule);
+  auto cache = rvsdgModule.GetObserver<aa::PointsToGraphCache>();
+
+  InvariantValueRedirection invariantValueRedirection;
+  assert(!invariantValueRedirection.ReportsModifications());
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  // Act & Assert
+  OptimizationSequence::CreateAndRun(
+      rvsdgModule,
+      statisticsCollector,
+      { &invariantValueRedirection });
+  assert(!cache->IsValid());
+
+  auto & pointsToGraph = GetPointsToGraph(rvsdgModule);
+  assert(cache->IsValid());
+  assert(pointsToGraph.NumLambdaNodes() == 3);
+
+  rvsdgModule.InvalidateLambda(*test.lambda_h);
+  assert(!cache->IsValid());
+}
+
+static void
+TestRemovedNodesArePurged()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::tests::StoreTest2 test;
+  auto & rvsdgModule = test.module();
+  auto & pointsToGraph = GetPointsToGraph(rvsdgModule);
+  auto numAllocaNodes = pointsToGraph.NumAllocaNodes();
+  auto numRegisterNodes = pointsToGraph.NumRegisterNodes();
+
+  auto allocaX = test.alloca_x;
+  std::vector<jlm::rvsdg::output *> operands;
+  for (size_t n = 0; n < allocaX->ninputs(); n++)
+    operands.push_back(allocaX->input(n)->origin());
+  auto copy = allocaX->copy(allocaX->region(), operands);
+  rvsdgModule.NotifyOutputCopied(*allocaX->output(0), *copy->output(0));
+  rvsdgModule.NotifyOutputCopied(*allocaX->output(1), *copy->output(1));
+  assert(pointsToGraph.NumAllocaNodes() == numAllocaNodes + 1);
+  assert(pointsToGraph.NumRegisterNodes() == numRegisterNodes + 1);
+
+  // Act
+  remove(copy);
+
+  // Assert
+  // The nodes of the copy are removed as soon as it is destroyed, and the graph stays valid.
+  auto cache = rvsdgModule.GetObserver<aa::PointsToGraphCache>();
+  assert(cache->IsValid());
+  assert(pointsToGraph.NumAllocaNodes() == numAllocaNodes);
+  assert(pointsToGraph.NumRegisterNodes() == numRegisterNodes);
+}
+
+static void
+TestStructuralNodeCopy()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::tests::GammaTest test;
+  auto & rvsdgModule = test.module();
+  auto & pointsToGraph = GetPointsToGraph(rvsdgModule);
+  auto cache = rvsdgModule.GetObserver<aa::PointsToGraphCache>();
+
+  // Act
+  jlm::rvsdg::substitution_map smap;
+  auto rootRegion = rvsdgModule.Rvsdg().root();
+  test.lambda->copy(rootRegion, smap);
+  rvsdgModule.NotifyRegionCopied(*rootRegion, smap);
+
+  // Assert
+  // The outputs within the copied gamma node are matched with the original outputs.
+  assert(cache->IsValid());
+  auto lambdaCopy = jlm::util::AssertedCast<lambda::node>(
+      jlm::rvsdg::node_output::node(smap.lookup(test.lambda->output())));
+  jlm::rvsdg::gamma_node * gammaCopy = nullptr;
+  for (auto & node : lambdaCopy->subregion()->nodes)
+  {
+    if (auto gammaNode = dynamic_cast<jlm::rvsdg::gamma_node *>(&node))
+      gammaCopy = gammaNode;
+  }
+  assert(gammaCopy != nullptr);
+
+  for (size_t n = 0; n < test.gamma->nsubregions(); n++)
+  {
+    auto subregion = test.gamma->subregion(n);
+    auto subregionCopy = gammaCopy->subregion(n);
+    for (size_t i = 0; i < subregion->narguments(); i++)
+    {
+      auto & registerNode = pointsToGraph.GetRegisterNode(*subregion->argument(i));
+      auto & copyRegisterNode = pointsToGraph.GetRegisterNode(*subregionCopy->argument(i));
+      assert(&copyRegisterNode == &registerNode);
+    }
+  }
+}
+
+static void
+TestInvalidatedLambdaIsRemoved()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::tests::CallTest1 test;
+  auto & rvsdgModule = test.module();
+  GetPointsToGraph(rvsdgModule);
+  auto cache = rvsdgModule.GetObserver<aa::PointsToGraphCache>();
+
+  fctinline functionInlining;
+  DeadNodeElimination deadNodeElimination;
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  // Act
+  rvsdgModule.InvalidateLambda(*test.lambda_g);
+  assert(!cache->IsValid() && cache->NumInvalidatedLambdas() == 1);
+
+  OptimizationSequence::CreateAndRun(
+      rvsdgModule,
+      statisticsCollector,
+      { &functionInlining, &deadNodeElimination });
+
+  // Assert
+  // The invalidation of g is discarded with g, but g was inlined into h, and the copies of its
+  // outputs in h render h invalid.
+  assert(!cache->IsValid() && cache->NumInvalidatedLambdas() == 1);
+}
+
+static int
+TestPointsToGraphCache()
+{
+  TestAddCopy();
+  TestInliningKeepsPointsToGraph();
+  TestInvalidation();
+  TestRemovedNodesArePurged();
+  TestStructuralNodeCopy();
+  TestInvalidatedLambdaIsRemoved();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/alias-analyses/TestPointsToGraphCache",
+    TestPointsToGraphCache)
@@ -1463,6 +1463,51 @@ TestStatistics()
   assert(memoryNodeProvisioningStatistics.GetPropagationPass1Time() != 0);
   assert(memoryNodeProvisioningStatistics.GetPropagationPass2Time() != 0);
   assert(memoryNodeProvisioningStatistics.GetResolveUnknownMemoryNodeReferencesTime() != 0);
+  assert(memoryNodeProvisioningStatistics.GetMaterializationTime() != 0);
+  assert(memoryNodeProvisioningStatistics.NumThreads() == 1);
+}
+
+static void
+TestParallelProvisioning()
+{
+  using namespace jlm::llvm::aa;
+
+  /*
+   * Arrange
+   */
+  jlm::tests::PhiTest2 test;
+  auto pointsToGraph = RunSteensgaard(test.module());
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  /*
+   * Act
+   */
+  RegionAwareMemoryNodeProvider sequentialProvider(1);
+  auto sequentialProvisioning =
+      sequentialProvider.ProvisionMemoryNodes(test.module(), *pointsToGraph, statisticsCollector);
+
+  RegionAwareMemoryNodeProvider parallelProvider(4);
+  auto parallelProvisioning =
+      parallelProvider.ProvisionMemoryNodes(test.module(), *pointsToGraph, statisticsCollector);
+
+  /*
+   * Assert
+   */
+  for (auto lambdaNode : { &test.GetLambdaEight(),
+                           &test.GetLambdaI(),
+                           &test.GetLambdaA(),
+                           &test.GetLambdaB(),
+                           &test.GetLambdaC(),
+                           &test.GetLambdaD(),
+                           &test.GetLambdaTest() })
+  {
+    AssertMemoryNodes(
+        parallelProvisioning->GetLambdaEntryNodes(*lambdaNode),
+        sequentialProvisioning->GetLambdaEntryNodes(*lambdaNode));
+    AssertMemoryNodes(
+        parallelProvisioning->GetLambdaExitNodes(*lambdaNode),
+        sequentialProvisioning->GetLambdaExitNodes(*lambdaNode));
+  }
 }
 
 static int
@@ -1501,6 +1546,8 @@ TestRegionAwareMemoryNodeProvider()
 
   TestStatistics();
 
+  TestParallelProvisioning();
+
   return 0;
 }
 
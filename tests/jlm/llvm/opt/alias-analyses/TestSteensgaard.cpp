@@ -1112,6 +1112,80 @@ TestLinkedList()
   validatePointsToGraph(*pointsToGraph, test);
 }
 
+static void
+TestFieldSensitivity()
+{
+  using namespace jlm::llvm::aa;
+
+  // Arrange
+  jlm::tests::StructFieldTest test;
+
+  // Act
+  Steensgaard steensgaard(true);
+  jlm::util::StatisticsCollector statisticsCollector;
+  auto pointsToGraph = steensgaard.Analyze(test.module(), statisticsCollector);
+
+  // Assert
+  assert(pointsToGraph->NumAllocaNodes() == 3);
+  assert(pointsToGraph->NumFieldNodes() == 1);
+
+  auto & allocaA = pointsToGraph->GetAllocaNode(test.GetAllocaA());
+  auto & allocaB = pointsToGraph->GetAllocaNode(test.GetAllocaB());
+  auto & allocaP = pointsToGraph->GetAllocaNode(test.GetAllocaP());
+  auto & secondField = pointsToGraph->GetFieldNode(allocaP, 8);
+
+  assertTargets(allocaP, { &allocaA });
+  assertTargets(secondField, { &allocaB });
+
+  assertTargets(pointsToGraph->GetRegisterNode(test.GetFirstAddress()), { &allocaP });
+  assertTargets(pointsToGraph->GetRegisterNode(test.GetSecondAddress()), { &secondField });
+  assertTargets(pointsToGraph->GetRegisterNode(*test.GetLoad().output(0)), { &allocaB });
+
+  // The field-insensitive analysis merges the targets of both fields
+  auto fieldInsensitivePointsToGraph = RunSteensgaard(test.module());
+  assert(fieldInsensitivePointsToGraph->NumFieldNodes() == 0);
+  assertTargets(
+      fieldInsensitivePointsToGraph->GetRegisterNode(*test.GetLoad().output(0)),
+      { &fieldInsensitivePointsToGraph->GetAllocaNode(test.GetAllocaA()),
+        &fieldInsensitivePointsToGraph->GetAllocaNode(test.GetAllocaB()) });
+}
+
+static void
+TestFieldCollapse()
+{
+  using namespace jlm::llvm::aa;
+  using Access = jlm::tests::StructFieldTest::Access;
+
+  auto test = [](Access access)
+  {
+    // Arrange
+    jlm::tests::StructFieldTest test(access);
+
+    // Act
+    Steensgaard steensgaard(true);
+    jlm::util::StatisticsCollector statisticsCollector;
+    auto pointsToGraph = steensgaard.Analyze(test.module(), statisticsCollector);
+
+    // Assert
+    assert(pointsToGraph->NumFieldNodes() == 0);
+
+    auto & allocaA = pointsToGraph->GetAllocaNode(test.GetAllocaA());
+    auto & allocaB = pointsToGraph->GetAllocaNode(test.GetAllocaB());
+    auto & allocaP = pointsToGraph->GetAllocaNode(test.GetAllocaP());
+
+    assertTargets(allocaP, { &allocaA, &allocaB });
+    assertTargets(
+        pointsToGraph->GetRegisterNode(*test.GetLoad().output(0)),
+        { &allocaA, &allocaB });
+  };
+
+  test(Access::AggregateStore);
+  test(Access::AggregateLoad);
+  test(Access::Memcpy);
+  test(Access::Theta);
+  test(Access::OverlappingStore);
+}
+
 static void
 TestStatistics()
 {
@@ -1177,6 +1251,9 @@ TestSteensgaardAnalysis()
 
   TestLinkedList();
 
+  TestFieldSensitivity();
+  TestFieldCollapse();
+
   TestStatistics();
 
   return 0;
@@ -383,6 +383,86 @@ test_theta5()
   assert(region->result(2)->origin() == region->result(3)->origin());
 }
 
+static inline void
+test_wide_theta()
+{
+  using namespace jlm::llvm;
+
+  jlm::tests::valuetype vt;
+  jlm::rvsdg::ctltype ct(2);
+
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto & graph = rm.Rvsdg();
+  auto nf = graph.node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto c = graph.add_import({ ct, "c" });
+  auto x = graph.add_import({ vt, "x" });
+
+  auto theta = jlm::rvsdg::theta_node::create(graph.root());
+  auto region = theta->subregion();
+
+  auto lvc = theta->add_loopvar(c);
+
+  // All loop variables start with x. The even ones are updated with a unary operation, and the odd
+  // ones with a binary operation, which splits them into two classes.
+  const size_t numLoopVars = 200;
+  std::vector<jlm::rvsdg::theta_output *> loopVars;
+  for (size_t n = 0; n < numLoopVars; n++)
+    loopVars.push_back(theta->add_loopvar(x));
+
+  for (size_t n = 0; n < numLoopVars; n++)
+  {
+    auto argument = loopVars[n]->argument();
+    auto operands = n % 2 == 0 ? std::vector<jlm::rvsdg::output *>({ argument })
+                               : std::vector<jlm::rvsdg::output *>({ argument, argument });
+    auto output = jlm::tests::create_testop(region, operands, { &vt })[0];
+    loopVars[n]->result()->divert_to(output);
+  }
+
+  theta->set_predicate(lvc->argument());
+
+  for (auto loopVar : loopVars)
+    graph.add_export(loopVar, { loopVar->type(), "" });
+
+  jlm::llvm::cne cne;
+  cne.run(rm, statisticsCollector);
+
+  for (size_t n = 2; n < numLoopVars; n++)
+  {
+    auto result = graph.root()->result(n)->origin();
+    assert(result == graph.root()->result(n % 2)->origin());
+  }
+  assert(graph.root()->result(0)->origin() != graph.root()->result(1)->origin());
+}
+
+static inline void
+test_congruent_constants()
+{
+  using namespace jlm::llvm;
+
+  jlm::tests::valuetype vt;
+
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto & graph = rm.Rvsdg();
+  auto nf = graph.node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  const size_t numConstants = 100000;
+  for (size_t n = 0; n < numConstants; n++)
+  {
+    auto constant = jlm::tests::create_testop(graph.root(), {}, { &vt })[0];
+    graph.add_export(constant, { constant->type(), "" });
+  }
+
+  jlm::llvm::cne cne;
+  cne.run(rm, statisticsCollector);
+
+  auto origin = graph.root()->result(0)->origin();
+  for (size_t n = 1; n < numConstants; n++)
+    assert(graph.root()->result(n)->origin() == origin);
+}
+
 static inline void
 test_lambda()
 {
@@ -477,6 +557,8 @@ verify()
   test_theta3();
   test_theta4();
   test_theta5();
+  test_wide_theta();
+  test_congruent_constants();
   test_lambda();
   test_phi();
 
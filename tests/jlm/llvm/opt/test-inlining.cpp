@@ -3,12 +3,14 @@
  * See COPYING for terms of redistribution.
  */
 
+#include "TestRvsdgs.hpp"
 #include "test-operation.hpp"
 #include "test-registry.hpp"
 #include "test-types.hpp"
 
 #include <jlm/rvsdg/control.hpp>
 #include <jlm/rvsdg/gamma.hpp>
+#include <jlm/rvsdg/theta.hpp>
 #include <jlm/rvsdg/view.hpp>
 
 #include <jlm/llvm/ir/operators.hpp>
@@ -113,6 +115,8 @@ test1()
    * Assert
    */
   assert(!jlm::rvsdg::region::Contains<CallOperation>(*graph.root(), true));
+  // The inlined function f1 is removed as its only call was inlined
+  assert(graph.root()->nnodes() == 1);
 }
 
 static void
@@ -194,11 +198,210 @@ test2()
   assert(is<CallOperation>(jlm::rvsdg::node_output::node(f2->node()->fctresult(0)->origin())));
 }
 
+/**
+ * Creates an exported function that applies a chain of \p size operations to its argument.
+ */
+static jlm::llvm::lambda::output *
+SetupChainFunction(jlm::rvsdg::graph & graph, const std::string & name, size_t size)
+{
+  using namespace jlm::llvm;
+
+  jlm::tests::valuetype vt;
+  iostatetype iOStateType;
+  MemoryStateType memoryStateType;
+  loopstatetype loopStateType;
+  FunctionType functionType(
+      { &vt, &iOStateType, &memoryStateType, &loopStateType },
+      { &vt, &iOStateType, &memoryStateType, &loopStateType });
+
+  auto lambda = lambda::node::create(graph.root(), functionType, name, linkage::external_linkage);
+
+  jlm::rvsdg::output * value = lambda->fctargument(0);
+  for (size_t n = 0; n < size; n++)
+    value = jlm::tests::test_op::create(lambda->subregion(), { value }, { &vt })->output(0);
+
+  auto output = lambda->finalize(
+      { value, lambda->fctargument(1), lambda->fctargument(2), lambda->fctargument(3) });
+  graph.add_export(output, { output->type(), name });
+
+  return output;
+}
+
+/**
+ * Creates an exported function that calls \p callee, either directly or within a theta node if
+ * \p inLoop is true. The first argument of the call is a constant if \p constantArgument is true.
+ */
+static jlm::llvm::lambda::output *
+SetupCallerFunction(
+    jlm::rvsdg::graph & graph,
+    jlm::llvm::lambda::output * callee,
+    bool inLoop,
+    bool constantArgument = false)
+{
+  using namespace jlm::llvm;
+
+  auto lambda = lambda::node::create(
+      graph.root(),
+      callee->node()->type(),
+      "caller",
+      linkage::external_linkage);
+  auto ctxVar = lambda->add_ctxvar(callee);
+
+  std::vector<jlm::rvsdg::output *> arguments;
+  for (size_t n = 0; n < lambda->nfctarguments(); n++)
+    arguments.push_back(lambda->fctargument(n));
+
+  if (constantArgument)
+  {
+    jlm::tests::valuetype vt;
+    arguments[0] = jlm::tests::test_op::create(lambda->subregion(), {}, { &vt })->output(0);
+  }
+
+  std::vector<jlm::rvsdg::output *> results;
+  if (inLoop)
+  {
+    auto theta = jlm::rvsdg::theta_node::create(lambda->subregion());
+    auto loopVarF = theta->add_loopvar(ctxVar);
+
+    std::vector<jlm::rvsdg::theta_output *> loopVars;
+    std::vector<jlm::rvsdg::output *> loopArguments;
+    for (auto argument : arguments)
+    {
+      loopVars.push_back(theta->add_loopvar(argument));
+      loopArguments.push_back(loopVars.back()->argument());
+    }
+
+    auto callResults =
+        CallNode::Create(loopVarF->argument(), callee->node()->type(), loopArguments);
+    for (size_t n = 0; n < loopVars.size(); n++)
+    {
+      loopVars[n]->result()->divert_to(callResults[n]);
+      results.push_back(loopVars[n]);
+    }
+    theta->set_predicate(jlm::rvsdg::control_false(theta->subregion()));
+  }
+  else
+  {
+    results = CallNode::Create(ctxVar, callee->node()->type(), arguments);
+  }
+
+  auto output = lambda->finalize(results);
+  graph.add_export(output, { output->type(), "caller" });
+
+  return output;
+}
+
+static void
+TestThreshold()
+{
+  using namespace jlm::llvm;
+
+  auto inlineCalls = [](size_t calleeSize, const InliningSettings & settings)
+  {
+    RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+    auto & graph = rvsdgModule.Rvsdg();
+    auto callee = SetupChainFunction(graph, "callee", calleeSize);
+    auto caller = SetupCallerFunction(graph, callee, false);
+
+    fctinline fctinline(settings);
+    fctinline.run(rvsdgModule, statisticsCollector);
+
+    return !jlm::rvsdg::region::Contains<CallOperation>(*caller->node()->subregion(), true);
+  };
+
+  // The callee is exported and therefore not removed after inlining. Its call is only inlined if
+  // the callee is small enough.
+  assert(inlineCalls(4, InliningSettings(4, 0, 0)));
+  assert(!inlineCalls(5, InliningSettings(4, 0, 0)));
+  assert(inlineCalls(InliningSettings::DefaultThreshold, InliningSettings()));
+}
+
+static void
+TestLoopBonus()
+{
+  using namespace jlm::llvm;
+
+  auto inlineCalls = [](bool inLoop)
+  {
+    RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+    auto & graph = rvsdgModule.Rvsdg();
+    auto callee = SetupChainFunction(graph, "callee", 10);
+    auto caller = SetupCallerFunction(graph, callee, inLoop);
+
+    fctinline fctinline(InliningSettings(4, 8, 0));
+    fctinline.run(rvsdgModule, statisticsCollector);
+
+    return !jlm::rvsdg::region::Contains<CallOperation>(*caller->node()->subregion(), true);
+  };
+
+  assert(!inlineCalls(false));
+  assert(inlineCalls(true));
+}
+
+static void
+TestConstantArgumentBonus()
+{
+  using namespace jlm::llvm;
+
+  auto inlineCalls = [](bool constantArgument)
+  {
+    RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+    auto & graph = rvsdgModule.Rvsdg();
+    auto callee = SetupChainFunction(graph, "callee", 10);
+    auto caller = SetupCallerFunction(graph, callee, false, constantArgument);
+
+    jlm::util::StatisticsCollectorSettings statisticsCollectorSettings(
+        jlm::util::filepath(""),
+        { jlm::util::Statistics::Id::FunctionInlining });
+    jlm::util::StatisticsCollector statisticsCollector(statisticsCollectorSettings);
+
+    fctinline fctinline(InliningSettings(4, 0, 8));
+    fctinline.run(rvsdgModule, statisticsCollector);
+
+    auto inlined = !jlm::rvsdg::region::Contains<CallOperation>(*caller->node()->subregion(), true);
+
+    // The statistics report the number of inlined calls
+    assert(statisticsCollector.NumCollectedStatistics() == 1);
+    auto & statistics = *statisticsCollector.CollectedStatistics().begin();
+    auto expectedCount = inlined ? "#InlinedCalls:1" : "#InlinedCalls:0";
+    assert(statistics.ToString().find(expectedCount) != std::string::npos);
+
+    return inlined;
+  };
+
+  // Only the constant argument lifts the threshold above the size of the callee
+  assert(!inlineCalls(false));
+  assert(inlineCalls(true));
+}
+
+static void
+TestRecursiveCalls()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::tests::PhiTest1 test;
+  auto & rvsdgModule = test.module();
+
+  // Act
+  fctinline fctinline(InliningSettings(1000, 0, 0));
+  fctinline.run(rvsdgModule, statisticsCollector);
+
+  // Assert
+  // Neither the recursive calls of fib, nor the call of fib from outside the phi node is inlined.
+  assert(jlm::rvsdg::region::Contains<CallOperation>(*test.lambda_fib->subregion(), true));
+  assert(jlm::rvsdg::region::Contains<CallOperation>(*test.lambda_test->subregion(), true));
+}
+
 static int
 verify()
 {
   test1();
   test2();
+  TestThreshold();
+  TestLoopBonus();
+  TestConstantArgumentBonus();
+  TestRecursiveCalls();
 
   return 0;
 }
@@ -13,11 +13,14 @@
 #include <jlm/rvsdg/theta.hpp>
 #include <jlm/rvsdg/traverser.hpp>
 
+#include <jlm/llvm/ir/operators/lambda.hpp>
 #include <jlm/llvm/ir/RvsdgModule.hpp>
 #include <jlm/llvm/opt/DeadNodeElimination.hpp>
 #include <jlm/llvm/opt/unroll.hpp>
 #include <jlm/util/Statistics.hpp>
 
+#include <sstream>
+
 static jlm::util::StatisticsCollector statisticsCollector;
 
 static size_t
@@ -412,6 +415,129 @@ test_nested_theta()
   assert(thetas.size() == 3 && nthetas(thetas[0]->subregion()) == 8);
 }
 
+static void
+test_per_loop_factors()
+{
+  using namespace jlm::llvm;
+
+  jlm::rvsdg::bittype bt32(32);
+  jlm::rvsdg::bitult_op ult(bt32);
+  jlm::rvsdg::bitadd_op add(32);
+
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto & graph = rm.Rvsdg();
+
+  auto nf = graph.node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto init = jlm::rvsdg::create_bitconstant(graph.root(), 32, 0);
+  auto step = jlm::rvsdg::create_bitconstant(graph.root(), 32, 1);
+  auto end4 = jlm::rvsdg::create_bitconstant(graph.root(), 32, 4);
+  auto end100 = jlm::rvsdg::create_bitconstant(graph.root(), 32, 100);
+
+  /*
+    Three sibling loops: two with four iterations and one with 100 iterations
+  */
+  auto theta1 = create_theta(ult, add, init, step, end4);
+  auto theta2 = create_theta(ult, add, init, step, end100);
+  auto theta3 = create_theta(ult, add, init, step, end4);
+  graph.add_export(theta1->output(0), { bt32, "x1" });
+  graph.add_export(theta2->output(0), { bt32, "x2" });
+  graph.add_export(theta3->output(0), { bt32, "x3" });
+
+  loopunroll loopunroll(UnrollSettings(2, 4, 256));
+  loopunroll.run(rm, statisticsCollector);
+
+  /*
+    Both loops with four iterations are completely unrolled, and the loop with 100 iterations is
+    unrolled by the factor, which divides its number of iterations.
+  */
+  auto thetas = find_thetas(graph.root());
+  assert(thetas.size() == 1);
+  assert(thetas[0]->subregion()->nnodes() >= 4);
+  assert(jlm::rvsdg::node_output::node(graph.root()->result(1)->origin()) == thetas[0]);
+  assert(!jlm::rvsdg::is<jlm::rvsdg::theta_op>(
+      jlm::rvsdg::node_output::node(graph.root()->result(0)->origin())));
+}
+
+/*
+  Creates a loop with an unknown number of iterations in region.
+*/
+static jlm::rvsdg::theta_node *
+create_unknown_theta(jlm::rvsdg::output * x, jlm::rvsdg::output * y)
+{
+  auto theta = jlm::rvsdg::theta_node::create(x->region());
+  auto lv1 = theta->add_loopvar(x);
+  auto lv2 = theta->add_loopvar(y);
+
+  auto one = jlm::rvsdg::create_bitconstant(theta->subregion(), 32, 1);
+  auto add = jlm::rvsdg::bitadd_op::create(32, lv1->argument(), one);
+  auto cmp = jlm::rvsdg::bitult_op::create(32, add, lv2->argument());
+  auto match = jlm::rvsdg::match(1, { { 1, 0 } }, 1, 2, cmp);
+
+  lv1->result()->divert_to(add);
+  theta->set_predicate(match);
+
+  return theta;
+}
+
+static void
+test_profile()
+{
+  using namespace jlm::llvm;
+
+  jlm::rvsdg::bittype bt32(32);
+  std::vector<const jlm::rvsdg::type *> types({ &bt32, &bt32 });
+  FunctionType functionType(types, types);
+
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto & graph = rm.Rvsdg();
+
+  /*
+    The first loop of f runs one iteration, while the second one runs many.
+  */
+  auto lambda = lambda::node::create(graph.root(), functionType, "f", linkage::external_linkage);
+  auto theta1 = create_unknown_theta(lambda->fctargument(0), lambda->fctargument(1));
+  auto theta2 = create_unknown_theta(lambda->fctargument(0), lambda->fctargument(1));
+  auto output = lambda->finalize({ theta1->output(0), theta2->output(0) });
+  graph.add_export(output, { output->type(), "f" });
+
+  std::istringstream stream("# function loop iterations\n"
+                            "\n"
+                            "f 0 1\n"
+                            "f 1 1000\n");
+  auto profile = UnrollProfile::Parse(stream);
+  assert(profile.NumLoops() == 2);
+
+  loopunroll loopunroll(UnrollSettings(2, 4, 256));
+  loopunroll.run(rm, profile, statisticsCollector);
+
+  /*
+    Only the second loop is unrolled, which creates gamma nodes for the unrolled and the residual
+    iterations.
+  */
+  auto & fctresult0 = *lambda->fctresult(0);
+  auto & fctresult1 = *lambda->fctresult(1);
+  assert(jlm::rvsdg::node_output::node(fctresult0.origin()) == theta1);
+  assert(jlm::rvsdg::is<jlm::rvsdg::gamma_op>(jlm::rvsdg::node_output::node(fctresult1.origin())));
+
+  for (auto malformedProfile :
+       { "f 0\n", "f 0 -1\n", "f 0 1 2\n", "f 0 99999999999999999999999\n" })
+  {
+    bool errorCaught = false;
+    try
+    {
+      std::istringstream malformedStream(malformedProfile);
+      UnrollProfile::Parse(malformedStream);
+    }
+    catch (jlm::util::error &)
+    {
+      errorCaught = true;
+    }
+    assert(errorCaught);
+  }
+}
+
 static int
 verify()
 {
@@ -420,6 +546,8 @@ verify()
   test_nested_theta();
   test_known_boundaries();
   test_unknown_boundaries();
+  test_per_loop_factors();
+  test_profile();
 
   return 0;
 }
@@ -0,0 +1,141 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-operation.hpp"
+#include "test-registry.hpp"
+#include "test-types.hpp"
+
+#include <jlm/rvsdg/NodeSideTable.hpp>
+
+#include <cassert>
+#include <string>
+#include <vector>
+
+/**
+ * Test that node identifiers are dense and recycled.
+ */
+static void
+TestNodeIds()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  jlm::tests::valuetype valueType;
+  jlm::rvsdg::graph rvsdg;
+
+  auto node0 = jlm::tests::test_op::create(rvsdg.root(), {}, { &valueType });
+  auto node1 = jlm::tests::test_op::create(rvsdg.root(), {}, { &valueType });
+  auto node2 = jlm::tests::test_op::create(rvsdg.root(), {}, { &valueType });
+
+  assert(node0->GetId() == 0);
+  assert(node1->GetId() == 1);
+  assert(node2->GetId() == 2);
+  assert(rvsdg.NumNodeIds() == 3);
+
+  // Act
+  remove(node1);
+  auto node3 = jlm::tests::test_op::create(rvsdg.root(), {}, { &valueType });
+
+  // Assert
+  assert(node3->GetId() == 1);
+  assert(rvsdg.NumNodeIds() == 3);
+}
+
+static void
+TestNodeSideTable()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  jlm::tests::valuetype valueType;
+  jlm::rvsdg::graph rvsdg;
+
+  auto node0 = jlm::tests::test_op::create(rvsdg.root(), {}, { &valueType });
+  auto node1 = jlm::tests::test_op::create(rvsdg.root(), {}, { &valueType });
+  auto node2 = jlm::tests::test_op::create(rvsdg.root(), {}, { &valueType });
+
+  NodeSideTable<std::string> table;
+
+  // Act & Assert
+  assert(table.Size() == 0);
+  assert(!table.Contains(*node0));
+
+  assert(table.Insert(*node2, "node2"));
+  assert(!table.Insert(*node2, "n2"));
+  assert(table.Contains(*node2));
+  assert(!table.Contains(*node1));
+  assert(table.Lookup(*node2) == "n2");
+
+  table[*node0] += "node0";
+  assert(table.Lookup(*node0) == "node0");
+  assert(table.Size() == 2);
+
+  assert(table.Remove(*node2));
+  assert(!table.Remove(*node2));
+  assert(!table.Contains(*node2));
+  assert(table.Size() == 1);
+
+  table.Clear();
+  assert(table.Size() == 0);
+  assert(!table.Contains(*node0));
+}
+
+/**
+ * Test a table whose nodes have identifiers that are far apart, as well as the transition of its
+ * entries into the dense range of identifiers once the table is populated.
+ */
+static void
+TestDistantNodeIds()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  jlm::tests::valuetype valueType;
+  jlm::rvsdg::graph rvsdg;
+
+  std::vector<jlm::rvsdg::node *> nodes;
+  for (size_t n = 0; n < 1000; n++)
+    nodes.push_back(jlm::tests::test_op::create(rvsdg.root(), {}, { &valueType }));
+
+  NodeSideTable<size_t> table;
+
+  // Act & Assert
+  assert(table.Insert(*nodes[500], 500));
+  assert(table.Insert(*nodes[999], 999));
+  assert(table.Insert(*nodes[0], 0));
+  assert(table.Insert(*nodes[501], 501));
+  assert(table.Size() == 4);
+  assert(!table.Contains(*nodes[1]));
+  assert(table.Lookup(*nodes[999]) == 999);
+
+  assert(table.Remove(*nodes[999]));
+  assert(!table.Contains(*nodes[999]));
+
+  for (size_t n = 0; n < nodes.size(); n++)
+    table[*nodes[n]] = n;
+
+  assert(table.Size() == nodes.size());
+  for (size_t n = 0; n < nodes.size(); n++)
+    assert(table.Lookup(*nodes[n]) == n);
+
+  for (size_t n = 0; n < nodes.size(); n += 2)
+    assert(table.Remove(*nodes[n]));
+
+  assert(table.Size() == nodes.size() / 2);
+  for (size_t n = 0; n < nodes.size(); n++)
+    assert(table.Contains(*nodes[n]) == (n % 2 == 1));
+}
+
+static int
+TestNodeSideTables()
+{
+  TestNodeIds();
+  TestNodeSideTable();
+  TestDistantNodeIds();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/rvsdg/TestNodeSideTable", TestNodeSideTables)
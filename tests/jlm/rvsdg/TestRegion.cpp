@@ -7,6 +7,8 @@
 #include "test-registry.hpp"
 #include "test-types.hpp"
 
+#include <jlm/rvsdg/substitution.hpp>
+
 #include <cassert>
 
 /**
@@ -277,6 +279,113 @@ TestPruneArguments()
   assert(region.narguments() == 0);
 }
 
+/**
+ * Test that the CSE index of a region stays consistent when inputs are diverted and nodes are
+ * removed.
+ */
+static void
+TestFindCongruentNode()
+{
+  using namespace jlm::tests;
+
+  // Arrange
+  valuetype valueType;
+
+  jlm::rvsdg::graph rvsdg;
+  auto import1 = rvsdg.add_import({ valueType, "i1" });
+  auto import2 = rvsdg.add_import({ valueType, "i2" });
+
+  test_op unaryOperation({ &valueType }, { &valueType });
+  test_op nullaryOperation({}, { &valueType });
+
+  auto node1 = test_op::Create(rvsdg.root(), { &valueType }, { import1 }, { &valueType });
+  auto node2 = test_op::Create(rvsdg.root(), { &valueType }, { import2 }, { &valueType });
+  auto node3 = test_op::Create(rvsdg.root(), {}, {}, { &valueType });
+
+  // Act & Assert
+  assert(rvsdg.root()->FindCongruentNode(unaryOperation, { import1 }) == node1);
+  assert(rvsdg.root()->FindCongruentNode(unaryOperation, { import2 }) == node2);
+  assert(rvsdg.root()->FindCongruentNode(nullaryOperation, {}) == node3);
+
+  node2->input(0)->divert_to(import1);
+  assert(rvsdg.root()->FindCongruentNode(unaryOperation, { import2 }) == nullptr);
+
+  rvsdg.root()->remove_node(node1);
+  assert(rvsdg.root()->FindCongruentNode(unaryOperation, { import1 }) == node2);
+
+  rvsdg.root()->remove_node(node3);
+  assert(rvsdg.root()->FindCongruentNode(nullaryOperation, {}) == nullptr);
+}
+
+/**
+ * Test that region::copy() copies all nodes in top-down order and maps their outputs, and that the
+ * CSE index of the target region is consistent after the copy.
+ */
+static void
+TestCopy()
+{
+  using namespace jlm::tests;
+
+  // Arrange
+  valuetype valueType;
+  test_op unaryOperation({ &valueType }, { &valueType });
+
+  jlm::rvsdg::graph rvsdg;
+  auto import = rvsdg.add_import({ valueType, "i" });
+
+  std::vector<jlm::rvsdg::node *> nodes;
+  jlm::rvsdg::output * origin = import;
+  for (size_t n = 0; n < 16; n++)
+  {
+    auto node = test_op::Create(rvsdg.root(), { &valueType }, { origin }, { &valueType });
+    nodes.push_back(node);
+    origin = node->output(0);
+  }
+  rvsdg.add_export(origin, { valueType, "e" });
+
+  jlm::rvsdg::graph targetRvsdg;
+  auto targetImport = targetRvsdg.add_import({ valueType, "i" });
+  auto targetNode =
+      test_op::Create(targetRvsdg.root(), { &valueType }, { targetImport }, { &valueType });
+
+  // Act
+  jlm::rvsdg::substitution_map smap;
+  smap.insert(import, targetImport);
+  rvsdg.root()->copy(targetRvsdg.root(), smap, false, false);
+
+  // Assert
+  assert(targetRvsdg.root()->nnodes() == nodes.size() + 1);
+
+  origin = targetImport;
+  for (auto node : nodes)
+  {
+    auto copy = jlm::rvsdg::node_output::node(smap.lookup(node->output(0)));
+    assert(copy && copy->region() == targetRvsdg.root());
+    assert(copy->input(0)->origin() == origin);
+    origin = copy->output(0);
+  }
+
+  // The first copied node is congruent to the node that already resided in the target region
+  auto firstCopy = jlm::rvsdg::node_output::node(smap.lookup(nodes[0]->output(0)));
+  auto congruentNode = targetRvsdg.root()->FindCongruentNode(unaryOperation, { targetImport });
+  assert(congruentNode == targetNode || congruentNode == firstCopy);
+  assert(targetRvsdg.root()->FindCongruentNode(unaryOperation, { origin }) == nullptr);
+
+  auto lastCopy = jlm::rvsdg::node_output::node(origin);
+  auto lastOperand = lastCopy->input(0)->origin();
+  assert(targetRvsdg.root()->FindCongruentNode(unaryOperation, { lastOperand }) == lastCopy);
+
+  targetRvsdg.root()->remove_node(lastCopy);
+  assert(targetRvsdg.root()->FindCongruentNode(unaryOperation, { lastOperand }) == nullptr);
+
+  // Copying a region into itself duplicates its nodes
+  jlm::rvsdg::substitution_map selfSmap;
+  rvsdg.root()->copy(rvsdg.root(), selfSmap, false, false);
+  assert(rvsdg.root()->nnodes() == 2 * nodes.size());
+  auto selfCopy = jlm::rvsdg::node_output::node(selfSmap.lookup(nodes[0]->output(0)));
+  assert(selfCopy != nodes[0] && selfCopy->input(0)->origin() == import);
+}
+
 static int
 Test()
 {
@@ -289,6 +398,8 @@ Test()
   TestRemoveResultsWhere();
   TestRemoveArgumentsWhere();
   TestPruneArguments();
+  TestFindCongruentNode();
+  TestCopy();
 
   return 0;
 }
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+#include "test-types.hpp"
+
+#include <jlm/rvsdg/bitstring/type.hpp>
+#include <jlm/rvsdg/operation.hpp>
+
+#include <cassert>
+
+static void
+TestTypeInterning()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange & Act
+  auto bit32Type1 = type::Intern(bittype(32));
+  auto bit32Type2 = type::Intern(std::make_unique<bittype>(32));
+  auto bit8Type = type::Intern(bittype(8));
+
+  // Assert
+  assert(bit32Type1 == bit32Type2);
+  assert(bit32Type1 != bit8Type);
+  assert(*bit32Type1 == bit32);
+  assert(*bit8Type == bit8);
+}
+
+static void
+TestPortTypeSharing()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  jlm::tests::valuetype valueType;
+  jlm::tests::statetype stateType;
+
+  // Act
+  port port1(bit32);
+  port port2(bittype(32));
+  port port3(port1);
+  port port4(valueType);
+  port port5(stateType);
+
+  // Assert
+  assert(&port1.type() == &port2.type());
+  assert(&port1.type() == &port3.type());
+  assert(port1 == port2);
+
+  assert(&port1.type() != &port4.type());
+  assert(port1 != port4);
+  assert(port4 != port5);
+}
+
+static int
+Test()
+{
+  TestTypeInterning();
+  TestPortTypeSharing();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/rvsdg/TestType", Test)
@@ -135,3 +135,36 @@ test_graph(void)
 }
 
 JLM_UNIT_TEST_REGISTER("jlm/rvsdg/test-graph", test_graph)
+
+/**
+ * Test that the notifiers of a region only report changes to this region.
+ */
+static int
+TestNotifiers()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  jlm::tests::valuetype valueType;
+  jlm::rvsdg::graph graph1;
+  jlm::rvsdg::graph graph2;
+
+  std::vector<jlm::rvsdg::node *> createdNodes;
+  auto callback = graph1.root()->GetNotifiers().on_node_create.connect(
+      [&](jlm::rvsdg::node * node)
+      {
+        createdNodes.push_back(node);
+      });
+
+  // Act
+  auto node1 = jlm::tests::test_op::create(graph1.root(), {}, { &valueType });
+  jlm::tests::test_op::create(graph2.root(), {}, { &valueType });
+  auto node2 = jlm::tests::test_op::create(graph1.root(), {}, { &valueType });
+
+  // Assert
+  assert(createdNodes == std::vector<jlm::rvsdg::node *>({ node1, node2 }));
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/rvsdg/test-graph-notifiers", TestNotifiers)
@@ -213,6 +213,88 @@ TestRemoveInputsWhere()
   assert(node.ninputs() == 0);
 }
 
+/**
+ * Test that the users of an output are maintained and visited in insertion order.
+ */
+static void
+TestOutputUsers()
+{
+  // Arrange
+  jlm::rvsdg::graph rvsdg;
+  jlm::tests::valuetype valueType;
+  auto x = rvsdg.add_import({ valueType, "x" });
+  auto y = rvsdg.add_import({ valueType, "y" });
+
+  auto & node1 = jlm::tests::SimpleNode::Create(*rvsdg.root(), { x }, {});
+  auto & node2 = jlm::tests::SimpleNode::Create(*rvsdg.root(), { x }, {});
+  auto & node3 = jlm::tests::SimpleNode::Create(*rvsdg.root(), { x }, {});
+
+  using Users = std::vector<jlm::rvsdg::input *>;
+  auto users = [](const jlm::rvsdg::output & output)
+  {
+    return Users(output.begin(), output.end());
+  };
+
+  // Act & Assert
+  assert(x->nusers() == 3);
+  assert(users(*x) == Users({ node1.input(0), node2.input(0), node3.input(0) }));
+
+  node2.input(0)->divert_to(y);
+  assert(x->nusers() == 2);
+  assert(y->nusers() == 1);
+  assert(users(*x) == Users({ node1.input(0), node3.input(0) }));
+
+  x->divert_users(y);
+  assert(x->IsDead());
+  assert(y->nusers() == 3);
+  assert(users(*y) == Users({ node2.input(0), node1.input(0), node3.input(0) }));
+
+  remove(&node1);
+  assert(y->nusers() == 2);
+  assert(users(*y) == Users({ node2.input(0), node3.input(0) }));
+}
+
+/**
+ * Test that a depth change is propagated through a long chain of nodes without recursion, and that
+ * every node of the chain is only visited once.
+ */
+static void
+TestDepthOfDeepChain()
+{
+  // Arrange
+  const size_t numNodes = 100000;
+
+  jlm::tests::valuetype valueType;
+  jlm::rvsdg::graph rvsdg;
+  auto x = rvsdg.add_import({ valueType, "x" });
+
+  auto null = jlm::tests::test_op::create(rvsdg.root(), {}, { &valueType });
+
+  std::vector<jlm::rvsdg::node *> nodes;
+  jlm::rvsdg::output * origin = x;
+  for (size_t n = 0; n < numNodes; n++)
+  {
+    nodes.push_back(jlm::tests::test_op::create(rvsdg.root(), { origin }, { &valueType }));
+    origin = nodes.back()->output(0);
+  }
+
+  size_t numDepthChanges = 0;
+  auto callback = rvsdg.root()->GetNotifiers().on_node_depth_change.connect(
+      [&](jlm::rvsdg::node *, size_t)
+      {
+        numDepthChanges++;
+      });
+
+  // Act & Assert
+  nodes[0]->input(0)->divert_to(null->output(0));
+  assert(nodes.back()->depth() == numNodes);
+  assert(numDepthChanges == numNodes);
+
+  nodes[0]->input(0)->divert_to(x);
+  assert(nodes.back()->depth() == numNodes - 1);
+  assert(numDepthChanges == 2 * numNodes);
+}
+
 static int
 test_nodes()
 {
@@ -220,6 +302,8 @@ test_nodes()
   test_node_depth();
   TestRemoveOutputsWhere();
   TestRemoveInputsWhere();
+  TestOutputUsers();
+  TestDepthOfDeepChain();
 
   return 0;
 }
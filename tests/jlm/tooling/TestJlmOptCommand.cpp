@@ -5,6 +5,7 @@
 
 #include <test-registry.hpp>
 
+#include <jlm/llvm/opt/alias-analyses/Optimization.hpp>
 #include <jlm/tooling/Command.hpp>
 #include <jlm/util/strfmt.hpp>
 
@@ -46,10 +47,209 @@ TestStatistics()
   assert(receivedCommandLine == expectedCommandLine);
 }
 
+static void
+TestNumJobs()
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  jlm::util::StatisticsCollectorSettings statisticsCollectorSettings(
+      jlm::util::filepath("/myStatisticsDir/myStatisticsFile"),
+      {});
+
+  JlmOptCommandLineOptions commandLineOptions(
+      jlm::util::filepath("inputFile.ll"),
+      jlm::util::filepath("outputFile.ll"),
+      JlmOptCommandLineOptions::OutputFormat::Llvm,
+      statisticsCollectorSettings,
+      { JlmOptCommandLineOptions::OptimizationId::CommonNodeElimination,
+        JlmOptCommandLineOptions::OptimizationId::AASteensgaardRegionAware },
+      4);
+
+  JlmOptCommand command("jlm-opt", commandLineOptions);
+
+  // Act
+  auto receivedCommandLine = command.ToString();
+  auto optimizations = commandLineOptions.GetOptimizations();
+
+  // Assert
+  std::string expectedCommandLine = jlm::util::strfmt(
+      "jlm-opt ",
+      "--llvm ",
+      "--CommonNodeElimination --AASteensgaardRegionAware ",
+      "-s /myStatisticsDir/ ",
+      "--jobs=4 ",
+      "-o outputFile.ll ",
+      "inputFile.ll");
+
+  assert(receivedCommandLine == expectedCommandLine);
+
+  // The memory node provisioning uses the number of jobs
+  auto steensgaardRegionAware =
+      dynamic_cast<jlm::llvm::aa::SteensgaardRegionAware *>(optimizations[1]);
+  assert(steensgaardRegionAware->NumThreads() == 4);
+}
+
+static void
+TestInliningSettings()
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  jlm::util::StatisticsCollectorSettings statisticsCollectorSettings(
+      jlm::util::filepath("/myStatisticsDir/myStatisticsFile"),
+      {});
+
+  JlmOptCommandLineOptions commandLineOptions(
+      jlm::util::filepath("inputFile.ll"),
+      jlm::util::filepath("outputFile.ll"),
+      JlmOptCommandLineOptions::OutputFormat::Llvm,
+      statisticsCollectorSettings,
+      { JlmOptCommandLineOptions::OptimizationId::FunctionInlining },
+      1,
+      jlm::llvm::InliningSettings(100, 50, 10));
+
+  JlmOptCommand command("jlm-opt", commandLineOptions);
+
+  // Act
+  auto receivedCommandLine = command.ToString();
+  auto optimizations = commandLineOptions.GetOptimizations();
+
+  // Assert
+  std::string expectedCommandLine = jlm::util::strfmt(
+      "jlm-opt ",
+      "--llvm ",
+      "--FunctionInlining ",
+      "-s /myStatisticsDir/ ",
+      "--inline-threshold=100 --inline-loop-bonus=50 --inline-constant-argument-bonus=10 ",
+      "-o outputFile.ll ",
+      "inputFile.ll");
+
+  assert(receivedCommandLine == expectedCommandLine);
+
+  auto functionInlining = dynamic_cast<jlm::llvm::fctinline *>(optimizations[0]);
+  assert(functionInlining->GetSettings() == jlm::llvm::InliningSettings(100, 50, 10));
+
+  // The settings must not leak into the shared pass instance
+  auto sharedFunctionInlining = dynamic_cast<jlm::llvm::fctinline *>(
+      JlmOptCommandLineOptions::GetOptimization(
+          JlmOptCommandLineOptions::OptimizationId::FunctionInlining));
+  assert(sharedFunctionInlining != functionInlining);
+  assert(sharedFunctionInlining->GetSettings() == jlm::llvm::InliningSettings());
+}
+
+static void
+TestUnrollSettings()
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  jlm::util::StatisticsCollectorSettings statisticsCollectorSettings(
+      jlm::util::filepath("/myStatisticsDir/myStatisticsFile"),
+      {});
+
+  jlm::llvm::UnrollSettings unrollSettings(8, 16, 512, jlm::util::filepath("/myProfile"));
+  JlmOptCommandLineOptions commandLineOptions(
+      jlm::util::filepath("inputFile.ll"),
+      jlm::util::filepath("outputFile.ll"),
+      JlmOptCommandLineOptions::OutputFormat::Llvm,
+      statisticsCollectorSettings,
+      { JlmOptCommandLineOptions::OptimizationId::LoopUnrolling },
+      1,
+      jlm::llvm::InliningSettings(),
+      unrollSettings);
+
+  JlmOptCommand command("jlm-opt", commandLineOptions);
+
+  // Act
+  auto receivedCommandLine = command.ToString();
+  auto optimizations = commandLineOptions.GetOptimizations();
+
+  // Assert
+  std::string expectedCommandLine = jlm::util::strfmt(
+      "jlm-opt ",
+      "--llvm ",
+      "--LoopUnrolling ",
+      "-s /myStatisticsDir/ ",
+      "--unroll-factor=8 --unroll-full-threshold=16 --unroll-max-size=512 ",
+      "--unroll-profile=/myProfile ",
+      "-o outputFile.ll ",
+      "inputFile.ll");
+
+  assert(receivedCommandLine == expectedCommandLine);
+
+  auto loopUnrolling = dynamic_cast<jlm::llvm::loopunroll *>(optimizations[0]);
+  assert(loopUnrolling->GetSettings() == unrollSettings);
+
+  // The settings must not leak into the shared pass instance
+  auto sharedLoopUnrolling = dynamic_cast<jlm::llvm::loopunroll *>(
+      JlmOptCommandLineOptions::GetOptimization(
+          JlmOptCommandLineOptions::OptimizationId::LoopUnrolling));
+  assert(sharedLoopUnrolling != loopUnrolling);
+  assert(sharedLoopUnrolling->GetSettings() == jlm::llvm::UnrollSettings());
+}
+
+static void
+TestMemoryNodeCoarseningBudget()
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  jlm::util::StatisticsCollectorSettings statisticsCollectorSettings(
+      jlm::util::filepath("/myStatisticsDir/myStatisticsFile"),
+      {});
+
+  JlmOptCommandLineOptions commandLineOptions(
+      jlm::util::filepath("inputFile.ll"),
+      jlm::util::filepath("outputFile.ll"),
+      JlmOptCommandLineOptions::OutputFormat::Llvm,
+      statisticsCollectorSettings,
+      { JlmOptCommandLineOptions::OptimizationId::AASteensgaardAgnostic,
+        JlmOptCommandLineOptions::OptimizationId::AAAndersenRegionAware },
+      1,
+      jlm::llvm::InliningSettings(),
+      jlm::llvm::UnrollSettings(),
+      32);
+
+  JlmOptCommand command("jlm-opt", commandLineOptions);
+
+  // Act
+  auto receivedCommandLine = command.ToString();
+  auto optimizations = commandLineOptions.GetOptimizations();
+
+  // Assert
+  std::string expectedCommandLine = jlm::util::strfmt(
+      "jlm-opt ",
+      "--llvm ",
+      "--AASteensgaardAgnostic --AAAndersenRegionAware ",
+      "-s /myStatisticsDir/ ",
+      "--aa-coarsening-budget=32 ",
+      "-o outputFile.ll ",
+      "inputFile.ll");
+
+  assert(receivedCommandLine == expectedCommandLine);
+
+  auto steensgaardAgnostic = dynamic_cast<jlm::llvm::aa::SteensgaardAgnostic *>(optimizations[0]);
+  assert(steensgaardAgnostic->GetCoarseningBudget() == 32);
+
+  auto andersenRegionAware = dynamic_cast<jlm::llvm::aa::AndersenRegionAware *>(optimizations[1]);
+  assert(andersenRegionAware->GetCoarseningBudget() == 32);
+
+  // The memory nodes are not coarsened by default
+  auto sharedSteensgaardAgnostic = dynamic_cast<jlm::llvm::aa::SteensgaardAgnostic *>(
+      JlmOptCommandLineOptions::GetOptimization(
+          JlmOptCommandLineOptions::OptimizationId::AASteensgaardAgnostic));
+  assert(!sharedSteensgaardAgnostic->GetCoarseningBudget().has_value());
+}
+
 static int
 TestJlmOptCommand()
 {
   TestStatistics();
+  TestNumJobs();
+  TestInliningSettings();
+  TestUnrollSettings();
+  TestMemoryNodeCoarseningBudget();
 
   return 0;
 }
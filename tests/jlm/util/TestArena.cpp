@@ -0,0 +1,108 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/util/Arena.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+static void
+TestAllocation()
+{
+  using namespace jlm::util;
+
+  // Arrange
+  Arena arena;
+
+  // Act
+  std::vector<void *> blocks;
+  for (size_t n = 1; n < 2048; n++)
+    blocks.push_back(arena.Allocate(n % 600));
+
+  // Assert
+  for (auto block : blocks)
+    assert(reinterpret_cast<uintptr_t>(block) % alignof(std::max_align_t) == 0);
+
+  for (size_t n = 1; n < 2048; n++)
+    arena.Deallocate(blocks[n - 1], n % 600);
+}
+
+static void
+TestRecycling()
+{
+  using namespace jlm::util;
+
+  // Arrange
+  Arena arena;
+  auto p1 = arena.Allocate(24);
+  auto p2 = arena.Allocate(24);
+  auto reservedBytes = arena.NumReservedBytes();
+
+  // Act
+  arena.Deallocate(p1, 24);
+  arena.Deallocate(p2, 24);
+  auto p3 = arena.Allocate(32);
+  auto p4 = arena.Allocate(17);
+
+  // Assert
+  assert(p3 == p2);
+  assert(p4 == p1);
+  assert(arena.NumReservedBytes() == reservedBytes);
+}
+
+static void
+TestArenaAllocated()
+{
+  using namespace jlm::util;
+
+  class Object final : public ArenaAllocated
+  {
+  public:
+    explicit Object(size_t & numDestructed)
+        : NumDestructed_(numDestructed)
+    {}
+
+    ~Object()
+    {
+      NumDestructed_++;
+    }
+
+  private:
+    size_t & NumDestructed_;
+  };
+
+  // Arrange
+  Arena arena;
+  size_t numDestructed = 0;
+
+  // Act
+  auto arenaObject = new (arena) Object(numDestructed);
+  auto heapObject = new Object(numDestructed);
+  delete arenaObject;
+  delete heapObject;
+
+  auto recycledObject = new (arena) Object(numDestructed);
+
+  // Assert
+  assert(numDestructed == 2);
+  assert(recycledObject == arenaObject);
+
+  delete recycledObject;
+}
+
+static int
+TestArena()
+{
+  TestAllocation();
+  TestRecycling();
+  TestArenaAllocated();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/util/TestArena", TestArena)
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/util/FlatPointerMap.hpp>
+
+#include <cassert>
+#include <vector>
+
+static void
+TestInsertAndLookup()
+{
+  using namespace jlm::util;
+
+  std::vector<int> keys(1000);
+  std::vector<int> values(1000);
+
+  FlatPointerMap<int, int> map;
+  assert(map.Size() == 0);
+  assert(map.Lookup(&keys[0]) == nullptr);
+
+  for (size_t n = 0; n < keys.size(); n++)
+    map.Insert(&keys[n], &values[n]);
+  assert(map.Size() == keys.size());
+
+  for (size_t n = 0; n < keys.size(); n++)
+  {
+    assert(map.Contains(&keys[n]));
+    assert(map.Lookup(&keys[n]) == &values[n]);
+    assert(!map.Contains(&values[n]));
+  }
+
+  // Inserting an existing key replaces its value
+  map.Insert(&keys[0], &values[1]);
+  assert(map.Size() == keys.size());
+  assert(map.Lookup(&keys[0]) == &values[1]);
+}
+
+static void
+TestReserveAndClear()
+{
+  using namespace jlm::util;
+
+  std::vector<int> keys(100);
+  int value = 0;
+
+  FlatPointerMap<int, int> map;
+  map.Reserve(0);
+  assert(map.Capacity() == 0);
+
+  map.Reserve(keys.size());
+  auto capacity = map.Capacity();
+  assert(capacity >= keys.size());
+
+  for (auto & key : keys)
+    map.Insert(&key, &value);
+  assert(map.Capacity() == capacity);
+
+  // The map keeps its capacity when it is cleared
+  map.Clear();
+  assert(map.Size() == 0 && map.Capacity() == capacity);
+  assert(!map.Contains(&keys[0]));
+
+  map.Insert(&keys[1], &value);
+  assert(map.Size() == 1 && map.Contains(&keys[1]) && !map.Contains(&keys[0]));
+
+  // Copies and moves preserve the mappings
+  auto copy = map;
+  auto moved = std::move(map);
+  assert(copy.Lookup(&keys[1]) == &value && moved.Lookup(&keys[1]) == &value);
+  assert(map.Size() == 0 && !map.Contains(&keys[1]));
+}
+
+static int
+TestFlatPointerMap()
+{
+  TestInsertAndLookup();
+  TestReserveAndClear();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/util/TestFlatPointerMap", TestFlatPointerMap)
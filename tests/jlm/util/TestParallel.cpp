@@ -0,0 +1,88 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/util/Parallel.hpp>
+
+#include <atomic>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+static void
+TestAllItemsProcessed()
+{
+  using namespace jlm::util;
+
+  // Arrange
+  std::vector<size_t> items;
+  for (size_t n = 0; n < 1000; n++)
+    items.push_back(n);
+
+  for (size_t numThreads : { 0, 1, 4, 2000 })
+  {
+    std::vector<std::atomic<size_t>> counts(items.size());
+
+    // Act
+    ParallelForEach(
+        items,
+        numThreads,
+        [&](size_t item)
+        {
+          counts[item]++;
+        });
+
+    // Assert
+    for (auto & count : counts)
+      assert(count == 1);
+  }
+}
+
+static void
+TestFirstExceptionRethrown()
+{
+  using namespace jlm::util;
+
+  // Arrange
+  std::vector<size_t> items = { 0, 1, 2, 3, 4, 5, 6, 7 };
+  std::atomic<size_t> numProcessedItems(0);
+
+  // Act
+  std::string message;
+  try
+  {
+    ParallelForEach(
+        items,
+        4,
+        [&](size_t item)
+        {
+          numProcessedItems++;
+          if (item == 3 || item == 6)
+            throw std::runtime_error(std::to_string(item));
+        });
+  }
+  catch (std::runtime_error & error)
+  {
+    message = error.what();
+  }
+
+  // Assert
+  // All items are processed, and the error of the first failing item is reported
+  assert(numProcessedItems == items.size());
+  assert(message == "3");
+}
+
+static int
+TestParallel()
+{
+  TestAllItemsProcessed();
+  TestFirstExceptionRethrown();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/util/TestParallel", TestParallel)
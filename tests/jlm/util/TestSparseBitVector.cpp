@@ -0,0 +1,142 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/util/SparseBitVector.hpp>
+
+#include <cassert>
+#include <random>
+#include <set>
+#include <vector>
+
+static void
+TestInsertRemove()
+{
+  using namespace jlm::util;
+
+  // Arrange
+  SparseBitVector set({ 0, 63, 64, 255, 256, 100000 });
+
+  // Act & Assert
+  assert(set.Size() == 6);
+  assert(set.Contains(63));
+  assert(set.Contains(100000));
+  assert(!set.Contains(1));
+  assert(!set.Contains(99999));
+
+  assert(set.Insert(1));
+  assert(!set.Insert(1));
+  assert(set.Size() == 7);
+
+  assert(set.Remove(100000));
+  assert(!set.Remove(100000));
+  assert(!set.Remove(5000));
+  assert(set.Size() == 6);
+
+  std::vector<size_t> items(set.Items().begin(), set.Items().end());
+  assert(items == std::vector<size_t>({ 0, 1, 63, 64, 255, 256 }));
+
+  set.Clear();
+  assert(set.IsEmpty());
+  assert(set.Items().begin() == set.Items().end());
+}
+
+static void
+TestSetOperations()
+{
+  using namespace jlm::util;
+
+  // Arrange
+  SparseBitVector set1({ 1, 2, 300, 5000 });
+  SparseBitVector set2({ 2, 3, 5000, 70000 });
+
+  // Act & Assert
+  auto unionSet = set1;
+  assert(unionSet.UnionWith(set2));
+  assert(!unionSet.UnionWith(set2));
+  assert(unionSet == SparseBitVector({ 1, 2, 3, 300, 5000, 70000 }));
+  assert(set1.IsSubsetOf(unionSet));
+  assert(!unionSet.IsSubsetOf(set1));
+
+  auto intersection = set1;
+  assert(intersection.IntersectWith(set2));
+  assert(intersection == SparseBitVector({ 2, 5000 }));
+
+  auto difference = set1;
+  assert(difference.DifferenceWith(set2));
+  assert(!difference.DifferenceWith(set2));
+  assert(difference == SparseBitVector({ 1, 300 }));
+  assert(difference != set1);
+}
+
+// Compares the sparse bit vector operations against std::set on random sets
+static void
+TestRandomSets()
+{
+  using namespace jlm::util;
+
+  std::mt19937 random(0);
+  auto createRandomSets = [&](SparseBitVector & set, std::set<size_t> & reference)
+  {
+    auto range = 1 + random() % 4096;
+    for (size_t n = random() % 200; n > 0; n--)
+    {
+      auto item = random() % range;
+      assert(set.Insert(item) == reference.insert(item).second);
+    }
+  };
+
+  auto isEqual = [](const SparseBitVector & set, const std::set<size_t> & reference)
+  {
+    return set.Size() == reference.size()
+        && std::equal(set.Items().begin(), set.Items().end(), reference.begin());
+  };
+
+  for (size_t i = 0; i < 100; i++)
+  {
+    // Arrange
+    SparseBitVector set1, set2;
+    std::set<size_t> reference1, reference2;
+    createRandomSets(set1, reference1);
+    createRandomSets(set2, reference2);
+
+    // Act
+    auto unionSet = set1;
+    unionSet.UnionWith(set2);
+    auto intersection = set1;
+    intersection.IntersectWith(set2);
+    auto difference = set1;
+    difference.DifferenceWith(set2);
+
+    // Assert
+    std::set<size_t> referenceUnion = reference1, referenceIntersection, referenceDifference;
+    referenceUnion.insert(reference2.begin(), reference2.end());
+    for (auto item : reference1)
+    {
+      if (reference2.count(item))
+        referenceIntersection.insert(item);
+      else
+        referenceDifference.insert(item);
+    }
+
+    assert(isEqual(unionSet, referenceUnion));
+    assert(isEqual(intersection, referenceIntersection));
+    assert(isEqual(difference, referenceDifference));
+    assert(set1.IsSubsetOf(set2) == referenceDifference.empty());
+  }
+}
+
+static int
+TestSparseBitVector()
+{
+  TestInsertRemove();
+  TestSetOperations();
+  TestRandomSets();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/util/TestSparseBitVector", TestSparseBitVector)